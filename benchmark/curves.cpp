@@ -0,0 +1,162 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/curves/alt_bn128.hpp>
+#include <nil/crypto3/algebra/curves/secp_k1.hpp>
+#include <nil/crypto3/algebra/curves/secp_r1.hpp>
+#include <nil/crypto3/algebra/curves/ed25519.hpp>
+
+#include <nil/crypto3/algebra/algorithms/ecdsa_verify.hpp>
+#include <nil/crypto3/algebra/algorithms/x25519.hpp>
+#include <nil/crypto3/algebra/fixed_base_mul.hpp>
+#include <nil/crypto3/algebra/random_element.hpp>
+
+using namespace nil::crypto3::algebra;
+
+template<typename GroupType>
+void curve_add(benchmark::State &state) {
+    typename GroupType::value_type P = random_element<GroupType>(), Q = random_element<GroupType>();
+    for (auto _ : state) {
+        P = P + Q;
+        benchmark::DoNotOptimize(P);
+    }
+}
+
+template<typename GroupType>
+void curve_double(benchmark::State &state) {
+    typename GroupType::value_type P = random_element<GroupType>();
+    for (auto _ : state) {
+        P = P.doubled();
+        benchmark::DoNotOptimize(P);
+    }
+}
+
+/// Short Weierstrass only: the second operand is brought to Z = 1 through the affine form
+template<typename GroupType>
+void curve_mixed_add(benchmark::State &state) {
+    typedef typename GroupType::value_type value_type;
+
+    const auto affine = random_element<GroupType>().to_affine();
+    const value_type Q(affine.X, affine.Y, value_type::field_type::value_type::one());
+
+    value_type P = random_element<GroupType>();
+    for (auto _ : state) {
+        P = P.mixed_add(Q);
+        benchmark::DoNotOptimize(P);
+    }
+}
+
+/// Items are scalar bits, so items/s reads as the cost of one doubling plus the share of additions per bit
+template<typename GroupType>
+void curve_scalar_mul(benchmark::State &state) {
+    typedef typename GroupType::curve_type::scalar_field_type scalar_field_type;
+
+    const typename GroupType::value_type P = random_element<GroupType>();
+    const typename scalar_field_type::value_type k = random_element<scalar_field_type>();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(k * P);
+    }
+    state.SetItemsProcessed(state.iterations() * scalar_field_type::modulus_bits);
+}
+
+template<typename GroupType>
+void curve_fixed_base_mul(benchmark::State &state) {
+    const typename GroupType::curve_type::scalar_field_type::value_type k =
+        random_element<typename GroupType::curve_type::scalar_field_type>();
+    // keep the one-time table construction out of the measurement
+    benchmark::DoNotOptimize(fixed_base_mul<GroupType>(k));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(fixed_base_mul<GroupType>(k));
+    }
+}
+
+#define ALGEBRA_CURVE_BENCHMARKS(group)          \
+    BENCHMARK_TEMPLATE(curve_add, group);        \
+    BENCHMARK_TEMPLATE(curve_double, group);     \
+    BENCHMARK_TEMPLATE(curve_scalar_mul, group); \
+    BENCHMARK_TEMPLATE(curve_fixed_base_mul, group)
+
+#define ALGEBRA_SHORT_WEIERSTRASS_BENCHMARKS(group) \
+    ALGEBRA_CURVE_BENCHMARKS(group);                \
+    BENCHMARK_TEMPLATE(curve_mixed_add, group)
+
+ALGEBRA_SHORT_WEIERSTRASS_BENCHMARKS(curves::bls12<381>::g1_type<>);
+ALGEBRA_SHORT_WEIERSTRASS_BENCHMARKS(curves::bls12<381>::g2_type<>);
+ALGEBRA_SHORT_WEIERSTRASS_BENCHMARKS(curves::alt_bn128<254>::g1_type<>);
+ALGEBRA_SHORT_WEIERSTRASS_BENCHMARKS(curves::alt_bn128<254>::g2_type<>);
+ALGEBRA_SHORT_WEIERSTRASS_BENCHMARKS(curves::secp_k1<256>::g1_type<>);
+ALGEBRA_SHORT_WEIERSTRASS_BENCHMARKS(curves::secp_r1<256>::g1_type<>);
+ALGEBRA_CURVE_BENCHMARKS(curves::ed25519::g1_type<>);
+
+/// Verification of a valid signature
+template<typename GroupType>
+void curve_ecdsa_verify(benchmark::State &state) {
+    typedef typename GroupType::curve_type::scalar_field_type scalar_field_type;
+    typedef typename scalar_field_type::value_type scalar_value_type;
+    typedef nil::crypto3::multiprecision::cpp_int integral_type;
+
+    const scalar_value_type d = random_element<scalar_field_type>(), k = random_element<scalar_field_type>(),
+                            e = random_element<scalar_field_type>();
+    const typename GroupType::value_type Q = d * GroupType::value_type::one();
+    const integral_type x = integral_type((k * GroupType::value_type::one()).to_affine().X.data);
+    const scalar_value_type r(static_cast<typename scalar_field_type::integral_type>(
+        x % integral_type(scalar_field_type::modulus)));
+    const scalar_value_type s = k.inversed() * (e + r * d);
+
+    // keep the one-time fixed-base table construction out of the measurement
+    benchmark::DoNotOptimize(ecdsa_verify<GroupType>(Q, e, r, s));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(ecdsa_verify<GroupType>(Q, e, r, s));
+    }
+}
+BENCHMARK_TEMPLATE(curve_ecdsa_verify, curves::secp_k1<256>::g1_type<>);
+BENCHMARK_TEMPLATE(curve_ecdsa_verify, curves::secp_r1<256>::g1_type<>);
+
+static void curve_x25519(benchmark::State &state) {
+    x25519_octets scalar = {0}, u = {9};
+    scalar[0] = 0x2a;
+    for (auto _ : state) {
+        u = x25519(scalar, u);
+        benchmark::DoNotOptimize(u);
+    }
+}
+BENCHMARK(curve_x25519);
+
+static void curve_x25519_batch(benchmark::State &state) {
+    const std::size_t n = state.range(0);
+    std::vector<x25519_octets> scalars(n, x25519_octets {0x2a}), points(n, x25519_octets {9});
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(x25519_batch(scalars, points));
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(curve_x25519_batch)->Arg(64);
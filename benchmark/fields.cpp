@@ -0,0 +1,164 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#include <benchmark/benchmark.h>
+
+#include <nil/crypto3/algebra/fields/bls12/base_field.hpp>
+#include <nil/crypto3/algebra/fields/bls12/scalar_field.hpp>
+#include <nil/crypto3/algebra/fields/alt_bn128/base_field.hpp>
+#include <nil/crypto3/algebra/fields/curve25519/base_field.hpp>
+#include <nil/crypto3/algebra/fields/secp/secp_k1/base_field.hpp>
+#include <nil/crypto3/algebra/fields/pallas/base_field.hpp>
+
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/curves/alt_bn128.hpp>
+
+#include <nil/crypto3/algebra/random_element.hpp>
+
+using namespace nil::crypto3::algebra;
+
+template<typename FieldType>
+void field_mul(benchmark::State &state) {
+    typename FieldType::value_type a = random_element<FieldType>(), b = random_element<FieldType>();
+    for (auto _ : state) {
+        a = a * b;
+        benchmark::DoNotOptimize(a);
+    }
+}
+
+template<typename FieldType>
+void field_square(benchmark::State &state) {
+    typename FieldType::value_type a = random_element<FieldType>();
+    for (auto _ : state) {
+        a = a.squared();
+        benchmark::DoNotOptimize(a);
+    }
+}
+
+template<typename FieldType>
+void field_inverse(benchmark::State &state) {
+    typename FieldType::value_type a = random_element<FieldType>();
+    for (auto _ : state) {
+        a = a.inversed();
+        benchmark::DoNotOptimize(a);
+    }
+}
+
+template<typename FieldType>
+void field_sqrt(benchmark::State &state) {
+    const typename FieldType::value_type a = random_element<FieldType>().squared();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(a.sqrt());
+    }
+}
+
+template<typename FieldType>
+void field_cyclotomic_square(benchmark::State &state) {
+    // the easy part of the final exponentiation maps into the cyclotomic subgroup
+    typename FieldType::value_type a = random_element<FieldType>();
+    a = a.Frobenius_map(6) * a.inversed();
+    a = a.Frobenius_map(2) * a;
+    for (auto _ : state) {
+        a = a.cyclotomic_squared();
+        benchmark::DoNotOptimize(a);
+    }
+}
+
+template<typename FieldType>
+void field_frobenius_map(benchmark::State &state) {
+    typename FieldType::value_type a = random_element<FieldType>();
+    for (auto _ : state) {
+        a = a.Frobenius_map(1);
+        benchmark::DoNotOptimize(a);
+    }
+}
+
+/// Multiplication by the built-in integer k through the addition chain and through Montgomery conversion
+/// and a full multiplication; the crossover bounds fields::detail::mul_small_bound. The arguments are
+/// 2^b - 1, the most expensive chain for each bit length b
+template<typename FieldType>
+void field_mul_integral_chain(benchmark::State &state) {
+    const unsigned long long k = state.range(0);
+    typename FieldType::value_type a = random_element<FieldType>();
+    for (auto _ : state) {
+        a = fields::detail::mul_small(a, k);
+        benchmark::DoNotOptimize(a);
+    }
+}
+
+template<typename FieldType>
+void field_mul_integral_full(benchmark::State &state) {
+    const unsigned long long k = state.range(0);
+    typename FieldType::value_type a = random_element<FieldType>();
+    for (auto _ : state) {
+        a = a * typename FieldType::value_type(k);
+        benchmark::DoNotOptimize(a);
+    }
+}
+
+#define ALGEBRA_FIELD_BENCHMARKS(field)      \
+    BENCHMARK_TEMPLATE(field_mul, field);    \
+    BENCHMARK_TEMPLATE(field_square, field); \
+    BENCHMARK_TEMPLATE(field_inverse, field)
+
+#define ALGEBRA_PRIME_FIELD_BENCHMARKS(field) \
+    ALGEBRA_FIELD_BENCHMARKS(field);          \
+    BENCHMARK_TEMPLATE(field_sqrt, field)
+
+ALGEBRA_PRIME_FIELD_BENCHMARKS(fields::bls12_fq<381>);
+ALGEBRA_PRIME_FIELD_BENCHMARKS(fields::bls12_fr<381>);
+ALGEBRA_PRIME_FIELD_BENCHMARKS(fields::alt_bn128_fq<254>);
+ALGEBRA_PRIME_FIELD_BENCHMARKS(fields::curve25519_base_field);
+ALGEBRA_PRIME_FIELD_BENCHMARKS(fields::secp_k1_base_field<256>);
+ALGEBRA_PRIME_FIELD_BENCHMARKS(fields::pallas_base_field);
+
+BENCHMARK_TEMPLATE(field_mul_integral_chain, fields::bls12_fq<381>)
+    ->Arg(3)->Arg(15)->Arg(63)->Arg(255)->Arg(65535);
+BENCHMARK_TEMPLATE(field_mul_integral_full, fields::bls12_fq<381>)
+    ->Arg(3)->Arg(15)->Arg(63)->Arg(255)->Arg(65535);
+BENCHMARK_TEMPLATE(field_mul_integral_chain, fields::curve25519_base_field)
+    ->Arg(3)->Arg(15)->Arg(63)->Arg(255)->Arg(65535);
+BENCHMARK_TEMPLATE(field_mul_integral_full, fields::curve25519_base_field)
+    ->Arg(3)->Arg(15)->Arg(63)->Arg(255)->Arg(65535);
+
+// Extension towers: Fp2 of G2, Fp6 and Fp12 of GT
+using bls12_381_fp2 = curves::bls12<381>::g2_type<>::field_type;
+using bls12_381_fp12 = curves::bls12<381>::gt_type;
+using bls12_381_fp6 = bls12_381_fp12::underlying_field_type;
+using alt_bn128_fp2 = curves::alt_bn128<254>::g2_type<>::field_type;
+using alt_bn128_fp12 = curves::alt_bn128<254>::gt_type;
+using alt_bn128_fp6 = alt_bn128_fp12::underlying_field_type;
+
+ALGEBRA_PRIME_FIELD_BENCHMARKS(bls12_381_fp2);
+ALGEBRA_FIELD_BENCHMARKS(bls12_381_fp6);
+ALGEBRA_FIELD_BENCHMARKS(bls12_381_fp12);
+BENCHMARK_TEMPLATE(field_cyclotomic_square, bls12_381_fp12);
+BENCHMARK_TEMPLATE(field_frobenius_map, bls12_381_fp12);
+
+ALGEBRA_PRIME_FIELD_BENCHMARKS(alt_bn128_fp2);
+ALGEBRA_FIELD_BENCHMARKS(alt_bn128_fp6);
+ALGEBRA_FIELD_BENCHMARKS(alt_bn128_fp12);
+BENCHMARK_TEMPLATE(field_cyclotomic_square, alt_bn128_fp12);
+BENCHMARK_TEMPLATE(field_frobenius_map, alt_bn128_fp12);
@@ -0,0 +1,102 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <nil/crypto3/algebra/curves/alt_bn128.hpp>
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/curves/ed25519.hpp>
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <nil/crypto3/algebra/curves/secp_k1.hpp>
+
+#include <nil/crypto3/algebra/curves/detail/h2c/ep.hpp>
+#include <nil/crypto3/algebra/curves/detail/h2c/ep2.hpp>
+
+#include <nil/crypto3/hash/sha2.hpp>
+#include <nil/crypto3/hash/algorithm/hash.hpp>
+#include <nil/crypto3/hash/accumulators/hash.hpp>
+
+using namespace nil::crypto3::algebra;
+
+template<typename H2CType>
+void hash_to_curve_bench(benchmark::State &state) {
+    const std::string dst_str = "QUUX-V01-CS02-with-";
+    std::vector<std::uint8_t> dst(dst_str.begin(), dst_str.end());
+    dst.insert(dst.end(), H2CType::suite_type::suite_id.begin(), H2CType::suite_type::suite_id.end());
+
+    std::vector<std::uint8_t> msg(state.range(0), 0x61);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(H2CType::hash_to_curve(msg, dst));
+    }
+}
+
+template<typename H2CType>
+void hash_to_curve_batch_bench(benchmark::State &state) {
+    const std::string dst_str = "QUUX-V01-CS02-with-";
+    std::vector<std::uint8_t> dst(dst_str.begin(), dst_str.end());
+    dst.insert(dst.end(), H2CType::suite_type::suite_id.begin(), H2CType::suite_type::suite_id.end());
+
+    std::vector<std::vector<std::uint8_t>> msgs;
+    for (std::int64_t i = 0; i < state.range(0); ++i) {
+        msgs.emplace_back(32, static_cast<std::uint8_t>(i));
+    }
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(H2CType::hash_to_curve_batch(msgs, dst));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_TEMPLATE(hash_to_curve_bench, curves::detail::ep_map<curves::bls12<381>::g1_type<>>)
+    ->Arg(32)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(hash_to_curve_bench, curves::detail::ep2_map<curves::bls12<381>::g2_type<>>)
+    ->Arg(32)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(hash_to_curve_bench, curves::detail::ep_map<curves::alt_bn128_254::g1_type<>>)
+    ->Arg(32)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(hash_to_curve_bench, curves::detail::ep_map<curves::secp256k1::g1_type<>>)
+    ->Arg(32)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(hash_to_curve_bench, curves::detail::ep_map<curves::pallas::g1_type<>>)
+    ->Arg(32)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(hash_to_curve_bench, curves::detail::ep_map<curves::ed25519::g1_type<>>)
+    ->Arg(32)
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_TEMPLATE(hash_to_curve_batch_bench, curves::detail::ep_map<curves::bls12<381>::g1_type<>>)
+    ->Range(1, 64)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(hash_to_curve_batch_bench, curves::detail::ep_map<curves::alt_bn128_254::g1_type<>>)
+    ->Range(1, 64)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(hash_to_curve_batch_bench, curves::detail::ep_map<curves::ed25519::g1_type<>>)
+    ->Range(1, 64)
+    ->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,169 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#include <cstddef>
+#include <vector>
+
+#include <boost/random/mersenne_twister.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/curves/alt_bn128.hpp>
+
+#include <nil/crypto3/algebra/multiexp/multiexp.hpp>
+#include <nil/crypto3/algebra/multiexp/policies.hpp>
+
+#include <nil/crypto3/algebra/curves/params/multiexp/bls12.hpp>
+#include <nil/crypto3/algebra/curves/params/multiexp/alt_bn128.hpp>
+#include <nil/crypto3/algebra/curves/params/wnaf/bls12.hpp>
+#include <nil/crypto3/algebra/curves/params/wnaf/alt_bn128.hpp>
+
+#include <nil/crypto3/algebra/random_element.hpp>
+
+using namespace nil::crypto3::algebra;
+
+constexpr static const std::size_t multiexp_max_size = std::size_t(1) << 20;
+
+/// Distinct bases with Z = 1 as the mixed-addition methods expect, built once per group
+template<typename GroupType>
+const std::vector<typename GroupType::value_type> &multiexp_bases() {
+    typedef typename GroupType::value_type value_type;
+
+    static const std::vector<value_type> bases = [] {
+        std::vector<value_type> result;
+        result.reserve(multiexp_max_size);
+
+        const value_type step = random_element<GroupType>();
+        value_type current = random_element<GroupType>();
+        for (std::size_t i = 0; i < multiexp_max_size; ++i) {
+            const auto affine = current.to_affine();
+            result.emplace_back(affine.X, affine.Y, value_type::field_type::value_type::one());
+            current = current + step;
+        }
+        return result;
+    }();
+
+    return bases;
+}
+
+template<typename GroupType>
+const std::vector<typename GroupType::curve_type::scalar_field_type::value_type> &multiexp_scalars() {
+    typedef typename GroupType::curve_type::scalar_field_type scalar_field_type;
+
+    static const std::vector<typename scalar_field_type::value_type> scalars = [] {
+        boost::random::mt19937 rng;
+        std::vector<typename scalar_field_type::value_type> result;
+        result.reserve(multiexp_max_size);
+        for (std::size_t i = 0; i < multiexp_max_size; ++i) {
+            result.push_back(random_element<scalar_field_type>(rng));
+        }
+        return result;
+    }();
+
+    return scalars;
+}
+
+template<typename GroupType, typename MultiexpMethod>
+void multiexp_method(benchmark::State &state) {
+    const std::size_t n = state.range(0);
+    const auto &bases = multiexp_bases<GroupType>();
+    const auto &scalars = multiexp_scalars<GroupType>();
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            multiexp<MultiexpMethod>(bases.begin(), bases.begin() + n, scalars.begin(), scalars.begin() + n, 1));
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+/// Calls the method directly: multiexp itself hands instances this small to multiexp_method_straus
+template<typename GroupType, typename MultiexpMethod>
+void multiexp_small_method(benchmark::State &state) {
+    const std::size_t n = state.range(0);
+    const auto &bases = multiexp_bases<GroupType>();
+    const auto &scalars = multiexp_scalars<GroupType>();
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            MultiexpMethod::process(bases.begin(), bases.begin() + n, scalars.begin(), scalars.begin() + n));
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+/// a * G + b * Q as in ECDSA verification
+template<typename GroupType>
+void double_scalar_mul_bench(benchmark::State &state) {
+    const auto &bases = multiexp_bases<GroupType>();
+    const auto &scalars = multiexp_scalars<GroupType>();
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(double_scalar_mul<GroupType>(scalars[0], scalars[1], bases[0]));
+    }
+}
+
+template<typename GroupType>
+void separate_scalar_muls_bench(benchmark::State &state) {
+    const auto &bases = multiexp_bases<GroupType>();
+    const auto &scalars = multiexp_scalars<GroupType>();
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(scalars[0] * GroupType::value_type::one() + scalars[1] * bases[0]);
+    }
+}
+
+#define ALGEBRA_SMALL_MULTIEXP_BENCHMARKS(group)                                            \
+    BENCHMARK_TEMPLATE(multiexp_small_method, group, policies::multiexp_method_straus)      \
+        ->DenseRange(2, 8, 2)                                                               \
+        ->Unit(benchmark::kMicrosecond);                                                    \
+    BENCHMARK_TEMPLATE(multiexp_small_method, group, policies::multiexp_method_bos_coster)  \
+        ->DenseRange(2, 8, 2)                                                               \
+        ->Unit(benchmark::kMicrosecond);                                                    \
+    BENCHMARK_TEMPLATE(multiexp_small_method, group, policies::multiexp_method_naive_plain) \
+        ->DenseRange(2, 8, 2)                                                               \
+        ->Unit(benchmark::kMicrosecond);                                                    \
+    BENCHMARK_TEMPLATE(double_scalar_mul_bench, group)->Unit(benchmark::kMicrosecond);      \
+    BENCHMARK_TEMPLATE(separate_scalar_muls_bench, group)->Unit(benchmark::kMicrosecond)
+
+#define ALGEBRA_MULTIEXP_BENCHMARKS(group)                                            \
+    BENCHMARK_TEMPLATE(multiexp_method, group, policies::multiexp_method_bos_coster)  \
+        ->RangeMultiplier(4)                                                          \
+        ->Range(1 << 10, 1 << 20)                                                     \
+        ->Unit(benchmark::kMillisecond);                                              \
+    BENCHMARK_TEMPLATE(multiexp_method, group, policies::multiexp_method_BDLO12)      \
+        ->RangeMultiplier(4)                                                          \
+        ->Range(1 << 10, 1 << 20)                                                     \
+        ->Unit(benchmark::kMillisecond);                                              \
+    BENCHMARK_TEMPLATE(multiexp_method, group, policies::multiexp_method_naive_plain) \
+        ->RangeMultiplier(4)                                                          \
+        ->Range(1 << 10, 1 << 14)                                                     \
+        ->Unit(benchmark::kMillisecond)
+
+ALGEBRA_MULTIEXP_BENCHMARKS(curves::bls12<381>::g1_type<>);
+ALGEBRA_MULTIEXP_BENCHMARKS(curves::bls12<381>::g2_type<>);
+ALGEBRA_MULTIEXP_BENCHMARKS(curves::alt_bn128<254>::g1_type<>);
+
+ALGEBRA_SMALL_MULTIEXP_BENCHMARKS(curves::bls12<381>::g1_type<>);
+ALGEBRA_SMALL_MULTIEXP_BENCHMARKS(curves::alt_bn128<254>::g1_type<>);
@@ -0,0 +1,92 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <nil/crypto3/algebra/fields/bls12/scalar_field.hpp>
+#include <nil/crypto3/algebra/fields/alt_bn128/scalar_field.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/bls12.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/alt_bn128.hpp>
+
+#include <nil/crypto3/algebra/ntt/ntt.hpp>
+
+#include <nil/crypto3/algebra/random_element.hpp>
+
+using namespace nil::crypto3::algebra;
+
+/// Arguments: log2 of the transform size and the number of threads
+template<typename FieldType>
+void ntt_forward(benchmark::State &state) {
+    const ntt_domain<FieldType> domain(std::size_t(1) << state.range(0), state.range(1));
+    std::vector<typename FieldType::value_type> a(domain.size(), random_element<FieldType>());
+    for (auto _ : state) {
+        ntt(a, domain, state.range(1));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * domain.size());
+}
+
+template<typename FieldType>
+void ntt_inverse(benchmark::State &state) {
+    const ntt_domain<FieldType> domain(std::size_t(1) << state.range(0), state.range(1));
+    std::vector<typename FieldType::value_type> a(domain.size(), random_element<FieldType>());
+    for (auto _ : state) {
+        inverse_ntt(a, domain, state.range(1));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * domain.size());
+}
+
+template<typename FieldType>
+void ntt_coset(benchmark::State &state) {
+    const ntt_domain<FieldType> domain(std::size_t(1) << state.range(0), state.range(1));
+    std::vector<typename FieldType::value_type> a(domain.size(), random_element<FieldType>());
+    for (auto _ : state) {
+        coset_ntt(a, domain, state.range(1));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * domain.size());
+}
+
+static void ntt_arguments(benchmark::internal::Benchmark *b) {
+    const long threads = std::max(1u, std::thread::hardware_concurrency());
+    for (long log2_size = 16; log2_size <= 24; log2_size += 2) {
+        b->Args({log2_size, 1});
+        if (threads > 1) {
+            b->Args({log2_size, threads});
+        }
+    }
+    b->Unit(benchmark::kMillisecond)->UseRealTime();
+}
+
+BENCHMARK_TEMPLATE(ntt_forward, fields::bls12_fr<381>)->Apply(ntt_arguments);
+BENCHMARK_TEMPLATE(ntt_inverse, fields::bls12_fr<381>)->Apply(ntt_arguments);
+BENCHMARK_TEMPLATE(ntt_coset, fields::bls12_fr<381>)->Apply(ntt_arguments);
+BENCHMARK_TEMPLATE(ntt_forward, fields::alt_bn128_fr<254>)->Apply(ntt_arguments);
@@ -0,0 +1,154 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#include <cstdint>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/curves/alt_bn128.hpp>
+#include <nil/crypto3/algebra/curves/mnt4.hpp>
+#include <nil/crypto3/algebra/curves/mnt6.hpp>
+#include <nil/crypto3/algebra/curves/edwards.hpp>
+
+#include <nil/crypto3/algebra/pairing/bls12.hpp>
+#include <nil/crypto3/algebra/pairing/alt_bn128.hpp>
+#include <nil/crypto3/algebra/pairing/mnt4.hpp>
+#include <nil/crypto3/algebra/pairing/mnt6.hpp>
+#include <nil/crypto3/algebra/pairing/edwards.hpp>
+
+#include <nil/crypto3/algebra/algorithms/pair.hpp>
+
+#include <nil/crypto3/algebra/random_element.hpp>
+
+using namespace nil::crypto3::algebra;
+
+template<typename CurveType>
+void pairing_pair(benchmark::State &state) {
+    const auto P = random_element<typename CurveType::template g1_type<>>();
+    const auto Q = random_element<typename CurveType::template g2_type<>>();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(pair<CurveType>(P, Q));
+    }
+}
+
+template<typename CurveType>
+void pairing_pair_reduced(benchmark::State &state) {
+    const auto P = random_element<typename CurveType::template g1_type<>>();
+    const auto Q = random_element<typename CurveType::template g2_type<>>();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(pair_reduced<CurveType>(P, Q));
+    }
+}
+
+template<typename CurveType>
+void pairing_miller_loop(benchmark::State &state) {
+    const auto prec_P = precompute_g1<CurveType>(random_element<typename CurveType::template g1_type<>>());
+    const auto prec_Q = precompute_g2<CurveType>(random_element<typename CurveType::template g2_type<>>());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(miller_loop<CurveType>(prec_P, prec_Q));
+    }
+}
+
+template<typename CurveType>
+void pairing_final_exponentiation(benchmark::State &state) {
+    const auto f = pair<CurveType>(random_element<typename CurveType::template g1_type<>>(),
+                                   random_element<typename CurveType::template g2_type<>>());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(final_exponentiation<CurveType>(f));
+    }
+}
+
+#define ALGEBRA_PAIRING_BENCHMARKS(curve)                                           \
+    BENCHMARK_TEMPLATE(pairing_pair, curve)->Unit(benchmark::kMicrosecond);         \
+    BENCHMARK_TEMPLATE(pairing_pair_reduced, curve)->Unit(benchmark::kMicrosecond); \
+    BENCHMARK_TEMPLATE(pairing_miller_loop, curve)->Unit(benchmark::kMicrosecond);  \
+    BENCHMARK_TEMPLATE(pairing_final_exponentiation, curve)->Unit(benchmark::kMicrosecond)
+
+ALGEBRA_PAIRING_BENCHMARKS(curves::bls12<381>);
+ALGEBRA_PAIRING_BENCHMARKS(curves::alt_bn128<254>);
+ALGEBRA_PAIRING_BENCHMARKS(curves::mnt4<298>);
+ALGEBRA_PAIRING_BENCHMARKS(curves::mnt6<298>);
+ALGEBRA_PAIRING_BENCHMARKS(curves::edwards<183>);
+
+template<typename CurveType>
+void pairing_tate_miller_loop(benchmark::State &state) {
+    using policy_type = pairing::pairing_policy<CurveType>;
+
+    const auto P = random_element<typename CurveType::template g1_type<>>();
+    const auto Q = random_element<typename CurveType::template g2_type<>>();
+    const auto prec_P = policy_type::tate_precompute_g1::process(P);
+    const auto prec_Q = policy_type::tate_precompute_g2::process(Q);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(policy_type::tate_miller_loop::process(prec_P, prec_Q));
+    }
+}
+
+template<typename CurveType>
+void pairing_multi_miller_loop(benchmark::State &state) {
+    using policy_type = pairing::pairing_policy<CurveType>;
+    using g2_affine_type = typename CurveType::template g2_type<curves::coordinates::affine>;
+
+    std::vector<typename policy_type::g1_precomputed_type> prec_P;
+    std::vector<typename g2_affine_type::value_type> Q;
+    for (std::int64_t i = 0; i < state.range(0); ++i) {
+        prec_P.push_back(precompute_g1<CurveType>(random_element<typename CurveType::template g1_type<>>()));
+        Q.push_back(random_element<typename CurveType::template g2_type<>>().to_affine());
+    }
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(multi_miller_loop<CurveType>(prec_P, Q));
+    }
+}
+
+template<typename CurveType>
+void pairing_separate_miller_loops(benchmark::State &state) {
+    using policy_type = pairing::pairing_policy<CurveType>;
+
+    std::vector<typename policy_type::g1_precomputed_type> prec_P;
+    std::vector<typename policy_type::g2_precomputed_type> prec_Q;
+    for (std::int64_t i = 0; i < state.range(0); ++i) {
+        prec_P.push_back(precompute_g1<CurveType>(random_element<typename CurveType::template g1_type<>>()));
+        prec_Q.push_back(precompute_g2<CurveType>(random_element<typename CurveType::template g2_type<>>()));
+    }
+    for (auto _ : state) {
+        typename CurveType::gt_type::value_type f = CurveType::gt_type::value_type::one();
+        for (std::size_t i = 0; i < prec_P.size(); ++i) {
+            f = f * miller_loop<CurveType>(prec_P[i], prec_Q[i]);
+        }
+        benchmark::DoNotOptimize(f);
+    }
+}
+
+// Tate against ate on Edwards-183, and N-way against N separate ate Miller loops
+BENCHMARK_TEMPLATE(pairing_tate_miller_loop, curves::edwards<183>)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(pairing_multi_miller_loop, curves::edwards<183>)
+    ->RangeMultiplier(2)
+    ->Range(2, 16)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(pairing_separate_miller_loops, curves::edwards<183>)
+    ->RangeMultiplier(2)
+    ->Range(2, 16)
+    ->Unit(benchmark::kMicrosecond);
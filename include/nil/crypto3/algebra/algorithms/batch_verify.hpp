@@ -0,0 +1,122 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_BATCH_VERIFY_HPP
+#define CRYPTO3_ALGEBRA_BATCH_VERIFY_HPP
+
+#include <cstddef>
+#include <vector>
+
+#include <boost/assert.hpp>
+
+#include <nil/crypto3/algebra/curves/ed25519.hpp>
+
+#include <nil/crypto3/algebra/multiexp/multiexp.hpp>
+#include <nil/crypto3/algebra/multiexp/policies.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+
+            /*!
+             * @brief Checks the Schnorr-type equations [s_i]B = R_i + [k_i]A_i, B being the group generator, all
+             * at once.
+             *
+             * The equations are folded with the weights z_i into the single multi-scalar multiplication
+             * [-sum z_i s_i]B + sum [z_i]R_i + sum [z_i k_i]A_i, which is cleared of the cofactor and compared
+             * with the neutral element. The weights must be fresh uniformly random values of at least 128 bits,
+             * unknown to whoever produced the equations; a batch with a false equation then passes with
+             * probability about 2^-128. As the check is cofactored it accepts exactly the batches whose
+             * equations hold in the prime-order quotient, as the cofactored single verification of RFC 8032
+             * does.
+             *
+             * The multiexp runs on threads_count threads, MultiexpMethod being BDLO12 (Pippenger) by default
+             * or multiexp_method_bos_coster.
+             */
+            template<typename GroupType, typename MultiexpMethod = policies::multiexp_method_BDLO12>
+            bool batch_verify(
+                const std::vector<typename GroupType::value_type> &R,
+                const std::vector<typename GroupType::value_type> &A,
+                const std::vector<typename GroupType::curve_type::scalar_field_type::value_type> &s,
+                const std::vector<typename GroupType::curve_type::scalar_field_type::value_type> &k,
+                const std::vector<typename GroupType::curve_type::scalar_field_type::value_type> &weights,
+                std::size_t threads_count = 1) {
+
+                typedef typename GroupType::value_type value_type;
+                typedef typename GroupType::curve_type::scalar_field_type::value_type scalar_value_type;
+
+                const std::size_t n = R.size();
+                BOOST_ASSERT(A.size() == n && s.size() == n && k.size() == n && weights.size() == n);
+
+                if (n == 0) {
+                    return true;
+                }
+
+                std::vector<value_type> points;
+                std::vector<scalar_value_type> scalars;
+                points.reserve(2 * n + 1);
+                scalars.reserve(2 * n + 1);
+
+                scalar_value_type s_sum = scalar_value_type::zero();
+                for (std::size_t i = 0; i < n; ++i) {
+                    s_sum = s_sum + weights[i] * s[i];
+
+                    points.emplace_back(R[i]);
+                    scalars.emplace_back(weights[i]);
+                    points.emplace_back(A[i]);
+                    scalars.emplace_back(weights[i] * k[i]);
+                }
+                points.emplace_back(value_type::one());
+                scalars.emplace_back(-s_sum);
+
+                value_type result = parallel_multiexp<MultiexpMethod>(points.begin(), points.end(), scalars.begin(),
+                                                                      scalars.end(), threads_count);
+
+                constexpr std::size_t cofactor = GroupType::params_type::cofactor;
+                static_assert((cofactor & (cofactor - 1)) == 0, "cofactor is expected to be a power of two");
+                for (std::size_t c = cofactor; c > 1; c >>= 1) {
+                    result = result.doubled();
+                }
+
+                return result == value_type::zero();
+            }
+
+            /// Ed25519 instance of batch_verify: R and A are the decoded signature and public key points, s the
+            /// signature scalar and k = SHA-512(R || A || M) reduced modulo the group order
+            template<typename MultiexpMethod = policies::multiexp_method_BDLO12>
+            bool ed25519_batch_verify(
+                const std::vector<typename curves::ed25519::g1_type<>::value_type> &R,
+                const std::vector<typename curves::ed25519::g1_type<>::value_type> &A,
+                const std::vector<typename curves::ed25519::scalar_field_type::value_type> &s,
+                const std::vector<typename curves::ed25519::scalar_field_type::value_type> &k,
+                const std::vector<typename curves::ed25519::scalar_field_type::value_type> &weights,
+                std::size_t threads_count = 1) {
+                return batch_verify<curves::ed25519::g1_type<>, MultiexpMethod>(R, A, s, k, weights, threads_count);
+            }
+        }    // namespace algebra
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_BATCH_VERIFY_HPP
@@ -0,0 +1,198 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_BLS_BATCH_VERIFIER_HPP
+#define CRYPTO3_ALGEBRA_BLS_BATCH_VERIFIER_HPP
+
+#include <cstdint>
+#include <cstddef>
+#include <map>
+#include <vector>
+
+#include <boost/assert.hpp>
+
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/curves/detail/h2c/ep2.hpp>
+#include <nil/crypto3/algebra/pairing/bls12.hpp>
+#include <nil/crypto3/algebra/algorithms/pair.hpp>
+
+#include <nil/crypto3/algebra/multiexp/multiexp.hpp>
+#include <nil/crypto3/algebra/multiexp/policies.hpp>
+
+#include <nil/crypto3/algebra/random_element.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+
+            /*!
+             * @brief Streaming verifier for BLS signatures with public keys in G1 and signatures in G2.
+             *
+             * Every add_signature() call hashes its message to G2 (once per distinct message) and records the
+             * public key and signature together with a random weight r_i. finalize() then checks
+             *     prod_m e(sum_{i: m_i = m} [r_i]pk_i, H(m)) * e(-g1, sum_i [r_i]sig_i) == 1
+             * where both sums are computed with multi-scalar multiplications and the whole product is one
+             * multi-Miller loop followed by one final exponentiation. Signatures sharing a message, among them
+             * same-message aggregates added with add_aggregate(), cost a single pair in the Miller loop.
+             *
+             * With fresh random weights a batch containing an invalid signature is accepted with negligible
+             * probability. Public keys are expected to be validated (subgroup check, proof of possession for
+             * aggregates) before they are added.
+             */
+            template<typename CurveType = curves::bls12<381>,
+                     typename PairingPolicy = pairing::pairing_policy<CurveType>,
+                     typename MultiexpMethod = policies::multiexp_method_BDLO12>
+            class bls_batch_verifier {
+                typedef typename CurveType::template g1_type<> g1_type;
+                typedef typename CurveType::template g2_type<> g2_type;
+                typedef typename CurveType::gt_type gt_type;
+                typedef typename CurveType::scalar_field_type scalar_field_type;
+
+                typedef curves::detail::ep2_map<g2_type> hash_to_curve_type;
+
+            public:
+                typedef typename g1_type::value_type public_key_type;
+                typedef typename g2_type::value_type signature_type;
+                typedef typename scalar_field_type::value_type scalar_value_type;
+                typedef std::vector<std::uint8_t> message_type;
+
+                explicit bls_batch_verifier(const std::vector<std::uint8_t> &dst) : dst(dst) {
+                }
+
+                /// Adds the signature sig of pk on msg with the given weight, which has to be random and secret
+                template<typename InputType>
+                void add_signature(const public_key_type &pk, const InputType &msg, const signature_type &sig,
+                                   const scalar_value_type &weight) {
+                    message_group &group = group_of(msg);
+                    group.public_keys.emplace_back(pk);
+                    group.weights.emplace_back(weight);
+
+                    signatures.emplace_back(sig);
+                    signature_weights.emplace_back(weight);
+                }
+
+                template<typename InputType>
+                void add_signature(const public_key_type &pk, const InputType &msg, const signature_type &sig) {
+                    add_signature(pk, msg, sig, random_element<scalar_field_type>());
+                }
+
+                /// Adds the aggregate sig of the signatures of all of pks on the same msg
+                template<typename InputType>
+                void add_aggregate(const std::vector<public_key_type> &pks, const InputType &msg,
+                                   const signature_type &sig, const scalar_value_type &weight) {
+                    message_group &group = group_of(msg);
+                    group.public_keys.insert(group.public_keys.end(), pks.begin(), pks.end());
+                    group.weights.insert(group.weights.end(), pks.size(), weight);
+
+                    signatures.emplace_back(sig);
+                    signature_weights.emplace_back(weight);
+                }
+
+                template<typename InputType>
+                void add_aggregate(const std::vector<public_key_type> &pks, const InputType &msg,
+                                   const signature_type &sig) {
+                    add_aggregate(pks, msg, sig, random_element<scalar_field_type>());
+                }
+
+                /// Number of signatures and aggregates added since construction or the last finalize()
+                std::size_t size() const {
+                    return signatures.size();
+                }
+
+                /// Checks all the signatures added so far and resets the verifier. An empty batch is valid.
+                bool finalize(std::size_t threads_count = 1) {
+                    typedef typename CurveType::template g2_type<curves::coordinates::affine>::value_type
+                        g2_affine_value_type;
+
+                    std::vector<typename PairingPolicy::g1_precomputed_type> prec_P;
+                    std::vector<g2_affine_value_type> Q;
+                    prec_P.reserve(groups.size() + 1);
+                    Q.reserve(groups.size() + 1);
+
+                    for (const auto &entry : groups) {
+                        const message_group &group = entry.second;
+                        const public_key_type apk = parallel_multiexp<MultiexpMethod>(
+                            group.public_keys.begin(), group.public_keys.end(), group.weights.begin(),
+                            group.weights.end(), threads_count);
+
+                        if (!apk.is_zero() && !group.hashed.is_zero()) {
+                            prec_P.emplace_back(PairingPolicy::precompute_g1::process(apk));
+                            Q.emplace_back(group.hashed.to_affine());
+                        }
+                    }
+
+                    const signature_type aggregated_signature = parallel_multiexp<MultiexpMethod>(
+                        signatures.begin(), signatures.end(), signature_weights.begin(), signature_weights.end(),
+                        threads_count);
+
+                    if (!aggregated_signature.is_zero()) {
+                        prec_P.emplace_back(PairingPolicy::precompute_g1::process(-public_key_type::one()));
+                        Q.emplace_back(aggregated_signature.to_affine());
+                    }
+
+                    reset();
+
+                    if (Q.empty()) {
+                        return true;
+                    }
+
+                    return PairingPolicy::final_exponentiation::process(PairingPolicy::multi_miller_loop::process(
+                               prec_P, Q)) == gt_type::value_type::one();
+                }
+
+                void reset() {
+                    groups.clear();
+                    signatures.clear();
+                    signature_weights.clear();
+                }
+
+            private:
+                struct message_group {
+                    signature_type hashed;
+                    std::vector<public_key_type> public_keys;
+                    std::vector<scalar_value_type> weights;
+                };
+
+                template<typename InputType>
+                message_group &group_of(const InputType &msg) {
+                    message_type key(msg.begin(), msg.end());
+                    auto it = groups.find(key);
+                    if (it == groups.end()) {
+                        it = groups.emplace(std::move(key), message_group()).first;
+                        it->second.hashed = hash_to_curve_type::hash_to_curve(msg, dst);
+                    }
+                    return it->second;
+                }
+
+                std::vector<std::uint8_t> dst;
+                std::map<message_type, message_group> groups;
+                std::vector<signature_type> signatures;
+                std::vector<scalar_value_type> signature_weights;
+            };
+        }    // namespace algebra
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_BLS_BATCH_VERIFIER_HPP
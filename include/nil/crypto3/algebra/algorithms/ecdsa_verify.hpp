@@ -0,0 +1,154 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_ECDSA_VERIFY_HPP
+#define CRYPTO3_ALGEBRA_ECDSA_VERIFY_HPP
+
+#include <type_traits>
+
+#include <nil/crypto3/multiprecision/number.hpp>
+#include <nil/crypto3/multiprecision/cpp_int.hpp>
+
+#include <nil/crypto3/algebra/curves/detail/forms/short_weierstrass/coordinates.hpp>
+
+#include <nil/crypto3/algebra/multiexp/multiexp.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace detail {
+
+                /// Power of Z by which the stored X of a projective or Jacobian point differs from its affine x
+                template<typename Coordinates>
+                struct x_coordinate_scale;
+
+                template<>
+                struct x_coordinate_scale<curves::coordinates::projective> {
+                    template<typename FieldValueType>
+                    static FieldValueType process(const FieldValueType &Z) {
+                        return Z;
+                    }
+                };
+
+                template<>
+                struct x_coordinate_scale<curves::coordinates::projective_with_a4_minus_3>
+                    : x_coordinate_scale<curves::coordinates::projective> { };
+
+                template<>
+                struct x_coordinate_scale<curves::coordinates::jacobian> {
+                    template<typename FieldValueType>
+                    static FieldValueType process(const FieldValueType &Z) {
+                        return Z.squared();
+                    }
+                };
+
+                template<>
+                struct x_coordinate_scale<curves::coordinates::jacobian_with_a4_0>
+                    : x_coordinate_scale<curves::coordinates::jacobian> { };
+
+                template<>
+                struct x_coordinate_scale<curves::coordinates::jacobian_with_a4_minus_3>
+                    : x_coordinate_scale<curves::coordinates::jacobian> { };
+            }    // namespace detail
+
+            /*!
+             * @brief Checks x(R) mod n == r without bringing R to affine coordinates.
+             *
+             * The affine x lies in [0, p), so x mod n == r holds for x == r and, when n < p, also for
+             * x == r + n as long as r + n < p. Affine points compare both candidates with X directly, the others
+             * compare them as r * Z^2 (Jacobian) or r * Z (projective), which costs a multiplication or two
+             * instead of the inversion of to_affine(). Returns false for the point at infinity.
+             */
+            template<typename GroupType>
+            bool x_coordinate_equals(const typename GroupType::value_type &R,
+                                     const typename GroupType::curve_type::scalar_field_type::value_type &r) {
+                typedef typename GroupType::curve_type::base_field_type base_field_type;
+                typedef typename GroupType::curve_type::scalar_field_type scalar_field_type;
+                typedef typename base_field_type::value_type base_value_type;
+                typedef typename base_field_type::integral_type base_integral_type;
+                typedef typename GroupType::value_type::coordinates coordinates;
+                // temporary added until fixed-precision modular adaptor is ready:
+                typedef multiprecision::number<multiprecision::backends::cpp_int_backend<>> integral_type;
+
+                if (R.is_zero()) {
+                    return false;
+                }
+
+                const integral_type p = integral_type(base_field_type::modulus);
+                const integral_type n = integral_type(scalar_field_type::modulus);
+                integral_type candidate = integral_type(r.data);
+                if (candidate >= p) {
+                    return false;
+                }
+
+                const auto to_base = [](const integral_type &x) {
+                    return base_value_type(static_cast<base_integral_type>(x));
+                };
+
+                if constexpr (std::is_same<coordinates, curves::coordinates::affine>::value) {
+                    if (R.X == to_base(candidate)) {
+                        return true;
+                    }
+                    candidate += n;
+                    return candidate < p && R.X == to_base(candidate);
+                } else {
+                    const base_value_type scale = detail::x_coordinate_scale<coordinates>::process(R.Z);
+                    if (R.X == to_base(candidate) * scale) {
+                        return true;
+                    }
+                    candidate += n;
+                    return candidate < p && R.X == to_base(candidate) * scale;
+                }
+            }
+
+            /*!
+             * @brief Verifies the ECDSA equation x([e/s]G + [r/s]Q) mod n == r for the public key Q and the
+             * message hash e, already reduced modulo the group order n.
+             *
+             * [u1]G + [u2]Q is computed by double_scalar_mul (fixed-base comb for G, Straus for Q) and
+             * compared with r through x_coordinate_equals, so no inversion is done in the base field; the
+             * only inversion is s^-1 in the scalar field. Range checks of r and s are implied by their type,
+             * zero values are rejected, and so is a public key that is not on the curve. Membership of Q in the
+             * prime-order subgroup is left to the caller on curves with a cofactor.
+             */
+            template<typename GroupType>
+            bool ecdsa_verify(const typename GroupType::value_type &Q,
+                              const typename GroupType::curve_type::scalar_field_type::value_type &e,
+                              const typename GroupType::curve_type::scalar_field_type::value_type &r,
+                              const typename GroupType::curve_type::scalar_field_type::value_type &s) {
+                typedef typename GroupType::curve_type::scalar_field_type::value_type scalar_value_type;
+
+                if (r.is_zero() || s.is_zero() || Q.is_zero() || !Q.is_well_formed()) {
+                    return false;
+                }
+
+                const scalar_value_type w = s.inversed();
+                return x_coordinate_equals<GroupType>(double_scalar_mul<GroupType>(e * w, r * w, Q), r);
+            }
+        }    // namespace algebra
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_ECDSA_VERIFY_HPP
@@ -26,6 +26,8 @@
 #ifndef CRYPTO3_ALGEBRA_PAIRING_ALGORITHM_HPP
 #define CRYPTO3_ALGEBRA_PAIRING_ALGORITHM_HPP
 
+#include <vector>
+
 #include <nil/crypto3/algebra/pairing/pairing_policy.hpp>
 
 namespace nil {
@@ -101,6 +103,16 @@ namespace nil {
                 return PairingPolicy::double_miller_loop::process(prec_P1, prec_Q1, prec_P2, prec_Q2);
             }
 
+            /// Product of the Miller loops of the pairs (prec_P[i], Q[i]); the policy has to provide multi_miller_loop
+            template<typename PairingCurveType, typename PairingPolicy = pairing::pairing_policy<PairingCurveType>>
+            typename PairingCurveType::gt_type::value_type multi_miller_loop(
+                const std::vector<typename PairingPolicy::g1_precomputed_type> &prec_P,
+                const std::vector<
+                    typename PairingCurveType::template g2_type<curves::coordinates::affine>::value_type> &Q) {
+
+                return PairingPolicy::multi_miller_loop::process(prec_P, Q);
+            }
+
             template<typename PairingCurveType, typename PairingPolicy = pairing::pairing_policy<PairingCurveType>>
             typename PairingCurveType::gt_type::value_type
                 final_exponentiation(const typename PairingCurveType::gt_type::value_type &elt) {
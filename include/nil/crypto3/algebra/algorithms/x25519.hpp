@@ -0,0 +1,168 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_X25519_HPP
+#define CRYPTO3_ALGEBRA_X25519_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <boost/assert.hpp>
+
+#include <nil/crypto3/multiprecision/cpp_int.hpp>
+
+#include <nil/crypto3/algebra/curves/curve25519.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/montgomery/xz/ladder.hpp>
+
+#include <nil/crypto3/detail/parallel_for.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+
+            /// Little-endian 32-byte string, the encoding of both scalars and u-coordinates in RFC 7748
+            typedef std::array<std::uint8_t, 32> x25519_octets;
+
+            namespace detail {
+                typedef typename curves::curve25519::template g1_type<curves::coordinates::xz,
+                                                                      curves::forms::montgomery>::value_type
+                    x25519_xz_type;
+                typedef typename x25519_xz_type::field_type x25519_field_type;
+                typedef typename x25519_field_type::value_type x25519_field_value_type;
+                typedef typename x25519_field_type::integral_type x25519_integral_type;
+
+                /// decodeScalar25519: clear the cofactor bits, set bit 254
+                inline x25519_integral_type x25519_decode_scalar(x25519_octets scalar) {
+                    scalar[0] &= 248;
+                    scalar[31] &= 127;
+                    scalar[31] |= 64;
+
+                    x25519_integral_type result;
+                    multiprecision::import_bits(result, scalar.begin(), scalar.end(), 8, false);
+                    return result;
+                }
+
+                /// decodeUCoordinate: ignore bit 255, accept non-canonical values
+                inline x25519_field_value_type x25519_decode_u_coordinate(x25519_octets u) {
+                    u[31] &= 127;
+
+                    x25519_integral_type result;
+                    multiprecision::import_bits(result, u.begin(), u.end(), 8, false);
+                    if (result >= x25519_field_type::modulus) {
+                        result -= x25519_field_type::modulus;
+                    }
+                    return x25519_field_value_type(result);
+                }
+
+                inline x25519_octets x25519_encode_u_coordinate(const x25519_field_value_type &u) {
+                    x25519_octets result = {0};
+                    multiprecision::export_bits(u.data.template convert_to<x25519_integral_type>(), result.begin(),
+                                                8, false);
+                    return result;
+                }
+
+                inline x25519_xz_type x25519_ladder(const x25519_octets &scalar, const x25519_octets &u) {
+                    return curves::detail::montgomery_ladder<x25519_xz_type>(
+                        x25519_decode_u_coordinate(u), x25519_decode_scalar(scalar), x25519_field_type::modulus_bits);
+                }
+
+                /// Z^(p - 2): a fixed exponent, and zero for the point at infinity as RFC 7748 requires
+                inline x25519_field_value_type x25519_invert(const x25519_field_value_type &z) {
+                    return z.pow(x25519_integral_type(x25519_field_type::modulus - 2));
+                }
+            }    // namespace detail
+
+            /*!
+             * @brief The X25519 function of RFC 7748: the u-coordinate of scalar * (u, *) on curve25519.
+             *
+             * The ladder runs a fixed 255 steps with arithmetic conditional swaps and the final inversion is
+             * a fixed exponentiation, so no branch or memory access depends on the scalar; the timing of the
+             * underlying field arithmetic is that of the multiprecision backend.
+             */
+            inline x25519_octets x25519(const x25519_octets &scalar, const x25519_octets &u) {
+                const detail::x25519_xz_type R = detail::x25519_ladder(scalar, u);
+
+                return detail::x25519_encode_u_coordinate(R.X * detail::x25519_invert(R.Z));
+            }
+
+            /// X25519 with the base point u = 9, i.e. the public key for a private scalar
+            inline x25519_octets x25519_base(const x25519_octets &scalar) {
+                static const x25519_octets base_point = {9};
+
+                return x25519(scalar, base_point);
+            }
+
+            /*!
+             * @brief X25519 of scalars[i] and u_coordinates[i] for every i.
+             *
+             * Ladders are split between threads_count threads and share one field inversion through
+             * Montgomery's trick, which replaces all but one of the per-result inversions with three
+             * multiplications each.
+             */
+            inline std::vector<x25519_octets> x25519_batch(const std::vector<x25519_octets> &scalars,
+                                                           const std::vector<x25519_octets> &u_coordinates,
+                                                           std::size_t threads_count = 1) {
+                typedef detail::x25519_field_value_type field_value_type;
+
+                BOOST_ASSERT(scalars.size() == u_coordinates.size());
+
+                const std::size_t n = scalars.size();
+                std::vector<detail::x25519_xz_type> points(n);
+                crypto3::detail::parallel_for(0, n, threads_count, [&](std::size_t begin, std::size_t end) {
+                    for (std::size_t i = begin; i < end; ++i) {
+                        points[i] = detail::x25519_ladder(scalars[i], u_coordinates[i]);
+                    }
+                });
+
+                // Montgomery's trick: prefix products, one inversion, then unwind. Zero Z (low order inputs)
+                // is replaced by one and the corresponding X by zero, so the result is 0 as for x25519()
+                std::vector<field_value_type> prefix(n);
+                field_value_type acc = field_value_type::one();
+                for (std::size_t i = 0; i < n; ++i) {
+                    if (points[i].Z.is_zero()) {
+                        points[i] = detail::x25519_xz_type(field_value_type::zero(), field_value_type::one());
+                    }
+                    prefix[i] = acc;
+                    acc *= points[i].Z;
+                }
+
+                field_value_type acc_inversed = detail::x25519_invert(acc);
+
+                std::vector<x25519_octets> result(n);
+                for (std::size_t i = n; i-- > 0;) {
+                    const field_value_type z_inversed = acc_inversed * prefix[i];
+                    acc_inversed *= points[i].Z;
+                    result[i] = detail::x25519_encode_u_coordinate(points[i].X * z_inversed);
+                }
+
+                return result;
+            }
+        }    // namespace algebra
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_X25519_HPP
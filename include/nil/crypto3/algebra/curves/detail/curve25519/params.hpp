@@ -50,6 +50,7 @@ namespace nil {
                         constexpr static typename curve25519_types::integral_type b =
                             typename curve25519_types::integral_type(
                                 0x01);    ///< coefficient of Montgomery curve $b*y^2=x^3+a*x^2+x$
+                        static constexpr std::size_t cofactor = 8;
                     };
 
                     template<>
@@ -90,6 +91,7 @@ namespace nil {
                                                                                                              ///< Edwards
                                                                                                              ///< curves
                                                                                                              ///< $a*x^2+y^2=1+d*x^2*y^2$
+                        static constexpr std::size_t cofactor = 8;
                     };
 
                     template<>
@@ -27,6 +27,10 @@
 #ifndef CRYPTO3_ALGEBRA_CURVES_EDWARDS_G2_ELEMENT_HPP
 #define CRYPTO3_ALGEBRA_CURVES_EDWARDS_G2_ELEMENT_HPP
 
+#include <vector>
+
+#include <nil/crypto3/algebra/fields/detail/batch_inverse.hpp>
+
 #include <nil/crypto3/algebra/curves/detail/edwards/basic_policy.hpp>
 
 #include <nil/crypto3/detail/literals.hpp>
@@ -329,6 +333,25 @@ namespace nil {
                             return element_edwards_g2(p_out[0], p_out[1], p_out[2]);
                         }
 
+                        /** @brief
+                         *
+                         * Brings all elements to the special form Z = 1 expected by mixed_add with a single field
+                         * inversion. None of the elements may be the point at infinity.
+                         */
+                        static void batch_to_special_all_non_zeros(std::vector<element_edwards_g2> &vec) {
+                            std::vector<underlying_field_value_type> Z_vec;
+                            Z_vec.reserve(vec.size());
+                            for (const element_edwards_g2 &el : vec) {
+                                Z_vec.emplace_back(el.Z);
+                            }
+                            fields::detail::batch_inverse(Z_vec);
+
+                            for (std::size_t i = 0; i < vec.size(); ++i) {
+                                vec[i] = element_edwards_g2(vec[i].X * Z_vec[i], vec[i].Y * Z_vec[i],
+                                                            underlying_field_value_type::one());
+                            }
+                        }
+
                         constexpr static const g2_field_type_value twist = g2_field_type_value(
                             g2_field_type_value::underlying_type::zero(), g2_field_type_value::underlying_type::one(),
                             g2_field_type_value::underlying_type::zero());
@@ -156,21 +156,19 @@ namespace nil {
 
                         /*************************  Reducing operations  ***********************************/
 
-                        // /** @brief
-                        //  *
-                        //  * See https://eprint.iacr.org/2017/212.pdf, p. 7, par. 3.
-                        //  *
-                        //  * @return return the corresponding element from affine coordinates to
-                        //  xz coordinates
-                        //  */
-                        // constexpr curve_element<params_type, form, typename curves::coordinates::xz> to_xz() const {
-                        //     using result_type = curve_element<params_type, form, typename curves::coordinates::xz>;
-                        //
-                        //     return this->is_zero() ? result_type(result_type::field_type::value_type::one(),
-                        //                                          result_type::field_type::value_type::zero()) :
-                        //                              result_type(this->X,
-                        //                              result_type::field_type::value_type::one());
-                        // }
+                        /** @brief
+                         *
+                         * See https://eprint.iacr.org/2017/212.pdf, p. 7, par. 3.
+                         *
+                         * @return return the corresponding element from affine coordinates to
+                         * xz coordinates
+                         */
+                        constexpr curve_element<params_type, form, typename curves::coordinates::xz> to_xz() const {
+                            using result_type = curve_element<params_type, form, typename curves::coordinates::xz>;
+
+                            return this->is_zero() ? result_type::zero() :
+                                                     result_type(this->X, result_type::field_type::value_type::one());
+                        }
 
                         /**
                          * @brief
@@ -238,19 +236,18 @@ namespace nil {
                             if (this->is_zero()) {
                                 return (*this);
                             } else {
-                                const field_value_type two(2);
-                                const field_value_type three(3);
                                 const field_value_type A(params_type::A);
                                 const field_value_type B(params_type::B);
 
-                                const field_value_type temp1 = two * B * this->Y;
-                                const field_value_type temp2 =
-                                    three * this->X.squared() + two * A * this->X + field_value_type::one();
+                                const field_value_type temp1 = fields::mul_small<2>(B * this->Y);
+                                const field_value_type temp2 = fields::mul_small<3>(this->X.squared()) +
+                                                               fields::mul_small<2>(A * this->X) +
+                                                               field_value_type::one();
                                 const field_value_type temp1_sqr = temp1.squared();
                                 const field_value_type temp2_sqr = temp2.squared();
 
                                 return curve_element((B * temp2_sqr) / temp1_sqr - A - this->X - this->X,
-                                                     ((three * this->X + A) * temp2) / temp1 -
+                                                     ((fields::mul_small<3>(this->X) + A) * temp2) / temp1 -
                                                          (B * temp2 * temp2_sqr) / (temp1 * temp1_sqr) - this->Y);
                             }
                         }
@@ -267,7 +264,6 @@ namespace nil {
                          * @return addition of two elements from group G1
                          */
                         constexpr curve_element add(const curve_element &other) const {
-                            const field_value_type two(2);
                             const field_value_type A(params_type::A);
                             const field_value_type B(params_type::B);
 
@@ -277,7 +273,7 @@ namespace nil {
                             const field_value_type temp2_sqr = temp2.squared();
 
                             return curve_element((B * temp1_sqr) / temp2_sqr - A - this->X - other.X,
-                                                 ((two * this->X + other.X + A) * temp1) / temp2 -
+                                                 ((fields::mul_small<2>(this->X) + other.X + A) * temp1) / temp2 -
                                                      (B * temp1 * temp1_sqr) / (temp2 * temp2_sqr) - this->Y);
                         }
 
@@ -0,0 +1,175 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_MONTGOMERY_G1_ELEMENT_XZ_HPP
+#define CRYPTO3_ALGEBRA_CURVES_MONTGOMERY_G1_ELEMENT_XZ_HPP
+
+#include <nil/crypto3/algebra/curves/forms.hpp>
+#include <nil/crypto3/algebra/operation_counters.hpp>
+
+#include <nil/crypto3/algebra/curves/detail/forms/montgomery/coordinates.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/montgomery/xz/dadd_1987_m_3.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/montgomery/xz/dbl_1987_m_3.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/montgomery/xz/ladd_1987_m_3.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/montgomery/element_g1_affine.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+                    /** @brief A struct representing a group G1 of elliptic curve.
+                     *    @tparam CurveParams Parameters of the group
+                     *    @tparam Form Form of the curve
+                     *    @tparam Coordinates Representation coordinates of the group element
+                     */
+                    template<typename CurveParams, typename Form, typename Coordinates>
+                    struct curve_element;
+
+                    /** @brief A struct representing an element from the group G1 of Montgomery curve of
+                     *  XZ coordinates representation: the point (X/Z, y) with y dropped, so P and -P coincide.
+                     *  Generic addition is not available, only doubling and differential addition
+                     *  (P + Q given P - Q), which is all the Montgomery ladder needs.
+                     *  Description: https://hyperelliptic.org/EFD/g1p/auto-montgom-xz.html
+                     *
+                     */
+                    template<typename CurveParams>
+                    struct curve_element<CurveParams, forms::montgomery, coordinates::xz> {
+
+                        using params_type = CurveParams;
+                        using field_type = typename params_type::field_type;
+
+                    private:
+                        using field_value_type = typename field_type::value_type;
+
+                        using common_doubling_processor = montgomery_element_g1_xz_dbl_1987_m_3;
+                        using differential_addition_processor = montgomery_element_g1_xz_dadd_1987_m_3;
+                        using ladder_step_processor = montgomery_element_g1_xz_ladd_1987_m_3;
+
+                    public:
+                        using form = forms::montgomery;
+                        using coordinates = coordinates::xz;
+
+                        using group_type = typename params_type::template group_type<coordinates>;
+
+                        field_value_type X;
+                        field_value_type Z;
+
+                        /*************************  Constructors and zero/one  ***********************************/
+
+                        /** @brief
+                         *    @return the point at infinity by default
+                         *
+                         */
+                        constexpr curve_element() :
+                            curve_element(field_value_type::one(), field_value_type::zero()) {};
+
+                        /** @brief
+                         *    @return the selected point (X:Z)
+                         *
+                         */
+                        constexpr curve_element(const field_value_type &in_X, const field_value_type &in_Z) :
+                            X(in_X), Z(in_Z) {};
+
+                        /** @brief Get the point at infinity
+                         *
+                         */
+                        constexpr static curve_element zero() {
+                            return curve_element();
+                        }
+
+                        /** @brief Get the generator of group G1
+                         *
+                         */
+                        constexpr static curve_element one() {
+                            return curve_element(params_type::one_fill[0], field_value_type::one());
+                        }
+
+                        /*************************  Comparison operations  ***********************************/
+
+                        constexpr bool operator==(const curve_element &other) const {
+                            if (this->is_zero()) {
+                                return other.is_zero();
+                            }
+
+                            if (other.is_zero()) {
+                                return false;
+                            }
+
+                            /* now neither is O */
+
+                            // X1/Z1 = X2/Z2 <=> X1*Z2 = X2*Z1
+                            return (this->X * other.Z) == (other.X * this->Z);
+                        }
+
+                        constexpr bool operator!=(const curve_element &other) const {
+                            return !(operator==(other));
+                        }
+
+                        /** @brief
+                         *
+                         * @return true if element from group G1 is the point at infinity
+                         */
+                        constexpr bool is_zero() const {
+                            return this->Z.is_zero();
+                        }
+
+                        /*************************  Arithmetic operations  ***********************************/
+
+                        /** @brief
+                         *
+                         * @return doubled element from group G1
+                         */
+                        curve_element doubled() const {
+                            CRYPTO3_ALGEBRA_COUNT_OPERATION(point_dbl);
+                            return common_doubling_processor::process(*this);
+                        }
+
+                        /** @brief
+                         *
+                         * @return this + other, where difference = this - other (or other - this)
+                         */
+                        curve_element differential_add(const curve_element &other,
+                                                       const curve_element &difference) const {
+                            CRYPTO3_ALGEBRA_COUNT_OPERATION(point_add);
+                            return differential_addition_processor::process(*this, other, difference);
+                        }
+
+                        /** @brief One Montgomery ladder step: (this, other) becomes (2 * this, this + other),
+                         *  where difference_x is the affine x-coordinate of other - this.
+                         */
+                        void ladder_step(curve_element &other, const field_value_type &difference_x) {
+                            CRYPTO3_ALGEBRA_COUNT_OPERATION(point_add);
+                            CRYPTO3_ALGEBRA_COUNT_OPERATION(point_dbl);
+                            ladder_step_processor::process(*this, other, difference_x);
+                        }
+                    };
+
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_ALGEBRA_CURVES_MONTGOMERY_G1_ELEMENT_XZ_HPP
@@ -0,0 +1,77 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_MONTGOMERY_G1_ELEMENT_XZ_LADD_1987_M_3_HPP
+#define CRYPTO3_ALGEBRA_CURVES_MONTGOMERY_G1_ELEMENT_XZ_LADD_1987_M_3_HPP
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+
+                    /** @brief A struct representing a combined Montgomery ladder step from the group G1 of
+                     *  Montgomery curve for XZ coordinates representation: (P2, P3) -> (2*P2, P2 + P3) given the
+                     *  affine x-coordinate of the difference P3 - P2, i.e. Z1 = 1.
+                     *  https://hyperelliptic.org/EFD/g1p/auto-montgom-xz.html#ladder-mladd-1987-m
+                     *  https://datatracker.ietf.org/doc/html/rfc7748#section-5
+                     */
+
+                    struct montgomery_element_g1_xz_ladd_1987_m_3 {
+
+                        template<typename ElementType>
+                        static inline void process(ElementType &first,
+                                                   ElementType &second,
+                                                   const typename ElementType::field_type::value_type &difference_x) {
+
+                            using field_value_type = typename ElementType::field_type::value_type;
+
+                            static const field_value_type a24 =
+                                (field_value_type(ElementType::params_type::a) + field_value_type(2)) *
+                                field_value_type(4).inversed();
+
+                            field_value_type A = first.X + first.Z;      // A = X2+Z2
+                            field_value_type AA = A.squared();           // AA = A^2
+                            field_value_type B = first.X - first.Z;      // B = X2-Z2
+                            field_value_type BB = B.squared();           // BB = B^2
+                            field_value_type E = AA - BB;                // E = AA-BB
+                            field_value_type C = second.X + second.Z;    // C = X3+Z3
+                            field_value_type D = second.X - second.Z;    // D = X3-Z3
+                            field_value_type DA = D * A;                 // DA = D*A
+                            field_value_type CB = C * B;                 // CB = C*B
+
+                            second.X = (DA + CB).squared();                   // X5 = (DA+CB)^2
+                            second.Z = difference_x * (DA - CB).squared();    // Z5 = X1*(DA-CB)^2
+                            first.X = AA * BB;                                // X4 = AA*BB
+                            first.Z = E * (BB + a24 * E);                     // Z4 = E*(BB+a24*E)
+                        }
+                    };
+
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_ALGEBRA_CURVES_MONTGOMERY_G1_ELEMENT_XZ_LADD_1987_M_3_HPP
@@ -0,0 +1,91 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_MONTGOMERY_G1_ELEMENT_XZ_LADDER_HPP
+#define CRYPTO3_ALGEBRA_CURVES_MONTGOMERY_G1_ELEMENT_XZ_LADDER_HPP
+
+#include <cstddef>
+
+#include <nil/crypto3/multiprecision/number.hpp>
+
+#include <nil/crypto3/algebra/curves/detail/forms/montgomery/xz/element_g1.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+
+                    /** @brief Swaps first and second when swap is one and keeps them when it is zero, using
+                     *  the same field operations in both cases.
+                     */
+                    template<typename ElementType>
+                    inline void montgomery_ladder_cswap(ElementType &first, ElementType &second,
+                                                       const typename ElementType::field_type::value_type &swap) {
+                        using field_value_type = typename ElementType::field_type::value_type;
+
+                        const field_value_type dX = swap * (first.X - second.X);
+                        const field_value_type dZ = swap * (first.Z - second.Z);
+
+                        first.X -= dX;
+                        second.X += dX;
+                        first.Z -= dZ;
+                        second.Z += dZ;
+                    }
+
+                    /** @brief Montgomery ladder on x-coordinates (RFC 7748, section 5).
+                     *
+                     *  Scans exactly `bits` low bits of the scalar, from the top, with one ladder step and one
+                     *  conditional swap per bit, so the sequence of field operations depends on `bits` only.
+                     *    @return k * P in XZ coordinates, where u is the affine x-coordinate of P
+                     */
+                    template<typename ElementType, typename Backend,
+                             multiprecision::expression_template_option ExpressionTemplates>
+                    ElementType montgomery_ladder(const typename ElementType::field_type::value_type &u,
+                                                  const multiprecision::number<Backend, ExpressionTemplates> &k,
+                                                  std::size_t bits) {
+                        using field_value_type = typename ElementType::field_type::value_type;
+
+                        ElementType R0 = ElementType::zero(), R1(u, field_value_type::one());
+                        bool swap = false;
+
+                        for (std::size_t i = bits; i-- > 0;) {
+                            const bool bit = multiprecision::bit_test(k, i);
+                            montgomery_ladder_cswap(R0, R1, field_value_type(static_cast<unsigned>(swap ^ bit)));
+                            swap = bit;
+
+                            R0.ladder_step(R1, u);
+                        }
+                        montgomery_ladder_cswap(R0, R1, field_value_type(static_cast<unsigned>(swap)));
+
+                        return R0;
+                    }
+
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_ALGEBRA_CURVES_MONTGOMERY_G1_ELEMENT_XZ_LADDER_HPP
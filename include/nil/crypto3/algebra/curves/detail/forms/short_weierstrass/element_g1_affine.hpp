@@ -136,6 +136,17 @@ namespace nil {
                             return X == params_type::zero_fill[0] && Y == params_type::zero_fill[1];
                         }
 
+                        /** @brief
+                         *
+                         * @return true if element from group G1 lies on the elliptic curve y^2 = x^3 + ax + b
+                         */
+                        constexpr bool is_well_formed() const {
+                            if (this->is_zero()) {
+                                return true;
+                            }
+                            return this->Y.squared() == (this->X.squared() + params_type::a) * this->X + params_type::b;
+                        }
+
                         /*************************  Reducing operations  ***********************************/
 
                         /** @brief
@@ -199,7 +210,7 @@ namespace nil {
                             if (this->is_zero()) {
                                 return (*this);
                             } else {
-                                field_value_type Xsquared3pa = 3 * X.squared() + params_type::a;
+                                field_value_type Xsquared3pa = fields::mul_small<3>(X.squared()) + params_type::a;
                                 field_value_type Y2squared = Y.doubled().squared();
 
                                 field_value_type X3 = Xsquared3pa.squared() / Y2squared - X - X;
@@ -224,7 +235,7 @@ namespace nil {
                             field_value_type X2mX1 = other.X - X;
 
                             field_value_type X3 = Y2mY1.squared() / X2mX1.squared() - X - other.X;
-                            field_value_type Y3 = (2 * X + other.X) * Y2mY1 / X2mX1 -
+                            field_value_type Y3 = (fields::mul_small<2>(X) + other.X) * Y2mY1 / X2mX1 -
                                                   (Y2mY1.pow(3)) / (X2mX1.pow(3)) - Y;
 
                             return curve_element(X3, Y3);
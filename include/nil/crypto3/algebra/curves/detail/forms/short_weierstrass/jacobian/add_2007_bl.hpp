@@ -26,6 +26,8 @@
 #ifndef CRYPTO3_ALGEBRA_CURVES_SHORT_WEIERSTRASS_G1_ELEMENT_JACOBIAN_ADD_2007_BL_HPP
 #define CRYPTO3_ALGEBRA_CURVES_SHORT_WEIERSTRASS_G1_ELEMENT_JACOBIAN_ADD_2007_BL_HPP
 
+#include <nil/crypto3/algebra/operation_counters.hpp>
+
 namespace nil {
     namespace crypto3 {
         namespace algebra {
@@ -34,7 +36,7 @@ namespace nil {
 
                     /** @brief A struct representing element addition from the group G1 of short Weierstrass curve
                      *  for jacobian_ coordinates representation.
-                     *  NOTE: does not handle O and pts of order 2,4
+                     *  NOTE: does not handle O; equal and opposite inputs are detected from H and handled
                      *  http://www.hyperelliptic.org/EFD/g1p/auto-shortw-jacobian.html#addition-add-2007-bl
                      */
 
@@ -54,6 +56,11 @@ namespace nil {
                             field_value_type S2 = (second.Y) * (first.Z) * Z1Z1;    // S2 = Y2 * Z1 * Z1Z1
                             field_value_type H = U2 - U1;                           // H = U2-U1
                             field_value_type S2_minus_S1 = S2 - S1;
+                            // P == Q or P == -Q: double, or return O, instead of comparing the inputs up front
+                            if (H.is_zero()) {
+                                return S2_minus_S1.is_zero() ? first.doubled() : ElementType::zero();
+                            }
+                            CRYPTO3_ALGEBRA_COUNT_OPERATION(point_add);
                             field_value_type I = (H + H).squared();             // I = (2 * H)^2
                             field_value_type J = H * I;                         // J = H * I
                             field_value_type r = S2_minus_S1 + S2_minus_S1;     // r = 2 * (S2-S1)
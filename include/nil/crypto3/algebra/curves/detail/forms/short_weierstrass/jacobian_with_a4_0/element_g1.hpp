@@ -27,8 +27,13 @@
 #ifndef CRYPTO3_ALGEBRA_CURVES_SHORT_WEIERSTRASS_G1_ELEMENT_JACOBIAN_WITH_A4_0_HPP
 #define CRYPTO3_ALGEBRA_CURVES_SHORT_WEIERSTRASS_G1_ELEMENT_JACOBIAN_WITH_A4_0_HPP
 
+#include <vector>
+
+#include <nil/crypto3/algebra/fields/detail/batch_inverse.hpp>
+
 #include <nil/crypto3/algebra/curves/detail/scalar_mul.hpp>
 #include <nil/crypto3/algebra/curves/forms.hpp>
+#include <nil/crypto3/algebra/operation_counters.hpp>
 
 #include <nil/crypto3/algebra/curves/detail/forms/short_weierstrass/coordinates.hpp>
 #include <nil/crypto3/algebra/curves/detail/forms/short_weierstrass/jacobian_with_a4_0/add_2007_bl.hpp>
@@ -228,6 +233,27 @@ namespace nil {
                                                Z);    // X = X/Z, Y = Y/Z^2, Z = Z
                         }
 
+                        /** @brief
+                         *
+                         * Brings all elements to the special form Z = 1 expected by mixed_add with a single field
+                         * inversion. None of the elements may be the point at infinity.
+                         */
+                        static void batch_to_special_all_non_zeros(std::vector<curve_element> &vec) {
+                            std::vector<field_value_type> Z_vec;
+                            Z_vec.reserve(vec.size());
+                            for (const curve_element &el : vec) {
+                                Z_vec.emplace_back(el.Z);
+                            }
+                            fields::detail::batch_inverse(Z_vec);
+
+                            for (std::size_t i = 0; i < vec.size(); ++i) {
+                                const field_value_type Z2_inversed = Z_vec[i].squared();
+                                const field_value_type Z3_inversed = Z2_inversed * Z_vec[i];
+                                vec[i] = curve_element(vec[i].X * Z2_inversed, vec[i].Y * Z3_inversed,
+                                                       field_value_type::one());
+                            }
+                        }
+
                         /*************************  Arithmetic operations  ***********************************/
 
                         constexpr curve_element operator=(const curve_element &other) {
@@ -249,10 +275,6 @@ namespace nil {
                                 return (*this);
                             }
 
-                            if (*this == other) {
-                                return this->doubled();
-                            }
-
                             return common_addition_processor::process(*this, other);
                         }
 
@@ -269,6 +291,7 @@ namespace nil {
                          * @return doubled element from group G1
                          */
                         constexpr curve_element doubled() const {
+                            CRYPTO3_ALGEBRA_COUNT_OPERATION(point_dbl);
                             return common_doubling_processor::process(*this);
                         }
 
@@ -26,6 +26,8 @@
 #ifndef CRYPTO3_ALGEBRA_CURVES_SHORT_WEIERSTRASS_G1_ELEMENT_JACOBIAN_WITH_A4_0_MADD_2007_BL_HPP
 #define CRYPTO3_ALGEBRA_CURVES_SHORT_WEIERSTRASS_G1_ELEMENT_JACOBIAN_WITH_A4_0_MADD_2007_BL_HPP
 
+#include <nil/crypto3/algebra/operation_counters.hpp>
+
 namespace nil {
     namespace crypto3 {
         namespace algebra {
@@ -34,7 +36,7 @@ namespace nil {
 
                     /** @brief A struct representing element addition from the group G1 of short Weierstrass curve
                      *  for jacobian_with_a4_0 coordinates representation.
-                     *  NOTE: does not handle O and pts of order 2,4
+                     *  NOTE: does not handle O; equal and opposite inputs are detected from H and handled
                      *  http://www.hyperelliptic.org/EFD/g1p/auto-shortw-jacobian-0.html#addition-madd-2007-bl
                      */
 
@@ -53,6 +55,11 @@ namespace nil {
                             const field_value_type U2 = second.X * Z1Z1;                  // X2*Z1Z1
                             const field_value_type S2 = second.Y * first.Z * Z1Z1;        // S2 = Y2 * Z1 * Z1Z1
                             const field_value_type H = U2 - (first.X);                    // H = U2-X1
+                            // P == Q or P == -Q: double, or return O
+                            if (H.is_zero()) {
+                                return S2 == first.Y ? first.doubled() : ElementType::zero();
+                            }
+                            CRYPTO3_ALGEBRA_COUNT_OPERATION(point_madd);
                             const field_value_type HH = H.squared();                      // HH = H^2
                             const field_value_type I = HH.doubled().doubled();            // I = 4*HH
                             const field_value_type J = H * I;                             // J = H*I
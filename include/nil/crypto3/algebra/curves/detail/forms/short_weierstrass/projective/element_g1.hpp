@@ -27,8 +27,13 @@
 #ifndef CRYPTO3_ALGEBRA_CURVES_SHORT_WEIERSTRASS_G1_ELEMENT_PROJECTIVE_HPP
 #define CRYPTO3_ALGEBRA_CURVES_SHORT_WEIERSTRASS_G1_ELEMENT_PROJECTIVE_HPP
 
+#include <vector>
+
+#include <nil/crypto3/algebra/fields/detail/batch_inverse.hpp>
+
 #include <nil/crypto3/algebra/curves/detail/scalar_mul.hpp>
 #include <nil/crypto3/algebra/curves/forms.hpp>
+#include <nil/crypto3/algebra/operation_counters.hpp>
 
 #include <nil/crypto3/algebra/curves/detail/forms/short_weierstrass/coordinates.hpp>
 #include <nil/crypto3/algebra/curves/detail/forms/short_weierstrass/projective/add_1998_cmo_2.hpp>
@@ -193,6 +198,25 @@ namespace nil {
                             return result_type(X * Z.inversed(), Y * Z.inversed());    //  x=X/Z, y=Y/Z
                         }
 
+                        /** @brief
+                         *
+                         * Brings all elements to the special form Z = 1 expected by mixed_add with a single field
+                         * inversion. None of the elements may be the point at infinity.
+                         */
+                        static void batch_to_special_all_non_zeros(std::vector<curve_element> &vec) {
+                            std::vector<field_value_type> Z_vec;
+                            Z_vec.reserve(vec.size());
+                            for (const curve_element &el : vec) {
+                                Z_vec.emplace_back(el.Z);
+                            }
+                            fields::detail::batch_inverse(Z_vec);
+
+                            for (std::size_t i = 0; i < vec.size(); ++i) {
+                                vec[i] =
+                                    curve_element(vec[i].X * Z_vec[i], vec[i].Y * Z_vec[i], field_value_type::one());
+                            }
+                        }
+
                         /*************************  Arithmetic operations  ***********************************/
 
                         constexpr curve_element operator=(const curve_element &other) {
@@ -214,10 +238,6 @@ namespace nil {
                                 return (*this);
                             }
 
-                            if (*this == other) {
-                                return this->doubled();
-                            }
-
                             return common_addition_processor::process(*this, other);
                         }
 
@@ -234,6 +254,7 @@ namespace nil {
                          * @return doubled element from group G1
                          */
                         constexpr curve_element doubled() const {
+                            CRYPTO3_ALGEBRA_COUNT_OPERATION(point_dbl);
                             return common_doubling_processor::process(*this);
                         }
 
@@ -272,6 +293,7 @@ namespace nil {
                                 return this->doubled();
                             }
 
+                            CRYPTO3_ALGEBRA_COUNT_OPERATION(point_madd);
                             const field_value_type u = Y2Z1 - this->Y;                  // u = Y2*Z1-Y1
                             const field_value_type uu = u.squared();                    // uu = u2
                             const field_value_type v = X2Z1 - this->X;                  // v = X2*Z1-X1
@@ -27,6 +27,8 @@
 #ifndef CRYPTO3_ALGEBRA_CURVES_SHORT_WEIERSTRASS_G1_ELEMENT_PROJECTIVE_WITH_A4_MINUS_3_ADD_1998_CMO_2_HPP
 #define CRYPTO3_ALGEBRA_CURVES_SHORT_WEIERSTRASS_G1_ELEMENT_PROJECTIVE_WITH_A4_MINUS_3_ADD_1998_CMO_2_HPP
 
+#include <nil/crypto3/algebra/operation_counters.hpp>
+
 namespace nil {
     namespace crypto3 {
         namespace algebra {
@@ -35,7 +37,7 @@ namespace nil {
 
                     /** @brief A struct representing element addition from the group G1 of short Weierstrass curve
                      *  for projective_with_a4_minus_3 coordinates representation.
-                     *  NOTE: does not handle O and pts of order 2,4
+                     *  NOTE: does not handle O; equal and opposite inputs are detected from v and handled
                      *  http://www.hyperelliptic.org/EFD/g1p/auto-shortw-projective-3.html#addition-add-1998-cmo-2
                      */
 
@@ -53,6 +55,11 @@ namespace nil {
                             const field_value_type u = (second.Y) * (first.Z) - Y1Z2;    // u    = Y2*Z1-Y1Z2
                             const field_value_type uu = u.squared();                     // uu   = u^2
                             const field_value_type v = (second.X) * (first.Z) - X1Z2;    // v    = X2*Z1-X1Z2
+                            // P == Q or P == -Q: double, or return O, instead of comparing the inputs up front
+                            if (v.is_zero()) {
+                                return u.is_zero() ? first.doubled() : ElementType::zero();
+                            }
+                            CRYPTO3_ALGEBRA_COUNT_OPERATION(point_add);
                             const field_value_type vv = v.squared();                     // vv   = v^2
                             const field_value_type vvv = v * vv;                         // vvv  = v*vv
                             const field_value_type R = vv * X1Z2;                        // R    = vv*X1Z2
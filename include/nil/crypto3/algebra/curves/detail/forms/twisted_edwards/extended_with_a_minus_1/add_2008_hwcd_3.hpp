@@ -46,17 +46,16 @@ namespace nil {
 
                             field_value_type A = (first.Y - first.X) * (second.Y - second.X);    // A = (Y1-X1)*(Y2-X2)
                             field_value_type B = (first.Y + first.X) * (second.Y + second.X);    // B = (Y1+X1)*(Y2+X2)
-                            field_value_type C = first.T * field_value_type(2) * ElementType::params_type::d *
-                                                 second.T;                                    // C = T1*k*T2
-                            field_value_type D = first.Z * field_value_type(2) * second.Z;    // D = Z1*2*Z2
-                            field_value_type E = B - A;                                       // E = B-A
-                            field_value_type F = D - C;                                       // F = D-C
-                            field_value_type G = D + C;                                       // G = D+C
-                            field_value_type H = B + A;                                       // H = B+A
-                            field_value_type X3 = E * F;                                      // X3 = E*F
-                            field_value_type Y3 = G * H;                                      // Y3 = G*H
-                            field_value_type T3 = E * H;                                      // T3 = E*H
-                            field_value_type Z3 = F * G;                                      // Z3 = F*G
+                            field_value_type C = first.T * ElementType::d2 * second.T;           // C = T1*k*T2, k = 2*d
+                            field_value_type D = fields::mul_small<2>(first.Z * second.Z);       // D = Z1*2*Z2
+                            field_value_type E = B - A;                                          // E = B-A
+                            field_value_type F = D - C;                                          // F = D-C
+                            field_value_type G = D + C;                                          // G = D+C
+                            field_value_type H = B + A;                                          // H = B+A
+                            field_value_type X3 = E * F;                                         // X3 = E*F
+                            field_value_type Y3 = G * H;                                         // Y3 = G*H
+                            field_value_type T3 = E * H;                                         // T3 = E*H
+                            field_value_type Z3 = F * G;                                         // Z3 = F*G
 
                             return ElementType(X3, Y3, T3, Z3);
                         }
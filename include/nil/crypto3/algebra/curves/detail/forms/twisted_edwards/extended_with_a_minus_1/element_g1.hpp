@@ -26,13 +26,18 @@
 #ifndef CRYPTO3_ALGEBRA_CURVES_TWISTED_EDWARDS_G1_ELEMENT_EXTENDED_WITH_A_MINUS_1_HPP
 #define CRYPTO3_ALGEBRA_CURVES_TWISTED_EDWARDS_G1_ELEMENT_EXTENDED_WITH_A_MINUS_1_HPP
 
+#include <vector>
+
+#include <nil/crypto3/algebra/fields/detail/batch_inverse.hpp>
+
 #include <nil/crypto3/algebra/curves/detail/scalar_mul.hpp>
 #include <nil/crypto3/algebra/curves/forms.hpp>
+#include <nil/crypto3/algebra/operation_counters.hpp>
 
 #include <nil/crypto3/algebra/curves/detail/forms/twisted_edwards/coordinates.hpp>
 #include <nil/crypto3/algebra/curves/detail/forms/twisted_edwards/extended_with_a_minus_1/add_2008_hwcd_3.hpp>
 #include <nil/crypto3/algebra/curves/detail/forms/twisted_edwards/extended_with_a_minus_1/dbl_2008_hwcd.hpp>
-#include <nil/crypto3/algebra/curves/detail/forms/twisted_edwards/extended_with_a_minus_1/madd_2008_hwcd_2.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/twisted_edwards/extended_with_a_minus_1/madd_2008_hwcd_3.hpp>
 #include <nil/crypto3/algebra/curves/detail/forms/twisted_edwards/element_g1_affine.hpp>
 
 namespace nil {
@@ -67,7 +72,7 @@ namespace nil {
                         using common_doubling_processor =
                             twisted_edwards_element_g1_extended_with_a_minus_1_dbl_2008_hwcd;
                         using mixed_addition_processor =
-                            twisted_edwards_element_g1_extended_with_a_minus_1_madd_2008_hwcd_2;
+                            twisted_edwards_element_g1_extended_with_a_minus_1_madd_2008_hwcd_3;
 
                     public:
                         using form = forms::twisted_edwards;
@@ -75,6 +80,10 @@ namespace nil {
 
                         using group_type = typename params_type::template group_type<coordinates>;
 
+                        /// 2 * d, the constant k of the addition formulas, converted to a field element once
+                        constexpr static const field_value_type d2 =
+                            fields::mul_small<2>(field_value_type(params_type::d));
+
                         field_value_type X;
                         field_value_type Y;
                         field_value_type T;
@@ -193,6 +202,25 @@ namespace nil {
                             return result_type(X / Z, Y / Z);    //  x=X/Z, y=Y/Z
                         }
 
+                        /** @brief
+                         *
+                         * Brings all elements to the special form Z = 1 expected by mixed_add with a single field
+                         * inversion. None of the elements may be the point at infinity.
+                         */
+                        static void batch_to_special_all_non_zeros(std::vector<curve_element> &vec) {
+                            std::vector<field_value_type> Z_vec;
+                            Z_vec.reserve(vec.size());
+                            for (const curve_element &el : vec) {
+                                Z_vec.emplace_back(el.Z);
+                            }
+                            fields::detail::batch_inverse(Z_vec);
+
+                            for (std::size_t i = 0; i < vec.size(); ++i) {
+                                vec[i] = curve_element(vec[i].X * Z_vec[i], vec[i].Y * Z_vec[i], vec[i].T * Z_vec[i],
+                                                       field_value_type::one());
+                            }
+                        }
+
                         /*************************  Arithmetic operations  ***********************************/
 
                         constexpr curve_element operator=(const curve_element &other) {
@@ -219,6 +247,7 @@ namespace nil {
                                 return this->doubled();
                             }
 
+                            CRYPTO3_ALGEBRA_COUNT_OPERATION(point_add);
                             return common_addition_processor::process(*this, other);
                         }
 
@@ -235,6 +264,7 @@ namespace nil {
                          * @return doubled element from group G1
                          */
                         constexpr curve_element doubled() const {
+                            CRYPTO3_ALGEBRA_COUNT_OPERATION(point_dbl);
                             return common_doubling_processor::process(*this);
                         }
 
@@ -254,10 +284,16 @@ namespace nil {
                                 return *this;
                             }
 
+                            CRYPTO3_ALGEBRA_COUNT_OPERATION(point_madd);
                             return mixed_addition_processor::process(*this, other);
                         }
                     };
 
+                    template<typename CurveParams>
+                    constexpr typename curve_element<CurveParams, forms::twisted_edwards,
+                                                     coordinates::extended_with_a_minus_1>::field_value_type const
+                        curve_element<CurveParams, forms::twisted_edwards, coordinates::extended_with_a_minus_1>::d2;
+
                 }    // namespace detail
             }        // namespace curves
         }            // namespace algebra
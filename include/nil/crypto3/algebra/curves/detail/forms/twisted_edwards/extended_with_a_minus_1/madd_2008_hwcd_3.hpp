@@ -23,21 +23,20 @@
 // SOFTWARE.
 //---------------------------------------------------------------------------//
 
-#ifndef CRYPTO3_ALGEBRA_CURVES_TWISTED_EDWARDS_G1_ELEMENT_EXTENDED_WITH_A_MINUS_1_MADD_2008_HWCD_2_HPP
-#define CRYPTO3_ALGEBRA_CURVES_TWISTED_EDWARDS_G1_ELEMENT_EXTENDED_WITH_A_MINUS_1_MADD_2008_HWCD_2_HPP
+#ifndef CRYPTO3_ALGEBRA_CURVES_TWISTED_EDWARDS_G1_ELEMENT_EXTENDED_WITH_A_MINUS_1_MADD_2008_HWCD_3_HPP
+#define CRYPTO3_ALGEBRA_CURVES_TWISTED_EDWARDS_G1_ELEMENT_EXTENDED_WITH_A_MINUS_1_MADD_2008_HWCD_3_HPP
 
 namespace nil {
     namespace crypto3 {
         namespace algebra {
             namespace curves {
                 namespace detail {
-
-                    /** @brief A struct representing element addition from the group G1 of twisted Edwards curve
-                     *  for extended coordinates with a=-1 representation.
-                     *  https://hyperelliptic.org/EFD/g1p/auto-twisted-extended-1.html#addition-madd-2008-hwcd-2
+                    /** @brief A struct representing element mixed addition from the group G1 of twisted Edwards
+                     *  curve for extended coordinates with a=-1 representation. Unlike madd-2008-hwcd-2 the
+                     *  formula is unified, so it also doubles and accepts the neutral element.
+                     *  https://hyperelliptic.org/EFD/g1p/auto-twisted-extended-1.html#addition-madd-2008-hwcd-3
                      */
-
-                    struct twisted_edwards_element_g1_extended_with_a_minus_1_madd_2008_hwcd_2 {
+                    struct twisted_edwards_element_g1_extended_with_a_minus_1_madd_2008_hwcd_3 {
 
                         template<typename ElementType>
                         constexpr static inline ElementType process(const ElementType &first,
@@ -47,19 +46,18 @@ namespace nil {
 
                             // assert(second.Z == field_value_type::one());
 
-                            field_value_type A = first.X * second.X;    // A = X1*X2
-                            field_value_type B = first.Y * second.Y;    // B = Y1*Y2
-                            field_value_type C = first.Z * second.T;    // C = Z1*T2
-                            field_value_type D = first.T;               // D = T1
-                            field_value_type E = D + C;                 // E = D+C
-                            field_value_type F =
-                                (first.X - first.Y) * (second.X + second.Y) + B - A;     // F = (X1-Y1)*(X2+Y2)+B-A
-                            field_value_type G = B + ElementType::params_type::a * A;    // G = B+a*A
-                            field_value_type H = D - C;                                  // H = D-C
-                            field_value_type X3 = E * F;                                 // X3 = E*F
-                            field_value_type Y3 = G * H;                                 // Y3 = G*H
-                            field_value_type T3 = E * H;                                 // T3 = E*H
-                            field_value_type Z3 = F * G;                                 // Z3 = F*G
+                            field_value_type A = (first.Y - first.X) * (second.Y - second.X);    // A = (Y1-X1)*(Y2-X2)
+                            field_value_type B = (first.Y + first.X) * (second.Y + second.X);    // B = (Y1+X1)*(Y2+X2)
+                            field_value_type C = first.T * ElementType::d2 * second.T;           // C = T1*k*T2, k = 2*d
+                            field_value_type D = first.Z.doubled();                              // D = Z1*2
+                            field_value_type E = B - A;                                          // E = B-A
+                            field_value_type F = D - C;                                          // F = D-C
+                            field_value_type G = D + C;                                          // G = D+C
+                            field_value_type H = B + A;                                          // H = B+A
+                            field_value_type X3 = E * F;                                         // X3 = E*F
+                            field_value_type Y3 = G * H;                                         // Y3 = G*H
+                            field_value_type T3 = E * H;                                         // T3 = E*H
+                            field_value_type Z3 = F * G;                                         // Z3 = F*G
 
                             return ElementType(X3, Y3, T3, Z3);
                         }
@@ -70,4 +68,4 @@ namespace nil {
         }            // namespace algebra
     }                // namespace crypto3
 }    // namespace nil
-#endif    // CRYPTO3_ALGEBRA_CURVES_TWISTED_EDWARDS_G1_ELEMENT_EXTENDED_WITH_A_MINUS_1_MADD_2008_HWCD_2_HPP
+#endif    // CRYPTO3_ALGEBRA_CURVES_TWISTED_EDWARDS_G1_ELEMENT_EXTENDED_WITH_A_MINUS_1_MADD_2008_HWCD_3_HPP
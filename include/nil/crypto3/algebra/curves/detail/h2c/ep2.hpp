@@ -31,6 +31,7 @@
 #include <nil/crypto3/algebra/curves/detail/h2c/h2c_expand.hpp>
 
 #include <type_traits>
+#include <vector>
 
 #include <nil/crypto3/multiprecision/cpp_int.hpp>
 
@@ -58,7 +59,7 @@ namespace nil {
                         constexpr static std::size_t L = suite_type::L;
                         constexpr static std::size_t k = suite_type::k;
 
-                        typedef expand_message_xmd<k, hash_type> expand_message_ro;
+                        typedef typename h2c_expand_message_ro<GroupType>::type expand_message_ro;
                         // typedef expand_message_xof<k, hash_type> expand_message_nu;
                         constexpr static const modular_params_type p_modulus_params = suite_type::p;
 
@@ -74,6 +75,30 @@ namespace nil {
                             group_value_type Q1 = map_to_curve<GroupType>::process(u[1]);
                             return clear_cofactor(Q0 + Q1);
                         }
+
+                        /// Hashes every message of msgs with the mappings run in one batch, so that the whole batch
+                        /// shares the field inversions of map_to_curve
+                        template<typename InputType, typename DstType,
+                                 typename = typename std::enable_if<
+                                     std::is_same<std::uint8_t, typename InputType::value_type>::value &&
+                                     std::is_same<std::uint8_t, typename DstType::value_type>::value>::type>
+                        static inline std::vector<group_value_type>
+                            hash_to_curve_batch(const std::vector<InputType> &msgs, const DstType &dst) {
+                            std::vector<field_value_type> u;
+                            u.reserve(2 * msgs.size());
+                            for (const InputType &msg : msgs) {
+                                auto u_msg = hash_to_field<2, expand_message_ro>(msg, dst);
+                                u.insert(u.end(), u_msg.begin(), u_msg.end());
+                            }
+
+                            std::vector<group_value_type> Q = map_to_curve<GroupType>::process_batch(u);
+                            std::vector<group_value_type> result;
+                            result.reserve(msgs.size());
+                            for (std::size_t i = 0; i < msgs.size(); i++) {
+                                result.emplace_back(clear_cofactor(Q[2 * i] + Q[2 * i + 1]));
+                            }
+                            return result;
+                        }
                         // private:
                         template<std::size_t N, typename expand_message_type, typename InputType, typename DstType,
                                  typename = typename std::enable_if<
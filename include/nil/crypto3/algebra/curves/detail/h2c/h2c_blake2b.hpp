@@ -0,0 +1,193 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_HASH_TO_CURVE_BLAKE2B_HPP
+#define CRYPTO3_ALGEBRA_CURVES_HASH_TO_CURVE_BLAKE2B_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+                    /*!
+                     * @brief Unkeyed BLAKE2b (RFC 7693) with an all-zero personalization, the hash behind the
+                     * Halo2 (pasta_curves) hash-to-curve suites. Bytes are absorbed incrementally and digest()
+                     * finalizes a copy of the state, so the object can be reused as a prefix state.
+                     */
+                    template<std::size_t DigestBits>
+                    class blake2b {
+                        static_assert(DigestBits % 8 == 0 && DigestBits >= 8 && DigestBits <= 512,
+                                      "BLAKE2b digests are 1 to 64 bytes long");
+
+                        typedef std::array<std::uint64_t, 8> state_type;
+
+                        constexpr static const std::size_t block_bytes = 128;
+
+                        constexpr static const state_type iv = {
+                            0x6A09E667F3BCC908, 0xBB67AE8584CAA73B, 0x3C6EF372FE94F82B, 0xA54FF53A5F1D36F1,
+                            0x510E527FADE682D1, 0x9B05688C2B3E6C1F, 0x1F83D9ABFB41BD6B, 0x5BE0CD19137E2179};
+                        constexpr static const std::array<std::array<std::uint8_t, 16>, 10> sigma = {{
+                            {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+                            {14, 10, 4, 8, 9, 15, 13, 6, 1, 12, 0, 2, 11, 7, 5, 3},
+                            {11, 8, 12, 0, 5, 2, 15, 13, 10, 14, 3, 6, 7, 1, 9, 4},
+                            {7, 9, 3, 1, 13, 12, 11, 14, 2, 6, 5, 10, 4, 0, 15, 8},
+                            {9, 0, 5, 7, 2, 4, 10, 15, 14, 1, 11, 12, 6, 8, 3, 13},
+                            {2, 12, 6, 10, 0, 11, 8, 3, 4, 13, 7, 5, 15, 14, 1, 9},
+                            {12, 5, 1, 15, 14, 13, 4, 10, 0, 7, 6, 3, 9, 2, 8, 11},
+                            {13, 11, 7, 14, 12, 1, 3, 9, 5, 0, 15, 4, 8, 6, 2, 10},
+                            {6, 15, 14, 9, 11, 3, 0, 8, 12, 2, 13, 7, 1, 4, 10, 5},
+                            {10, 2, 8, 4, 7, 6, 1, 5, 15, 11, 9, 14, 3, 12, 13, 0}}};
+
+                    public:
+                        constexpr static const std::size_t digest_bits = DigestBits;
+                        constexpr static const std::size_t block_bits = 8 * block_bytes;
+
+                        typedef std::array<std::uint8_t, DigestBits / 8> digest_type;
+
+                        blake2b() : state(iv) {
+                            // parameter block: digest length, no key, fanout and depth 1
+                            state[0] ^= 0x01010000 ^ (DigestBits / 8);
+                        }
+
+                        template<typename InputRange>
+                        void absorb(const InputRange &in) {
+                            for (std::uint8_t byte : in) {
+                                // the last block is compressed with the final flag, so a full buffer is only
+                                // compressed once more input arrives
+                                if (position == block_bytes) {
+                                    increment_counter(block_bytes);
+                                    compress(state, buffer, counter, false);
+                                    position = 0;
+                                }
+                                buffer[position++] = byte;
+                            }
+                        }
+
+                        digest_type digest() const {
+                            state_type h = state;
+                            std::array<std::uint8_t, block_bytes> last = buffer;
+                            std::array<std::uint64_t, 2> t = counter;
+                            for (std::size_t i = position; i < block_bytes; ++i) {
+                                last[i] = 0;
+                            }
+                            t[0] += position;
+                            t[1] += t[0] < position;
+                            compress(h, last, t, true);
+
+                            digest_type result;
+                            for (std::size_t i = 0; i < result.size(); ++i) {
+                                result[i] = static_cast<std::uint8_t>(h[i / 8] >> (8 * (i % 8)));
+                            }
+                            return result;
+                        }
+
+                    private:
+                        static std::uint64_t rotr(std::uint64_t x, unsigned n) {
+                            return (x >> n) | (x << (64 - n));
+                        }
+
+                        static void mix(std::array<std::uint64_t, 16> &v, std::size_t a, std::size_t b, std::size_t c,
+                                        std::size_t d, std::uint64_t x, std::uint64_t y) {
+                            v[a] = v[a] + v[b] + x;
+                            v[d] = rotr(v[d] ^ v[a], 32);
+                            v[c] = v[c] + v[d];
+                            v[b] = rotr(v[b] ^ v[c], 24);
+                            v[a] = v[a] + v[b] + y;
+                            v[d] = rotr(v[d] ^ v[a], 16);
+                            v[c] = v[c] + v[d];
+                            v[b] = rotr(v[b] ^ v[c], 63);
+                        }
+
+                        static void compress(state_type &h, const std::array<std::uint8_t, block_bytes> &block,
+                                             const std::array<std::uint64_t, 2> &t, bool last) {
+                            std::array<std::uint64_t, 16> m {};
+                            for (std::size_t i = 0; i < block_bytes; ++i) {
+                                m[i / 8] |= std::uint64_t(block[i]) << (8 * (i % 8));
+                            }
+
+                            std::array<std::uint64_t, 16> v;
+                            for (std::size_t i = 0; i < 8; ++i) {
+                                v[i] = h[i];
+                                v[i + 8] = iv[i];
+                            }
+                            v[12] ^= t[0];
+                            v[13] ^= t[1];
+                            if (last) {
+                                v[14] = ~v[14];
+                            }
+
+                            for (std::size_t round = 0; round < 12; ++round) {
+                                const std::array<std::uint8_t, 16> &s = sigma[round % 10];
+                                mix(v, 0, 4, 8, 12, m[s[0]], m[s[1]]);
+                                mix(v, 1, 5, 9, 13, m[s[2]], m[s[3]]);
+                                mix(v, 2, 6, 10, 14, m[s[4]], m[s[5]]);
+                                mix(v, 3, 7, 11, 15, m[s[6]], m[s[7]]);
+                                mix(v, 0, 5, 10, 15, m[s[8]], m[s[9]]);
+                                mix(v, 1, 6, 11, 12, m[s[10]], m[s[11]]);
+                                mix(v, 2, 7, 8, 13, m[s[12]], m[s[13]]);
+                                mix(v, 3, 4, 9, 14, m[s[14]], m[s[15]]);
+                            }
+
+                            for (std::size_t i = 0; i < 8; ++i) {
+                                h[i] ^= v[i] ^ v[i + 8];
+                            }
+                        }
+
+                        void increment_counter(std::size_t n) {
+                            counter[0] += n;
+                            counter[1] += counter[0] < n;
+                        }
+
+                        state_type state;
+                        std::array<std::uint8_t, block_bytes> buffer {};
+                        std::array<std::uint64_t, 2> counter {};
+                        std::size_t position = 0;
+                    };
+
+                    template<std::size_t DigestBits>
+                    constexpr std::size_t const blake2b<DigestBits>::block_bytes;
+
+                    template<std::size_t DigestBits>
+                    constexpr typename blake2b<DigestBits>::state_type const blake2b<DigestBits>::iv;
+
+                    template<std::size_t DigestBits>
+                    constexpr std::array<std::array<std::uint8_t, 16>, 10> const blake2b<DigestBits>::sigma;
+
+                    template<std::size_t DigestBits>
+                    constexpr std::size_t const blake2b<DigestBits>::digest_bits;
+
+                    template<std::size_t DigestBits>
+                    constexpr std::size_t const blake2b<DigestBits>::block_bits;
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_CURVES_HASH_TO_CURVE_BLAKE2B_HPP
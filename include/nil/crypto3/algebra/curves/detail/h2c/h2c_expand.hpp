@@ -28,10 +28,14 @@
 
 #include <nil/crypto3/algebra/curves/detail/h2c/h2c_suites.hpp>
 #include <nil/crypto3/algebra/curves/detail/h2c/h2c_sgn0.hpp>
+#include <nil/crypto3/algebra/curves/detail/h2c/h2c_shake.hpp>
+#include <nil/crypto3/algebra/curves/detail/h2c/h2c_blake2b.hpp>
 
 #include <nil/crypto3/algebra/algorithms/strxor.hpp>
 
 #include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <nil/crypto3/algebra/curves/vesta.hpp>
 
 #include <nil/crypto3/hash/algorithm/hash.hpp>
 #include <nil/crypto3/hash/accumulators/hash.hpp>
@@ -40,6 +44,7 @@
 #include <boost/static_assert.hpp>
 #include <boost/concept/assert.hpp>
 
+#include <algorithm>
 #include <array>
 #include <type_traits>
 #include <iterator>
@@ -94,68 +99,204 @@ namespace nil {
                             // https://tools.ietf.org/html/draft-irtf-cfrg-hash-to-curve-10#section-5.4.1
                             BOOST_ASSERT(ell <= 255);
 
-                            // TODO: use accumulators when they will be fixed
-                            // accumulator_set<HashType> b0_acc;
-                            // hash<HashType>(Z_pad, b0_acc);
-                            // hash<HashType>(msg, b0_acc);
-                            // hash<HashType>(l_i_b_str, b0_acc);
-                            // hash<HashType>(std::array<std::uint8_t, 1> {0}, b0_acc);
-                            // hash<HashType>(dst, b0_acc);
-                            // hash<HashType>(std::array<std::uint8_t, 1> {static_cast<std::uint8_t>(dst.size())},
-                            // b0_acc); typename HashType::digest_type b0 =
-                            // accumulators::extract::hash<HashType>(b0_acc);
-                            std::vector<std::uint8_t> msg_prime;
-                            msg_prime.insert(msg_prime.end(), Z_pad.begin(), Z_pad.end());
-                            msg_prime.insert(msg_prime.end(), msg.begin(), msg.end());
-                            msg_prime.insert(msg_prime.end(), l_i_b_str.begin(), l_i_b_str.end());
-                            msg_prime.insert(msg_prime.end(), static_cast<std::uint8_t>(0));
-                            msg_prime.insert(msg_prime.end(), dst.begin(), dst.end());
-                            msg_prime.insert(msg_prime.end(),
-                                             static_cast<std::uint8_t>(std::distance(dst.begin(), dst.end())));
-                            typename HashType::digest_type b0 = hash<HashType>(msg_prime);
-
-                            // TODO: use accumulators when they will be fixed
-                            // accumulator_set<HashType> bi_acc;
-                            // hash<HashType>(b0, bi_acc);
-                            // hash<HashType>(std::array<std::uint8_t, 1> {1}, bi_acc);
-                            // hash<HashType>(dst, bi_acc);
-                            // hash<HashType>(std::array<std::uint8_t, 1> {static_cast<std::uint8_t>(dst.size())},
-                            // bi_acc); typename HashType::digest_type bi =
-                            // accumulators::extract::hash<HashType>(bi_acc); std::copy(bi.begin(), bi.end(),
-                            // uniform_bytes.begin());
-                            std::vector<std::uint8_t> b_i_str;
-                            b_i_str.insert(b_i_str.end(), b0.begin(), b0.end());
-                            b_i_str.insert(b_i_str.end(), static_cast<std::uint8_t>(1));
-                            b_i_str.insert(b_i_str.end(), dst.begin(), dst.end());
-                            b_i_str.insert(b_i_str.end(),
-                                           static_cast<std::uint8_t>(std::distance(dst.begin(), dst.end())));
-                            typename HashType::digest_type bi = hash<HashType>(b_i_str);
-                            std::copy(bi.begin(), bi.end(), uniform_bytes.begin());
+                            const std::array<std::uint8_t, 1> dst_size = {
+                                static_cast<std::uint8_t>(std::distance(dst.begin(), dst.end()))};
 
+                            // b_0 = H(Z_pad || msg || l_i_b_str || I2OSP(0, 1) || DST_prime), resumed from the
+                            // cached state after the Z_pad block so msg is absorbed in place
+                            accumulator_set<HashType> b0_acc = z_pad_state();
+                            hash<HashType>(msg, b0_acc);
+                            hash<HashType>(l_i_b_str, b0_acc);
+                            hash<HashType>(std::array<std::uint8_t, 1> {0}, b0_acc);
+                            hash<HashType>(dst, b0_acc);
+                            hash<HashType>(dst_size, b0_acc);
+                            const typename HashType::digest_type b0 = accumulators::extract::hash<HashType>(b0_acc);
+
+                            // b_1 = H(b_0 || I2OSP(1, 1) || DST_prime)
+                            accumulator_set<HashType> b1_acc;
+                            hash<HashType>(b0, b1_acc);
+                            hash<HashType>(std::array<std::uint8_t, 1> {1}, b1_acc);
+                            hash<HashType>(dst, b1_acc);
+                            hash<HashType>(dst_size, b1_acc);
+                            typename HashType::digest_type bi = accumulators::extract::hash<HashType>(b1_acc);
+                            std::copy(bi.begin(), bi.begin() + std::min(b_in_bytes, len_in_bytes),
+                                      uniform_bytes.begin());
+
+                            // b_i = H(strxor(b_0, b_(i - 1)) || I2OSP(i, 1) || DST_prime)
+                            typename HashType::digest_type xored_b;
+                            for (std::size_t i = 2; i <= ell; i++) {
+                                strxor(b0, bi, xored_b);
+
+                                accumulator_set<HashType> bi_acc;
+                                hash<HashType>(xored_b, bi_acc);
+                                hash<HashType>(std::array<std::uint8_t, 1> {static_cast<std::uint8_t>(i)}, bi_acc);
+                                hash<HashType>(dst, bi_acc);
+                                hash<HashType>(dst_size, bi_acc);
+                                bi = accumulators::extract::hash<HashType>(bi_acc);
+
+                                const std::size_t offset = (i - 1) * b_in_bytes;
+                                std::copy(bi.begin(), bi.begin() + std::min(b_in_bytes, len_in_bytes - offset),
+                                          uniform_bytes.begin() + offset);
+                            }
+                        }
+
+                    private:
+                        /// Hash state after absorbing the constant Z_pad block, built once and copied per call
+                        static const accumulator_set<HashType> &z_pad_state() {
+                            static const accumulator_set<HashType> state = []() {
+                                accumulator_set<HashType> acc;
+                                hash<HashType>(Z_pad, acc);
+                                return acc;
+                            }();
+                            return state;
+                        }
+                    };
+
+                    /*!
+                     * @brief expand_message_xof for suites built on an extendable-output function.
+                     * XofType follows the interface of detail::shake: absorb() a byte range, then squeeze() any
+                     * number of output bytes, and security_bits gives its collision resistance.
+                     */
+                    template<std::size_t k, typename XofType>
+                    class expand_message_xof {
+                        // https://tools.ietf.org/html/draft-irtf-cfrg-hash-to-curve-10#section-5.4.2
+                        BOOST_STATIC_ASSERT_MSG(XofType::security_bits >= k,
+                                                "k-bit collision resistance is not fulfilled");
+
+                    public:
+                        template<typename InputMsgType, typename InputDstType, typename OutputType,
+                                 typename = typename std::enable_if<
+                                     std::is_same<std::uint8_t, typename InputMsgType::value_type>::value &&
+                                     std::is_same<std::uint8_t, typename InputDstType::value_type>::value &&
+                                     std::is_same<std::uint8_t, typename OutputType::value_type>::value>::type>
+                        static inline void process(const std::size_t len_in_bytes, const InputMsgType &msg,
+                                                   const InputDstType &dst, OutputType &uniform_bytes) {
+                            BOOST_CONCEPT_ASSERT((boost::SinglePassRangeConcept<InputMsgType>));
+                            BOOST_CONCEPT_ASSERT((boost::SinglePassRangeConcept<InputDstType>));
+                            BOOST_CONCEPT_ASSERT((boost::SinglePassRangeConcept<OutputType>));
+                            BOOST_CONCEPT_ASSERT((boost::WriteableRangeConcept<OutputType>));
+
+                            // https://tools.ietf.org/html/draft-irtf-cfrg-hash-to-curve-10#section-5.4.2
+                            BOOST_ASSERT(len_in_bytes < 0x10000);
+                            BOOST_ASSERT(std::distance(dst.begin(), dst.end()) >= 16 &&
+                                         std::distance(dst.begin(), dst.end()) <= 255);
+                            BOOST_ASSERT(std::distance(uniform_bytes.begin(), uniform_bytes.end()) >= len_in_bytes);
+
+                            const std::array<std::uint8_t, 2> l_i_b_str = {
+                                static_cast<std::uint8_t>(len_in_bytes >> 8u),
+                                static_cast<std::uint8_t>(len_in_bytes % 0x100)};
+                            const std::array<std::uint8_t, 1> dst_size = {
+                                static_cast<std::uint8_t>(std::distance(dst.begin(), dst.end()))};
+
+                            // uniform_bytes = H(msg || I2OSP(len_in_bytes, 2) || DST_prime, len_in_bytes)
+                            XofType xof;
+                            xof.absorb(msg);
+                            xof.absorb(l_i_b_str);
+                            xof.absorb(dst);
+                            xof.absorb(dst_size);
+                            xof.squeeze(uniform_bytes.begin(), len_in_bytes);
+                        }
+                    };
+                    /*!
+                     * @brief expand_message_xmd as implemented by Halo2 (pasta_curves): the Z_pad prefix of b_0 is
+                     * b_in_bytes long instead of a full r_in_bytes block, and DST may be shorter than 16 bytes.
+                     * HashType follows the interface of detail::blake2b: absorb() a byte range, then digest().
+                     */
+                    template<std::size_t k, typename HashType>
+                    class expand_message_xmd_halo2 {
+                        BOOST_STATIC_ASSERT_MSG(HashType::digest_bits % 8 == 0, "b_in_bytes is not a multiple of 8");
+                        BOOST_STATIC_ASSERT_MSG(HashType::digest_bits >= 2 * k,
+                                                "k-bit collision resistance is not fulfilled");
+
+                        constexpr static const std::size_t b_in_bytes = HashType::digest_bits / 8;
+
+                        constexpr static const std::array<std::uint8_t, b_in_bytes> Z_pad {0};
+
+                    public:
+                        template<typename InputMsgType, typename InputDstType, typename OutputType,
+                                 typename = typename std::enable_if<
+                                     std::is_same<std::uint8_t, typename InputMsgType::value_type>::value &&
+                                     std::is_same<std::uint8_t, typename InputDstType::value_type>::value &&
+                                     std::is_same<std::uint8_t, typename OutputType::value_type>::value>::type>
+                        static inline void process(const std::size_t len_in_bytes, const InputMsgType &msg,
+                                                   const InputDstType &dst, OutputType &uniform_bytes) {
+                            BOOST_CONCEPT_ASSERT((boost::SinglePassRangeConcept<InputMsgType>));
+                            BOOST_CONCEPT_ASSERT((boost::SinglePassRangeConcept<InputDstType>));
+                            BOOST_CONCEPT_ASSERT((boost::SinglePassRangeConcept<OutputType>));
+                            BOOST_CONCEPT_ASSERT((boost::WriteableRangeConcept<OutputType>));
+
+                            BOOST_ASSERT(len_in_bytes < 0x10000);
+                            BOOST_ASSERT(std::distance(dst.begin(), dst.end()) <= 255);
+                            BOOST_ASSERT(std::distance(uniform_bytes.begin(), uniform_bytes.end()) >= len_in_bytes);
+
+                            const std::array<std::uint8_t, 2> l_i_b_str = {
+                                static_cast<std::uint8_t>(len_in_bytes >> 8u),
+                                static_cast<std::uint8_t>(len_in_bytes % 0x100)};
+                            const std::size_t ell = static_cast<std::size_t>(len_in_bytes / b_in_bytes) +
+                                                    static_cast<std::size_t>(len_in_bytes % b_in_bytes != 0);
+                            BOOST_ASSERT(ell <= 255);
+
+                            const std::array<std::uint8_t, 1> dst_size = {
+                                static_cast<std::uint8_t>(std::distance(dst.begin(), dst.end()))};
+
+                            // b_0 = H(Z_pad || msg || l_i_b_str || I2OSP(0, 1) || DST_prime)
+                            HashType b0_hash;
+                            b0_hash.absorb(Z_pad);
+                            b0_hash.absorb(msg);
+                            b0_hash.absorb(l_i_b_str);
+                            b0_hash.absorb(std::array<std::uint8_t, 1> {0});
+                            b0_hash.absorb(dst);
+                            b0_hash.absorb(dst_size);
+                            const typename HashType::digest_type b0 = b0_hash.digest();
+
+                            // b_1 = H(b_0 || I2OSP(1, 1) || DST_prime)
+                            HashType b1_hash;
+                            b1_hash.absorb(b0);
+                            b1_hash.absorb(std::array<std::uint8_t, 1> {1});
+                            b1_hash.absorb(dst);
+                            b1_hash.absorb(dst_size);
+                            typename HashType::digest_type bi = b1_hash.digest();
+                            std::copy(bi.begin(), bi.begin() + std::min(b_in_bytes, len_in_bytes),
+                                      uniform_bytes.begin());
+
+                            // b_i = H(strxor(b_0, b_(i - 1)) || I2OSP(i, 1) || DST_prime)
                             typename HashType::digest_type xored_b;
                             for (std::size_t i = 2; i <= ell; i++) {
-                                // TODO: use accumulators when they will be fixed
-                                // accumulator_set<HashType> bi_acc;
-                                // strxor(b0, bi, xored_b);
-                                // hash<HashType>(xored_b, bi_acc);
-                                // hash<HashType>(std::array<std::uint8_t, 1> {static_cast<std::uint8_t>(i)}, bi_acc);
-                                // hash<HashType>(dst, bi_acc);
-                                // hash<HashType>(std::array<std::uint8_t, 1> {static_cast<std::uint8_t>(dst.size())},
-                                //                bi_acc);
-                                // bi = accumulators::extract::hash<HashType>(bi_acc);
-                                // std::copy(bi.begin(), bi.end(), uniform_bytes.begin() + (i - 1) * b_in_bytes);
                                 strxor(b0, bi, xored_b);
-                                std::vector<std::uint8_t> b_i_str;
-                                b_i_str.insert(b_i_str.end(), xored_b.begin(), xored_b.end());
-                                b_i_str.insert(b_i_str.end(), static_cast<std::uint8_t>(i));
-                                b_i_str.insert(b_i_str.end(), dst.begin(), dst.end());
-                                b_i_str.insert(b_i_str.end(),
-                                               static_cast<std::uint8_t>(std::distance(dst.begin(), dst.end())));
-                                bi = hash<HashType>(b_i_str);
-                                std::copy(bi.begin(), bi.end(), uniform_bytes.begin() + (i - 1) * b_in_bytes);
+
+                                HashType bi_hash;
+                                bi_hash.absorb(xored_b);
+                                bi_hash.absorb(std::array<std::uint8_t, 1> {static_cast<std::uint8_t>(i)});
+                                bi_hash.absorb(dst);
+                                bi_hash.absorb(dst_size);
+                                bi = bi_hash.digest();
+
+                                const std::size_t offset = (i - 1) * b_in_bytes;
+                                std::copy(bi.begin(), bi.begin() + std::min(b_in_bytes, len_in_bytes - offset),
+                                          uniform_bytes.begin() + offset);
                             }
                         }
                     };
+
+                    /// expand_message of the random-oracle encoding for GroupType: expand_message_xmd over the hash
+                    /// of the suite unless the suite follows another implementation
+                    template<typename GroupType>
+                    struct h2c_expand_message_ro {
+                        typedef expand_message_xmd<h2c_suite<GroupType>::k, typename h2c_suite<GroupType>::hash_type>
+                            type;
+                    };
+
+                    template<>
+                    struct h2c_expand_message_ro<typename pallas::g1_type<>> {
+                        typedef h2c_suite<typename pallas::g1_type<>> suite_type;
+                        typedef expand_message_xmd_halo2<suite_type::k, typename suite_type::hash_type> type;
+                    };
+
+                    template<>
+                    struct h2c_expand_message_ro<typename vesta::g1_type<>> {
+                        typedef h2c_suite<typename vesta::g1_type<>> suite_type;
+                        typedef expand_message_xmd_halo2<suite_type::k, typename suite_type::hash_type> type;
+                    };
                 }    // namespace detail
             }        // namespace curves
         }            // namespace algebra
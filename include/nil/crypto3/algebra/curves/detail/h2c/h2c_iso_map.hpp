@@ -37,8 +37,46 @@ namespace nil {
         namespace algebra {
             namespace curves {
                 namespace detail {
+                    /// Isogeny map with the coefficients stored in the suite as iso_x_num, iso_x_den, iso_y_num and
+                    /// iso_y_den, lowest degree first; both denominators are monic with the leading term omitted
                     template<typename GroupType>
-                    struct iso_map;
+                    class iso_map {
+                        typedef h2c_suite<GroupType> suite_type;
+
+                        typedef typename suite_type::group_value_type group_value_type;
+                        typedef typename suite_type::field_value_type field_value_type;
+                        typedef typename suite_type::integral_type integral_type;
+
+                        template<std::size_t N>
+                        static inline field_value_type horner(const std::array<integral_type, N> &k,
+                                                              const field_value_type &x, bool monic) {
+                            field_value_type result = monic ? field_value_type::one() : field_value_type::zero();
+                            for (std::size_t i = N; i-- > 0;) {
+                                result = result * x + field_value_type(k[i]);
+                            }
+                            return result;
+                        }
+
+                    public:
+                        /// Evaluates the numerators and denominators of the rational maps at x
+                        static inline void evaluate(const field_value_type &x, field_value_type &x_num,
+                                                    field_value_type &x_den, field_value_type &y_num,
+                                                    field_value_type &y_den) {
+                            x_num = horner(suite_type::iso_x_num, x, false);
+                            x_den = horner(suite_type::iso_x_den, x, true);
+                            y_num = horner(suite_type::iso_y_num, x, false);
+                            y_den = horner(suite_type::iso_y_den, x, true);
+                        }
+
+                        static inline group_value_type process(const group_value_type &ci) {
+                            field_value_type x_num, x_den, y_num, y_den;
+                            evaluate(ci.X, x_num, x_den, y_num, y_den);
+                            if (x_den.is_zero() || y_den.is_zero()) {
+                                return group_value_type::zero();
+                            }
+                            return group_value_type(x_num / x_den, ci.Y * y_num / y_den, field_value_type::one());
+                        }
+                    };
 
                     // 11-isogeny map for BLS12-381 G1
                     // https://tools.ietf.org/html/draft-irtf-cfrg-hash-to-curve-10#appendix-E.2
@@ -114,16 +152,19 @@ namespace nil {
                             0xe0fa1d816ddc03e6b24255e0d7819c171c40f65e273b853324efcd6356caa205ca2f570f13497804415473a1d634b8f_cppui381};
 
                     public:
-                        static inline group_value_type process(const group_value_type &ci) {
-                            field_value_type x_num = field_value_type::zero();
-                            field_value_type x_den = field_value_type::zero();
-                            field_value_type y_num = field_value_type::zero();
-                            field_value_type y_den = field_value_type::zero();
-
-                            std::vector<field_value_type> xi_powers = [&ci]() {
+                        /// Evaluates the numerators and denominators of the rational maps at x
+                        static inline void evaluate(const field_value_type &x, field_value_type &x_num,
+                                                    field_value_type &x_den, field_value_type &y_num,
+                                                    field_value_type &y_den) {
+                            x_num = field_value_type::zero();
+                            x_den = field_value_type::zero();
+                            y_num = field_value_type::zero();
+                            y_den = field_value_type::zero();
+
+                            std::vector<field_value_type> xi_powers = [&x]() {
                                 std::vector<field_value_type> xi_powers {field_value_type::one()};
                                 for (std::size_t i = 0; i < 15; i++) {
-                                    xi_powers.emplace_back(xi_powers.back() * ci.X);
+                                    xi_powers.emplace_back(xi_powers.back() * x);
                                 }
                                 return xi_powers;
                             }();
@@ -138,10 +179,6 @@ namespace nil {
                             }
                             y_den += xi_powers[k_y_den.size()];
 
-                            if (x_den.is_zero() || y_den.is_zero()) {
-                                return group_value_type::one();
-                            }
-
                             for (std::size_t i = 0; i < k_x_num.size(); i++) {
                                 x_num += field_value_type(k_x_num[i]) * xi_powers[i];
                             }
@@ -149,7 +186,14 @@ namespace nil {
                             for (std::size_t i = 0; i < k_y_num.size(); i++) {
                                 y_num += field_value_type(k_y_num[i]) * xi_powers[i];
                             }
+                        }
 
+                        static inline group_value_type process(const group_value_type &ci) {
+                            field_value_type x_num, x_den, y_num, y_den;
+                            evaluate(ci.X, x_num, x_den, y_num, y_den);
+                            if (x_den.is_zero() || y_den.is_zero()) {
+                                return group_value_type::zero();
+                            }
                             return group_value_type(x_num / x_den, ci.Y * y_num / y_den, field_value_type::one());
                         }
                     };
@@ -201,17 +245,19 @@ namespace nil {
                                0x1a0111ea397fe69a4b1ba7b6434bacd764774b84f38512bf6730d2a0f6b0f6241eabfffeb153ffffb9feffffffffaa99_cppui381}}}};
 
                     public:
-                        static inline group_value_type process(const group_value_type &ci) {
-                            field_value_type x_num = field_value_type::zero();
-                            field_value_type x_den = field_value_type::zero();
-                            field_value_type y_num = field_value_type::zero();
-                            field_value_type y_den = field_value_type::zero();
-
-                            std::vector<field_value_type> xi_powers = [&ci]() {
+                        /// Evaluates the numerators and denominators of the rational maps at x
+                        static inline void evaluate(const field_value_type &x, field_value_type &x_num,
+                                                    field_value_type &x_den, field_value_type &y_num,
+                                                    field_value_type &y_den) {
+                            x_num = field_value_type::zero();
+                            x_den = field_value_type::zero();
+                            y_num = field_value_type::zero();
+                            y_den = field_value_type::zero();
+
+                            std::vector<field_value_type> xi_powers = [&x]() {
                                 std::vector<field_value_type> xi_powers {field_value_type::one()};
                                 for (std::size_t i = 0; i < 3; i++) {
-                                    auto v = xi_powers.back();
-                                    xi_powers.emplace_back(xi_powers.back() * ci.X);
+                                    xi_powers.emplace_back(xi_powers.back() * x);
                                 }
                                 return xi_powers;
                             }();
@@ -226,10 +272,6 @@ namespace nil {
                             }
                             y_den += xi_powers[k_y_den.size()];
 
-                            if (x_den.is_zero() || y_den.is_zero()) {
-                                return group_value_type::one();
-                            }
-
                             for (std::size_t i = 0; i < k_x_num.size(); i++) {
                                 x_num += field_value_type(k_x_num[i][0], k_x_num[i][1]) * xi_powers[i];
                             }
@@ -237,7 +279,14 @@ namespace nil {
                             for (std::size_t i = 0; i < k_y_num.size(); i++) {
                                 y_num += field_value_type(k_y_num[i][0], k_y_num[i][1]) * xi_powers[i];
                             }
+                        }
 
+                        static inline group_value_type process(const group_value_type &ci) {
+                            field_value_type x_num, x_den, y_num, y_den;
+                            evaluate(ci.X, x_num, x_den, y_num, y_den);
+                            if (x_den.is_zero() || y_den.is_zero()) {
+                                return group_value_type::zero();
+                            }
                             return group_value_type(x_num / x_den, ci.Y * y_num / y_den, field_value_type::one());
                         }
                     };
@@ -30,13 +30,42 @@
 #include <nil/crypto3/algebra/curves/detail/h2c/h2c_iso_map.hpp>
 #include <nil/crypto3/algebra/curves/detail/h2c/h2c_sgn0.hpp>
 
+#include <nil/crypto3/algebra/fields/detail/batch_inverse.hpp>
+
+#include <nil/crypto3/algebra/curves/alt_bn128.hpp>
 #include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/curves/curve25519.hpp>
+#include <nil/crypto3/algebra/curves/ed25519.hpp>
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <nil/crypto3/algebra/curves/secp_k1.hpp>
+#include <nil/crypto3/algebra/curves/vesta.hpp>
+
+#include <vector>
 
 namespace nil {
     namespace crypto3 {
         namespace algebra {
             namespace curves {
                 namespace detail {
+                    /// inv0 of every element with one shared inversion: zeros are left as zeros, which is what the
+                    /// exceptional cases of the mappings expect
+                    template<typename FieldValueType>
+                    inline void batch_inv0(std::vector<FieldValueType> &values) {
+                        std::vector<bool> is_zero(values.size());
+                        for (std::size_t i = 0; i < values.size(); i++) {
+                            is_zero[i] = values[i].is_zero();
+                            if (is_zero[i]) {
+                                values[i] = FieldValueType::one();
+                            }
+                        }
+                        fields::detail::batch_inverse(values);
+                        for (std::size_t i = 0; i < values.size(); i++) {
+                            if (is_zero[i]) {
+                                values[i] = FieldValueType::zero();
+                            }
+                        }
+                    }
+
                     template<typename GroupType>
                     struct m2c_simple_swu {
                         typedef h2c_suite<GroupType> suite_type;
@@ -45,6 +74,33 @@ namespace nil {
                         typedef typename suite_type::field_value_type field_value_type;
 
                         static inline group_value_type process(const field_value_type &u) {
+                            return map(u, denominator(u).inversed());
+                        }
+
+                        /// Maps every element of us, sharing a single field inversion across the batch
+                        static inline std::vector<group_value_type>
+                            process_batch(const std::vector<field_value_type> &us) {
+                            std::vector<field_value_type> tv1(us.size());
+                            for (std::size_t i = 0; i < us.size(); i++) {
+                                tv1[i] = denominator(us[i]);
+                            }
+                            batch_inv0(tv1);
+
+                            std::vector<group_value_type> result;
+                            result.reserve(us.size());
+                            for (std::size_t i = 0; i < us.size(); i++) {
+                                result.emplace_back(map(us[i], tv1[i]));
+                            }
+                            return result;
+                        }
+
+                    private:
+                        static inline field_value_type denominator(const field_value_type &u) {
+                            return suite_type::Z.pow(2) * u.pow(4) + suite_type::Z * u.pow(2);
+                        }
+
+                        // tv1 = inv0(Z^2 * u^4 + Z * u^2)
+                        static inline group_value_type map(const field_value_type &u, const field_value_type &tv1) {
                             // TODO: We assume that Z meets the following criteria -- correct for predefined suites,
                             //  but wrong in general case
                             // https://tools.ietf.org/html/draft-irtf-cfrg-hash-to-curve-10#section-6.6.2
@@ -55,8 +111,6 @@ namespace nil {
                             // 4.  g(B / (Z * A)) is square in F.
                             static const field_value_type one = field_value_type::one();
 
-                            field_value_type tv1 =
-                                (suite_type::Z.pow(2) * u.pow(4) + suite_type::Z * u.pow(2)).inversed();
                             field_value_type x1 = (-suite_type::Bi / suite_type::Ai) * (one + tv1);
                             if (tv1.is_zero()) {
                                 x1 = suite_type::Bi / (suite_type::Z * suite_type::Ai);
@@ -90,6 +144,230 @@ namespace nil {
                             group_value_type ci = m2c_simple_swu<GroupType>::process(u);
                             return iso_map<GroupType>::process(ci);
                         }
+
+                        /// Batched SSWU followed by the batched isogeny: two field inversions for the whole batch
+                        static inline std::vector<group_value_type>
+                            process_batch(const std::vector<field_value_type> &us) {
+                            std::vector<group_value_type> result = m2c_simple_swu<GroupType>::process_batch(us);
+
+                            std::vector<field_value_type> x_num(us.size()), x_den(us.size()), y_num(us.size()),
+                                y_den(us.size()), den_inversed(us.size());
+                            for (std::size_t i = 0; i < us.size(); i++) {
+                                iso_map<GroupType>::evaluate(result[i].X, x_num[i], x_den[i], y_num[i], y_den[i]);
+                                den_inversed[i] = x_den[i] * y_den[i];
+                            }
+                            batch_inv0(den_inversed);
+
+                            for (std::size_t i = 0; i < us.size(); i++) {
+                                if (den_inversed[i].is_zero()) {
+                                    result[i] = group_value_type::zero();
+                                    continue;
+                                }
+                                result[i] = group_value_type(x_num[i] * y_den[i] * den_inversed[i],
+                                                             result[i].Y * y_num[i] * x_den[i] * den_inversed[i],
+                                                             field_value_type::one());
+                            }
+                            return result;
+                        }
+                    };
+
+                    /// Shallue-van de Woestijne method for curves where neither SSWU nor Elligator 2 applies
+                    /// https://datatracker.ietf.org/doc/html/rfc9380#section-6.6.1
+                    template<typename GroupType>
+                    struct m2c_svdw {
+                        typedef h2c_suite<GroupType> suite_type;
+
+                        typedef typename suite_type::group_value_type group_value_type;
+                        typedef typename suite_type::field_value_type field_value_type;
+
+                        static inline group_value_type process(const field_value_type &u) {
+                            field_value_type tv1, tv2;
+                            denominator(u, tv1, tv2);
+                            return map(u, tv1, tv2, (tv1 * tv2).inversed());
+                        }
+
+                        /// Maps every element of us, sharing a single field inversion across the batch
+                        static inline std::vector<group_value_type>
+                            process_batch(const std::vector<field_value_type> &us) {
+                            std::vector<field_value_type> tv1(us.size()), tv2(us.size()), tv3(us.size());
+                            for (std::size_t i = 0; i < us.size(); i++) {
+                                denominator(us[i], tv1[i], tv2[i]);
+                                tv3[i] = tv1[i] * tv2[i];
+                            }
+                            batch_inv0(tv3);
+
+                            std::vector<group_value_type> result;
+                            result.reserve(us.size());
+                            for (std::size_t i = 0; i < us.size(); i++) {
+                                result.emplace_back(map(us[i], tv1[i], tv2[i], tv3[i]));
+                            }
+                            return result;
+                        }
+
+                    private:
+                        static inline field_value_type g(const field_value_type &x) {
+                            return (x.squared() + suite_type::A) * x + suite_type::B;
+                        }
+
+                        // tv1 = 1 - c1 * u^2, tv2 = 1 + c1 * u^2
+                        static inline void denominator(const field_value_type &u, field_value_type &tv1,
+                                                       field_value_type &tv2) {
+                            const field_value_type c1u2 = suite_type::c1 * u.squared();
+                            tv1 = field_value_type::one() - c1u2;
+                            tv2 = field_value_type::one() + c1u2;
+                        }
+
+                        // tv3 = inv0(tv1 * tv2)
+                        static inline group_value_type map(const field_value_type &u, const field_value_type &tv1,
+                                                           const field_value_type &tv2, const field_value_type &tv3) {
+                            const field_value_type tv4 = u * tv1 * tv3 * suite_type::c3;
+
+                            const field_value_type x1 = suite_type::c2 - tv4;
+                            const field_value_type x2 = suite_type::c2 + tv4;
+
+                            field_value_type x = x1;
+                            field_value_type gx = g(x1);
+                            if (!gx.is_square()) {
+                                x = x2;
+                                gx = g(x2);
+                                if (!gx.is_square()) {
+                                    x = (tv2.squared() * tv3).squared() * suite_type::c4 + suite_type::Z;
+                                    gx = g(x);
+                                }
+                            }
+
+                            field_value_type y = gx.sqrt();
+                            if (sgn0(u) != sgn0(y)) {
+                                y = -y;
+                            }
+                            return group_value_type(x, y, field_value_type::one());
+                        }
+                    };
+
+                    /// Elligator 2 onto the Montgomery curve K * t^2 = s^3 + J * s^2 + s
+                    /// https://datatracker.ietf.org/doc/html/rfc9380#section-6.7.1
+                    template<typename GroupType>
+                    struct m2c_elligator2 {
+                        typedef h2c_suite<GroupType> suite_type;
+
+                        typedef typename suite_type::group_value_type group_value_type;
+                        typedef typename suite_type::field_value_type field_value_type;
+
+                        static inline group_value_type process(const field_value_type &u) {
+                            field_value_type s, t;
+                            map(u, denominator(u).inversed(), s, t);
+                            return group_value_type(s, t);
+                        }
+
+                        /// Maps every element of us, sharing a single field inversion across the batch
+                        static inline std::vector<group_value_type>
+                            process_batch(const std::vector<field_value_type> &us) {
+                            std::vector<field_value_type> tv1(us.size());
+                            for (std::size_t i = 0; i < us.size(); i++) {
+                                tv1[i] = denominator(us[i]);
+                            }
+                            batch_inv0(tv1);
+
+                            std::vector<group_value_type> result;
+                            result.reserve(us.size());
+                            field_value_type s, t;
+                            for (std::size_t i = 0; i < us.size(); i++) {
+                                map(us[i], tv1[i], s, t);
+                                result.emplace_back(s, t);
+                            }
+                            return result;
+                        }
+
+                        static inline field_value_type denominator(const field_value_type &u) {
+                            return field_value_type::one() + suite_type::Z * u.squared();
+                        }
+
+                        // tv1 = inv0(1 + Z * u^2), (s, t) is the resulting point of the Montgomery curve
+                        static inline void map(const field_value_type &u, const field_value_type &tv1,
+                                               field_value_type &s, field_value_type &t) {
+                            static const field_value_type J_over_K = suite_type::J / suite_type::K;
+                            static const field_value_type K_squared_inversed = suite_type::K.squared().inversed();
+
+                            field_value_type x1 = -J_over_K * tv1;
+                            if (x1.is_zero()) {
+                                x1 = -J_over_K;
+                            }
+                            const field_value_type gx1 = ((x1 + J_over_K) * x1 + K_squared_inversed) * x1;
+
+                            field_value_type x, y;
+                            if (gx1.is_square()) {
+                                x = x1;
+                                y = gx1.sqrt();
+                                if (!sgn0(y)) {
+                                    y = -y;
+                                }
+                            } else {
+                                x = -x1 - J_over_K;
+                                y = (((x + J_over_K) * x + K_squared_inversed) * x).sqrt();
+                                if (sgn0(y)) {
+                                    y = -y;
+                                }
+                            }
+
+                            s = x * suite_type::K;
+                            t = y * suite_type::K;
+                        }
+                    };
+
+                    /// Elligator 2 onto curve25519 followed by the birational map to edwards25519
+                    /// https://datatracker.ietf.org/doc/html/rfc9380#appendix-D.1
+                    template<typename GroupType>
+                    struct m2c_elligator2_edwards {
+                        typedef h2c_suite<GroupType> suite_type;
+                        typedef m2c_elligator2<GroupType> montgomery_map_type;
+
+                        typedef typename suite_type::group_value_type group_value_type;
+                        typedef typename suite_type::field_value_type field_value_type;
+
+                        static inline group_value_type process(const field_value_type &u) {
+                            field_value_type s, t;
+                            montgomery_map_type::map(u, montgomery_map_type::denominator(u).inversed(), s, t);
+                            return to_edwards(s, t, (t * (s + field_value_type::one())).inversed());
+                        }
+
+                        /// Maps every element of us with two field inversions for the whole batch: one for
+                        /// Elligator 2 and one for the birational map
+                        static inline std::vector<group_value_type>
+                            process_batch(const std::vector<field_value_type> &us) {
+                            std::vector<field_value_type> tv1(us.size());
+                            for (std::size_t i = 0; i < us.size(); i++) {
+                                tv1[i] = montgomery_map_type::denominator(us[i]);
+                            }
+                            batch_inv0(tv1);
+
+                            std::vector<field_value_type> s(us.size()), t(us.size()), den_inversed(us.size());
+                            for (std::size_t i = 0; i < us.size(); i++) {
+                                montgomery_map_type::map(us[i], tv1[i], s[i], t[i]);
+                                den_inversed[i] = t[i] * (s[i] + field_value_type::one());
+                            }
+                            batch_inv0(den_inversed);
+
+                            std::vector<group_value_type> result;
+                            result.reserve(us.size());
+                            for (std::size_t i = 0; i < us.size(); i++) {
+                                result.emplace_back(to_edwards(s[i], t[i], den_inversed[i]));
+                            }
+                            return result;
+                        }
+
+                    private:
+                        // den_inversed = inv0(t * (s + 1)); the exceptional case maps to the identity (0, 1)
+                        static inline group_value_type to_edwards(const field_value_type &s, const field_value_type &t,
+                                                                  const field_value_type &den_inversed) {
+                            static const field_value_type one = field_value_type::one();
+
+                            if (den_inversed.is_zero()) {
+                                return group_value_type::zero();
+                            }
+                            const field_value_type v = suite_type::c1 * s * (s + one) * den_inversed;
+                            const field_value_type w = (s - one) * t * den_inversed;
+                            return group_value_type(v, w, v * w, one);
+                        }
                     };
 
                     template<typename GroupType>
@@ -102,6 +380,30 @@ namespace nil {
                     template<>
                     struct map_to_curve<typename bls12_381::g2_type<>>
                         : m2c_simple_swu_zeroAB<typename bls12_381::g2_type<>> { };
+
+                    template<>
+                    struct map_to_curve<typename alt_bn128_254::g1_type<>>
+                        : m2c_svdw<typename alt_bn128_254::g1_type<>> { };
+
+                    template<>
+                    struct map_to_curve<typename secp256k1::g1_type<>>
+                        : m2c_simple_swu_zeroAB<typename secp256k1::g1_type<>> { };
+
+                    template<>
+                    struct map_to_curve<typename pallas::g1_type<>>
+                        : m2c_simple_swu_zeroAB<typename pallas::g1_type<>> { };
+
+                    template<>
+                    struct map_to_curve<typename vesta::g1_type<>>
+                        : m2c_simple_swu_zeroAB<typename vesta::g1_type<>> { };
+
+                    template<>
+                    struct map_to_curve<typename curve25519::g1_type<coordinates::affine>>
+                        : m2c_elligator2<typename curve25519::g1_type<coordinates::affine>> { };
+
+                    template<>
+                    struct map_to_curve<typename ed25519::g1_type<>>
+                        : m2c_elligator2_edwards<typename ed25519::g1_type<>> { };
                 }    // namespace detail
             }        // namespace curves
         }            // namespace algebra
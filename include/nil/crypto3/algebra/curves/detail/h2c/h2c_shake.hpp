@@ -0,0 +1,174 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Ilias Khairullin <ilias@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_HASH_TO_CURVE_SHAKE_HPP
+#define CRYPTO3_ALGEBRA_CURVES_HASH_TO_CURVE_SHAKE_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include <boost/assert.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+                    /*!
+                     * @brief SHAKE128 / SHAKE256 (FIPS 202), the extendable-output functions behind the XOF
+                     * hash-to-curve suites. Bytes are absorbed incrementally and any number of output bytes can
+                     * be squeezed afterwards; absorbing after the first squeeze is not allowed.
+                     */
+                    template<std::size_t SecurityBits>
+                    class shake {
+                        static_assert(SecurityBits == 128 || SecurityBits == 256,
+                                      "SHAKE is defined for 128 and 256 bits of security");
+
+                        typedef std::array<std::uint64_t, 25> state_type;
+
+                        constexpr static const std::array<std::uint64_t, 24> round_constants = {
+                            0x0000000000000001, 0x0000000000008082, 0x800000000000808A, 0x8000000080008000,
+                            0x000000000000808B, 0x0000000080000001, 0x8000000080008081, 0x8000000000008009,
+                            0x000000000000008A, 0x0000000000000088, 0x0000000080008009, 0x000000008000000A,
+                            0x000000008000808B, 0x800000000000008B, 0x8000000000008089, 0x8000000000008003,
+                            0x8000000000008002, 0x8000000000000080, 0x000000000000800A, 0x800000008000000A,
+                            0x8000000080008081, 0x8000000000008080, 0x0000000080000001, 0x8000000080008008};
+                        /// rho offsets and pi destinations, in the order the combined rho-pi step visits lanes
+                        constexpr static const std::array<unsigned, 24> rotations = {
+                            1, 3, 6, 10, 15, 21, 28, 36, 45, 55, 2, 14, 27, 41, 56, 8, 25, 43, 62, 18, 39, 61, 20, 44};
+                        constexpr static const std::array<std::size_t, 24> pi_lanes = {
+                            10, 7, 11, 17, 18, 3, 5, 16, 8, 21, 24, 4, 15, 23, 19, 13, 12, 2, 20, 14, 22, 9, 6, 1};
+
+                    public:
+                        constexpr static const std::size_t security_bits = SecurityBits;
+                        constexpr static const std::size_t rate_bytes = 200 - SecurityBits / 4;
+
+                        template<typename InputRange>
+                        void absorb(const InputRange &in) {
+                            BOOST_ASSERT(!squeezing);
+
+                            for (std::uint8_t byte : in) {
+                                state[position / 8] ^= std::uint64_t(byte) << (8 * (position % 8));
+                                if (++position == rate_bytes) {
+                                    permute(state);
+                                    position = 0;
+                                }
+                            }
+                        }
+
+                        /// Writes the next n output bytes to out
+                        template<typename OutputIterator>
+                        OutputIterator squeeze(OutputIterator out, std::size_t n) {
+                            if (!squeezing) {
+                                // domain separation bits 1111 and pad10*1
+                                state[position / 8] ^= std::uint64_t(0x1F) << (8 * (position % 8));
+                                state[(rate_bytes - 1) / 8] ^= std::uint64_t(0x80) << (8 * ((rate_bytes - 1) % 8));
+                                permute(state);
+                                position = 0;
+                                squeezing = true;
+                            }
+
+                            for (; n > 0; --n) {
+                                if (position == rate_bytes) {
+                                    permute(state);
+                                    position = 0;
+                                }
+                                *out++ = static_cast<std::uint8_t>(state[position / 8] >> (8 * (position % 8)));
+                                ++position;
+                            }
+                            return out;
+                        }
+
+                    private:
+                        static std::uint64_t rotl(std::uint64_t x, unsigned n) {
+                            return (x << n) | (x >> (64 - n));
+                        }
+
+                        /// Keccak-f[1600]
+                        static void permute(state_type &a) {
+                            std::array<std::uint64_t, 5> c;
+
+                            for (std::uint64_t round_constant : round_constants) {
+                                // theta
+                                for (std::size_t i = 0; i < 5; ++i) {
+                                    c[i] = a[i] ^ a[i + 5] ^ a[i + 10] ^ a[i + 15] ^ a[i + 20];
+                                }
+                                for (std::size_t i = 0; i < 5; ++i) {
+                                    const std::uint64_t t = c[(i + 4) % 5] ^ rotl(c[(i + 1) % 5], 1);
+                                    for (std::size_t j = 0; j < 25; j += 5) {
+                                        a[j + i] ^= t;
+                                    }
+                                }
+
+                                // rho and pi
+                                std::uint64_t t = a[1];
+                                for (std::size_t i = 0; i < 24; ++i) {
+                                    const std::uint64_t next = a[pi_lanes[i]];
+                                    a[pi_lanes[i]] = rotl(t, rotations[i]);
+                                    t = next;
+                                }
+
+                                // chi
+                                for (std::size_t j = 0; j < 25; j += 5) {
+                                    for (std::size_t i = 0; i < 5; ++i) {
+                                        c[i] = a[j + i];
+                                    }
+                                    for (std::size_t i = 0; i < 5; ++i) {
+                                        a[j + i] ^= ~c[(i + 1) % 5] & c[(i + 2) % 5];
+                                    }
+                                }
+
+                                // iota
+                                a[0] ^= round_constant;
+                            }
+                        }
+
+                        state_type state {};
+                        std::size_t position = 0;
+                        bool squeezing = false;
+                    };
+
+                    template<std::size_t SecurityBits>
+                    constexpr std::array<std::uint64_t, 24> const shake<SecurityBits>::round_constants;
+
+                    template<std::size_t SecurityBits>
+                    constexpr std::array<unsigned, 24> const shake<SecurityBits>::rotations;
+
+                    template<std::size_t SecurityBits>
+                    constexpr std::array<std::size_t, 24> const shake<SecurityBits>::pi_lanes;
+
+                    template<std::size_t SecurityBits>
+                    constexpr std::size_t const shake<SecurityBits>::security_bits;
+
+                    template<std::size_t SecurityBits>
+                    constexpr std::size_t const shake<SecurityBits>::rate_bytes;
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_CURVES_HASH_TO_CURVE_SHAKE_HPP
@@ -26,11 +26,19 @@
 #ifndef CRYPTO3_ALGEBRA_CURVES_HASH_TO_CURVE_SUITES_HPP
 #define CRYPTO3_ALGEBRA_CURVES_HASH_TO_CURVE_SUITES_HPP
 
+#include <nil/crypto3/algebra/curves/alt_bn128.hpp>
 #include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/curves/curve25519.hpp>
+#include <nil/crypto3/algebra/curves/ed25519.hpp>
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <nil/crypto3/algebra/curves/secp_k1.hpp>
+#include <nil/crypto3/algebra/curves/vesta.hpp>
 
 #include <nil/crypto3/hash/algorithm/hash.hpp>
 #include <nil/crypto3/hash/sha2.hpp>
 
+#include <nil/crypto3/algebra/curves/detail/h2c/h2c_blake2b.hpp>
+
 //#include <nil/crypto3/algebra/curves/detail/h2c/h2c_utils.hpp>
 //#include <nil/crypto3/algebra/curves/detail/h2c/h2c_iso_map.hpp>
 
@@ -108,6 +116,264 @@ namespace nil {
                         constexpr static inline auto h_eff =
                             0xbc69f08f2ee75b3584c6a0ea91b352888e2a8e9145ad7689986ff031508ffe1329c2f178731db956d82bf015d1212b02ec0ec69d7477c1ae954cbc06689f6a359894c0adebbf6b4e8020005aaa95551_cppui636;
                     };
+
+                    template<>
+                    struct h2c_suite<typename alt_bn128_254::g1_type<>> {
+                        typedef alt_bn128_254 curve_type;
+                        typedef typename alt_bn128_254::g1_type<> group_type;
+                        typedef hashes::sha2<256> hash_type;
+
+                        typedef typename group_type::value_type group_value_type;
+                        typedef typename group_type::field_type::integral_type integral_type;
+                        typedef typename group_type::field_type::modular_type modular_type;
+                        typedef typename group_type::field_type::modular_backend modular_backend;
+                        typedef typename group_type::field_type::value_type field_value_type;
+
+                        // BN254G1_XMD:SHA-256_SVDW_RO_
+                        constexpr static std::array<std::uint8_t, 28> suite_id = {
+                            0x42, 0x4e, 0x32, 0x35, 0x34, 0x47, 0x31, 0x5f, 0x58, 0x4d, 0x44,
+                            0x3a, 0x53, 0x48, 0x41, 0x2d, 0x32, 0x35, 0x36, 0x5f, 0x53, 0x56,
+                            0x44, 0x57, 0x5f, 0x52, 0x4f, 0x5f};
+                        constexpr static integral_type p = curve_type::base_field_type::modulus;
+                        constexpr static std::size_t m = 1;
+                        constexpr static std::size_t k = 128;
+                        constexpr static std::size_t L = 48;
+
+                        constexpr static inline const field_value_type A = field_value_type(0);
+                        constexpr static inline const field_value_type B = field_value_type(3);
+                        constexpr static inline const field_value_type Z = field_value_type(1);
+                        // c1 = g(Z), c2 = -Z / 2, c3 = sqrt(-g(Z) * (3 * Z^2 + 4 * A)) with sgn0(c3) == 0,
+                        // c4 = -4 * g(Z) / (3 * Z^2 + 4 * A)
+                        constexpr static inline const field_value_type c1 = field_value_type(4);
+                        constexpr static inline const field_value_type c2 = field_value_type(
+                            0x183227397098d014dc2822db40c0ac2ecbc0b548b438e5469e10460b6c3e7ea3_cppui254);
+                        constexpr static inline const field_value_type c3 = field_value_type(
+                            0x16789af3a83522eb353c98fc6b36d713d5d8d1cc5dffffffa_cppui254);
+                        constexpr static inline const field_value_type c4 = field_value_type(
+                            0x10216f7ba065e00de81ac1e7808072c9dd2b2385cd7b438469602eb24829a9bd_cppui254);
+                        constexpr static integral_type h_eff = 0x01_cppui254;
+                    };
+
+                    template<>
+                    struct h2c_suite<typename secp256k1::g1_type<>> {
+                        typedef secp256k1 curve_type;
+                        typedef typename secp256k1::g1_type<> group_type;
+                        typedef hashes::sha2<256> hash_type;
+
+                        typedef typename group_type::value_type group_value_type;
+                        typedef typename group_type::field_type::integral_type integral_type;
+                        typedef typename group_type::field_type::modular_type modular_type;
+                        typedef typename group_type::field_type::modular_backend modular_backend;
+                        typedef typename group_type::field_type::value_type field_value_type;
+
+                        // secp256k1_XMD:SHA-256_SSWU_RO_
+                        constexpr static std::array<std::uint8_t, 30> suite_id = {
+                            0x73, 0x65, 0x63, 0x70, 0x32, 0x35, 0x36, 0x6b, 0x31, 0x5f, 0x58,
+                            0x4d, 0x44, 0x3a, 0x53, 0x48, 0x41, 0x2d, 0x32, 0x35, 0x36, 0x5f,
+                            0x53, 0x53, 0x57, 0x55, 0x5f, 0x52, 0x4f, 0x5f};
+                        constexpr static integral_type p = curve_type::base_field_type::modulus;
+                        constexpr static std::size_t m = 1;
+                        constexpr static std::size_t k = 128;
+                        constexpr static std::size_t L = 48;
+
+                        constexpr static inline const field_value_type Ai = field_value_type(
+                            0x3f8731abdd661adca08a5558f0f5d272e953d363cb6f0e5d405447c01a444533_cppui256);
+                        constexpr static inline const field_value_type Bi = field_value_type(1771);
+#if BOOST_COMP_GNUC
+                        constexpr static inline field_value_type Z = []() { return -field_value_type(11); }();
+#else
+                        constexpr static inline field_value_type Z = -field_value_type(11);
+#endif
+                        constexpr static integral_type h_eff = 0x01_cppui256;
+
+                        // 3-isogeny from E' to E, x_den and y_den are monic and their leading coefficient is omitted
+                        constexpr static std::array<integral_type, 4> iso_x_num = {
+                            0x8e38e38e38e38e38e38e38e38e38e38e38e38e38e38e38e38e38e38daaaaa8c7_cppui256,
+                            0x7d3d4c80bc321d5b9f315cea7fd44c5d595d2fc0bf63b92dfff1044f17c6581_cppui256,
+                            0x534c328d23f234e6e2a413deca25caece4506144037c40314ecbd0b53d9dd262_cppui256,
+                            0x8e38e38e38e38e38e38e38e38e38e38e38e38e38e38e38e38e38e38daaaaa88c_cppui256};
+                        constexpr static std::array<integral_type, 2> iso_x_den = {
+                            0xd35771193d94918a9ca34ccbb7b640dd86cd409542f8487d9fe6b745781eb49b_cppui256,
+                            0xedadc6f64383dc1df7c4b2d51b54225406d36b641f5e41bbc52a56612a8c6d14_cppui256};
+                        constexpr static std::array<integral_type, 4> iso_y_num = {
+                            0x4bda12f684bda12f684bda12f684bda12f684bda12f684bda12f684b8e38e23c_cppui256,
+                            0xc75e0c32d5cb7c0fa9d0a54b12a0a6d5647ab046d686da6fdffc90fc201d71a3_cppui256,
+                            0x29a6194691f91a73715209ef6512e576722830a201be2018a765e85a9ecee931_cppui256,
+                            0x2f684bda12f684bda12f684bda12f684bda12f684bda12f684bda12f38e38d84_cppui256};
+                        constexpr static std::array<integral_type, 3> iso_y_den = {
+                            0xfffffffffffffffffffffffffffffffffffffffffffffffffffffffefffff93b_cppui256,
+                            0x7a06534bb8bdb49fd5e9e6632722c2989467c1bfc8e8d978dfb425d2685c2573_cppui256,
+                            0x6484aa716545ca2cf3a70c3fa8fe337e0a3d21162f0d6299a7bf8192bfd2a76f_cppui256};
+                    };
+
+                    /// Halo2 (pasta_curves) hash_to_curve: expand_message_xmd_halo2 over BLAKE2b-512, L = 64, SSWU on
+                    /// the 3-isogenous curve. Halo2 builds DST as "<domain prefix>-" followed by suite_id.
+                    template<>
+                    struct h2c_suite<typename pallas::g1_type<>> {
+                        typedef pallas curve_type;
+                        typedef typename pallas::g1_type<> group_type;
+                        typedef blake2b<512> hash_type;
+
+                        typedef typename group_type::value_type group_value_type;
+                        typedef typename group_type::field_type::integral_type integral_type;
+                        typedef typename group_type::field_type::modular_type modular_type;
+                        typedef typename group_type::field_type::modular_backend modular_backend;
+                        typedef typename group_type::field_type::value_type field_value_type;
+
+                        // pallas_XMD:BLAKE2b_SSWU_RO_
+                        constexpr static std::array<std::uint8_t, 27> suite_id = {
+                            0x70, 0x61, 0x6c, 0x6c, 0x61, 0x73, 0x5f, 0x58, 0x4d, 0x44, 0x3a,
+                            0x42, 0x4c, 0x41, 0x4b, 0x45, 0x32, 0x62, 0x5f, 0x53, 0x53, 0x57,
+                            0x55, 0x5f, 0x52, 0x4f, 0x5f};
+                        constexpr static integral_type p = curve_type::base_field_type::modulus;
+                        constexpr static std::size_t m = 1;
+                        constexpr static std::size_t k = 256;
+                        constexpr static std::size_t L = 64;
+
+                        constexpr static inline const field_value_type Ai = field_value_type(
+                            0x18354a2eb0ea8c9c49be2d7258370742b74134581a27a59f92bb4b0b657a014b_cppui255);
+                        constexpr static inline const field_value_type Bi = field_value_type(1265);
+#if BOOST_COMP_GNUC
+                        constexpr static inline field_value_type Z = []() { return -field_value_type(13); }();
+#else
+                        constexpr static inline field_value_type Z = -field_value_type(13);
+#endif
+                        constexpr static integral_type h_eff = 0x01_cppui255;
+
+                        // 3-isogeny from E' to E, x_den and y_den are monic and their leading coefficient is omitted
+                        constexpr static std::array<integral_type, 4> iso_x_num = {
+                            0x1c71c71c71c71c71c71c71c71c71c71c8102eea8e7b06eb6eebec06955555580_cppui255,
+                            0x17329b9ec525375398c7d7ac3d98fd13380af066cfeb6d690eb64faef37ea4f7_cppui255,
+                            0x3509afd51872d88e267c7ffa51cf412a0f93b82ee4b994958cf863b02814fb76_cppui255,
+                            0xe38e38e38e38e38e38e38e38e38e38e4081775473d8375b775f6034aaaaaaab_cppui255};
+                        constexpr static std::array<integral_type, 2> iso_x_den = {
+                            0x325669becaecd5d11d13bf2a7f22b105b4abf9fb9a1fc81c2aa3af1eae5b6604_cppui255,
+                            0x1d572e7ddc099cff5a607fcce0494a799c434ac1c96b6980c47f2ab668bcd71f_cppui255};
+                        constexpr static std::array<integral_type, 4> iso_y_num = {
+                            0x25ed097b425ed097b425ed097b425ed0ac03e8e134eb3e493e53ab371c71c4f_cppui255,
+                            0x3fb98ff0d2ddcadd303216cce1db9ff11765e924f745937802e2be87d225b234_cppui255,
+                            0x1a84d7ea8c396c47133e3ffd28e7a09507c9dc17725cca4ac67c31d8140a7dbb_cppui255,
+                            0x1a12f684bda12f684bda12f684bda12f7642b01ad461bad25ad985b5e38e38e4_cppui255};
+                        constexpr static std::array<integral_type, 3> iso_y_den = {
+                            0x40000000000000000000000000000000224698fc094cf91b992d30ecfffffde5_cppui255,
+                            0x17033d3c60c68173573b3d7f7d681310d976bbfabbc5661d4d90ab820b12320a_cppui255,
+                            0xc02c5bcca0e6b7f0790bfb3506defb65941a3a4a97aa1b35a28279b1d1b42ae_cppui255};
+                    };
+
+                    /// Halo2 (pasta_curves) hash_to_curve: expand_message_xmd_halo2 over BLAKE2b-512, L = 64, SSWU on
+                    /// the 3-isogenous curve. Halo2 builds DST as "<domain prefix>-" followed by suite_id.
+                    template<>
+                    struct h2c_suite<typename vesta::g1_type<>> {
+                        typedef vesta curve_type;
+                        typedef typename vesta::g1_type<> group_type;
+                        typedef blake2b<512> hash_type;
+
+                        typedef typename group_type::value_type group_value_type;
+                        typedef typename group_type::field_type::integral_type integral_type;
+                        typedef typename group_type::field_type::modular_type modular_type;
+                        typedef typename group_type::field_type::modular_backend modular_backend;
+                        typedef typename group_type::field_type::value_type field_value_type;
+
+                        // vesta_XMD:BLAKE2b_SSWU_RO_
+                        constexpr static std::array<std::uint8_t, 26> suite_id = {
+                            0x76, 0x65, 0x73, 0x74, 0x61, 0x5f, 0x58, 0x4d, 0x44, 0x3a, 0x42,
+                            0x4c, 0x41, 0x4b, 0x45, 0x32, 0x62, 0x5f, 0x53, 0x53, 0x57, 0x55,
+                            0x5f, 0x52, 0x4f, 0x5f};
+                        constexpr static integral_type p = curve_type::base_field_type::modulus;
+                        constexpr static std::size_t m = 1;
+                        constexpr static std::size_t k = 256;
+                        constexpr static std::size_t L = 64;
+
+                        constexpr static inline const field_value_type Ai = field_value_type(
+                            0x267f9b2ee592271a81639c4d96f787739673928c7d01b212c515ad7242eaa6b1_cppui255);
+                        constexpr static inline const field_value_type Bi = field_value_type(1265);
+#if BOOST_COMP_GNUC
+                        constexpr static inline field_value_type Z = []() { return -field_value_type(13); }();
+#else
+                        constexpr static inline field_value_type Z = -field_value_type(13);
+#endif
+                        constexpr static integral_type h_eff = 0x01_cppui255;
+
+                        // 3-isogeny from E' to E, x_den and y_den are monic and their leading coefficient is omitted
+                        constexpr static std::array<integral_type, 4> iso_x_num = {
+                            0x31c71c71c71c71c71c71c71c71c71c71e1c521a795ac8356fb539a6f0000002b_cppui255,
+                            0x18760c7f7a9ad20ded7ee4a9cdf78f8fd59d03d23b39cb11aeac67bbeb586a3d_cppui255,
+                            0x1d935247b4473d17acecf10f5f7c09a2216b8861ec72bd5d8b95c6aaf703bcc5_cppui255,
+                            0x38e38e38e38e38e38e38e38e38e38e390205dd51cfa0961a43cd42c800000001_cppui255};
+                        constexpr static std::array<integral_type, 2> iso_x_den = {
+                            0x14735171ee5427780c621de8b91c242a30cd6d53df49d235f169c187d2533465_cppui255,
+                            0xa2de485568125d51454798a5b5c56b2a3ad678129b604d3b7284f7eaf21a2e9_cppui255};
+                        constexpr static std::array<integral_type, 4> iso_y_num = {
+                            0x1ed097b425ed097b425ed097b425ed098bc32d36fb21a6a38f64842c55555533_cppui255,
+                            0x19b0d87e16e2578866d1466e9de10e6497a3ca5c24e9ea634986913ab4443034_cppui255,
+                            0x2ec9a923da239e8bd6767887afbe04d121d910aefb03b31d8bee58e5fb81de63_cppui255,
+                            0x12f684bda12f684bda12f684bda12f685601f4709a8adcb36bef1642aaaaaaab_cppui255};
+                        constexpr static std::array<integral_type, 3> iso_y_den = {
+                            0x40000000000000000000000000000000224698fc0994a8dd8c46eb20fffffde5_cppui255,
+                            0x3d59f455cafc7668252659ba2b546c7e926847fb9ddd76a1d43d449776f99d2f_cppui255,
+                            0x2f44d6c801c1b8bf9e7eb64f890a820c06a767bfc35b5bac58dfecce86b2745e_cppui255};
+                    };
+
+                    template<>
+                    struct h2c_suite<typename curve25519::g1_type<coordinates::affine>> {
+                        typedef curve25519 curve_type;
+                        typedef typename curve25519::g1_type<coordinates::affine> group_type;
+                        typedef hashes::sha2<512> hash_type;
+
+                        typedef typename group_type::value_type group_value_type;
+                        typedef typename group_type::field_type::integral_type integral_type;
+                        typedef typename group_type::field_type::modular_type modular_type;
+                        typedef typename group_type::field_type::modular_backend modular_backend;
+                        typedef typename group_type::field_type::value_type field_value_type;
+
+                        // curve25519_XMD:SHA-512_ELL2_RO_
+                        constexpr static std::array<std::uint8_t, 31> suite_id = {
+                            0x63, 0x75, 0x72, 0x76, 0x65, 0x32, 0x35, 0x35, 0x31, 0x39, 0x5f,
+                            0x58, 0x4d, 0x44, 0x3a, 0x53, 0x48, 0x41, 0x2d, 0x35, 0x31, 0x32,
+                            0x5f, 0x45, 0x4c, 0x4c, 0x32, 0x5f, 0x52, 0x4f, 0x5f};
+                        constexpr static integral_type p = curve_type::base_field_type::modulus;
+                        constexpr static std::size_t m = 1;
+                        constexpr static std::size_t k = 128;
+                        constexpr static std::size_t L = 48;
+
+                        // Montgomery curve K * t^2 = s^3 + J * s^2 + s
+                        constexpr static inline const field_value_type J = field_value_type(486662);
+                        constexpr static inline const field_value_type K = field_value_type(1);
+                        constexpr static inline const field_value_type Z = field_value_type(2);
+                        constexpr static integral_type h_eff = 0x08_cppui255;
+                    };
+
+                    template<>
+                    struct h2c_suite<typename ed25519::g1_type<>> {
+                        typedef ed25519 curve_type;
+                        typedef typename ed25519::g1_type<> group_type;
+                        typedef hashes::sha2<512> hash_type;
+
+                        typedef typename group_type::value_type group_value_type;
+                        typedef typename group_type::field_type::integral_type integral_type;
+                        typedef typename group_type::field_type::modular_type modular_type;
+                        typedef typename group_type::field_type::modular_backend modular_backend;
+                        typedef typename group_type::field_type::value_type field_value_type;
+
+                        // edwards25519_XMD:SHA-512_ELL2_RO_
+                        constexpr static std::array<std::uint8_t, 33> suite_id = {
+                            0x65, 0x64, 0x77, 0x61, 0x72, 0x64, 0x73, 0x32, 0x35, 0x35, 0x31,
+                            0x39, 0x5f, 0x58, 0x4d, 0x44, 0x3a, 0x53, 0x48, 0x41, 0x2d, 0x35,
+                            0x31, 0x32, 0x5f, 0x45, 0x4c, 0x4c, 0x32, 0x5f, 0x52, 0x4f, 0x5f};
+                        constexpr static integral_type p = curve_type::base_field_type::modulus;
+                        constexpr static std::size_t m = 1;
+                        constexpr static std::size_t k = 128;
+                        constexpr static std::size_t L = 48;
+
+                        // Montgomery curve K * t^2 = s^3 + J * s^2 + s
+                        constexpr static inline const field_value_type J = field_value_type(486662);
+                        constexpr static inline const field_value_type K = field_value_type(1);
+                        constexpr static inline const field_value_type Z = field_value_type(2);
+                        // c1 = sqrt(-486664) with sgn0(c1) == 0, scales the birational map to edwards25519
+                        constexpr static inline const field_value_type c1 = field_value_type(
+                            0xf26edf460a006bbd27b08dc03fc4f7ec5a1d3d14b7d1a82cc6e04aaff457e06_cppui255);
+                        constexpr static integral_type h_eff = 0x08_cppui255;
+                    };
                 }    // namespace detail
             }        // namespace curves
         }            // namespace algebra
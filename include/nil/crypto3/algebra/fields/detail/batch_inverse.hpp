@@ -0,0 +1,66 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_FIELDS_BATCH_INVERSE_HPP
+#define CRYPTO3_ALGEBRA_FIELDS_BATCH_INVERSE_HPP
+
+#include <cstddef>
+#include <vector>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace fields {
+                namespace detail {
+                    /// Replaces every element of values by its inverse with Montgomery's trick: a single field
+                    /// inversion and 3(n - 1) multiplications. All elements must be non-zero.
+                    template<typename FieldValueType>
+                    void batch_inverse(std::vector<FieldValueType> &values) {
+                        if (values.empty()) {
+                            return;
+                        }
+
+                        // prefix[i] = values[0] * ... * values[i - 1]
+                        std::vector<FieldValueType> prefix(values.size());
+                        FieldValueType acc = FieldValueType::one();
+                        for (std::size_t i = 0; i < values.size(); ++i) {
+                            prefix[i] = acc;
+                            acc = acc * values[i];
+                        }
+
+                        FieldValueType acc_inversed = acc.inversed();
+                        for (std::size_t i = values.size(); i-- > 0;) {
+                            const FieldValueType value_inversed = acc_inversed * prefix[i];
+                            acc_inversed = acc_inversed * values[i];
+                            values[i] = value_inversed;
+                        }
+                    }
+                }    // namespace detail
+            }        // namespace fields
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_FIELDS_BATCH_INVERSE_HPP
@@ -28,6 +28,7 @@
 
 #include <nil/crypto3/algebra/fields/detail/exponentiation.hpp>
 #include <nil/crypto3/algebra/fields/detail/element/operations.hpp>
+#include <nil/crypto3/algebra/operation_counters.hpp>
 
 #include <nil/crypto3/multiprecision/ressol.hpp>
 #include <nil/crypto3/multiprecision/inverse.hpp>
@@ -44,6 +45,9 @@ namespace nil {
         namespace algebra {
             namespace fields {
                 namespace detail {
+                    template<typename FieldParams>
+                    class element_fp_dbl;
+
                     template<typename FieldParams>
                     class element_fp {
                         typedef FieldParams policy_type;
@@ -59,6 +63,9 @@ namespace nil {
                         constexpr static const modular_params_type modulus_params = policy_type::modulus_params;
                         constexpr static const integral_type modulus = policy_type::modulus;
 
+                        /// Unreduced double-width product type, see element_fp_dbl
+                        typedef element_fp_dbl<FieldParams> dbl_type;
+
                         using data_type = modular_type;
                         data_type data;
 
@@ -128,12 +135,14 @@ namespace nil {
                         }
 
                         constexpr element_fp &operator*=(const element_fp &B) {
+                            CRYPTO3_ALGEBRA_COUNT_OPERATION(field_mul);
                             data *= B.data;
 
                             return *this;
                         }
 
                         constexpr element_fp &operator/=(const element_fp &B) {
+                            CRYPTO3_ALGEBRA_COUNT_OPERATION(field_mul);
                             data *= B.inversed().data;
 
                             return *this;
@@ -144,10 +153,12 @@ namespace nil {
                         }
 
                         constexpr element_fp operator*(const element_fp &B) const {
+                            CRYPTO3_ALGEBRA_COUNT_OPERATION(field_mul);
                             return element_fp(data * B.data);
                         }
 
                         constexpr element_fp operator/(const element_fp &B) const {
+                            CRYPTO3_ALGEBRA_COUNT_OPERATION(field_mul);
                             //                        return element_fp(data / B.data);
                             return element_fp(data * B.inversed().data);
                         }
@@ -194,12 +205,29 @@ namespace nil {
                             return element_fp(data + data);
                         }
 
-                        // TODO: maybe incorrect result here
+                        /// Square root, -1 if the element is not a square. p = 3 (mod 4) takes a single
+                        /// exponentiation by (p + 1) / 4 and p = 5 (mod 8) uses Atkin's method; other moduli
+                        /// fall back to Tonelli--Shanks in ressol.
                         constexpr element_fp sqrt() const {
+                            if (multiprecision::bit_test(modulus, 1)) {
+                                // (p + 1) / 4 = floor(p / 4) + 1
+                                const element_fp root = pow(integral_type((modulus >> 2) + 1));
+                                return root.squared() == *this ? root : -one();
+                            }
+
+                            if (multiprecision::bit_test(modulus, 2)) {
+                                // b = (2a)^((p - 5) / 8), i = 2a * b^2 is a square root of -1, x = a * b * (i - 1)
+                                const element_fp two_a = doubled();
+                                const element_fp b = two_a.pow(integral_type(modulus >> 3));
+                                const element_fp root = *this * b * (two_a * b.squared() - one());
+                                return root.squared() == *this ? root : -one();
+                            }
+
                             return element_fp(ressol(data));
                         }
 
                         constexpr element_fp inversed() const {
+                            CRYPTO3_ALGEBRA_COUNT_OPERATION(field_inv);
                             return element_fp(inverse_mod(data));
                         }
 
@@ -208,12 +236,13 @@ namespace nil {
                         }
 
                         constexpr element_fp squared() const {
+                            CRYPTO3_ALGEBRA_COUNT_OPERATION(field_sqr);
                             return element_fp(data * data);    // maybe can be done more effective
                         }
 
-                        // TODO: maybe error here
+                        /// Euler's criterion: a^((p - 1) / 2) == 1 for non-zero squares
                         constexpr bool is_square() const {
-                            return (this->sqrt() != -1);    // maybe can be done more effective
+                            return is_zero() || pow(integral_type(modulus >> 1)).is_one();
                         }
 
                         template<typename PowerType,
@@ -241,4 +270,7 @@ namespace nil {
     }                // namespace crypto3
 }    // namespace nil
 
+// Completes element_fp::dbl_type for code reducing lazily through it
+#include <nil/crypto3/algebra/fields/detail/element/fp_dbl.hpp>
+
 #endif    // CRYPTO3_ALGEBRA_FIELDS_ELEMENT_FP_HPP
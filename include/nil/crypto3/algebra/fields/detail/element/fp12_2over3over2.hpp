@@ -28,6 +28,8 @@
 
 #include <nil/crypto3/algebra/fields/detail/exponentiation.hpp>
 #include <nil/crypto3/algebra/fields/detail/element/operations.hpp>
+#include <nil/crypto3/algebra/fields/detail/element/non_residue_policy.hpp>
+#include <nil/crypto3/algebra/fields/detail/element/frobenius_coeffs.hpp>
 
 #include <nil/crypto3/multiprecision/number.hpp>
 #include <nil/crypto3/multiprecision/cpp_int.hpp>
@@ -135,7 +137,13 @@ namespace nil {
 
                         element_fp12_2over3over2 squared() const {
 
-                            return (*this) * (*this);    // maybe can be done more effective
+                            /* Devegili OhEig Scott Dahab --- Multiplication and Squaring on Pairing-Friendly
+                             * Fields.pdf; Section 3 (Complex squaring) */
+                            const underlying_type &A = data[0], &B = data[1];
+                            const underlying_type AB = A * B;
+
+                            return element_fp12_2over3over2(
+                                (A + B) * (A + mul_by_non_residue(B)) - AB - mul_by_non_residue(AB), AB + AB);
                         }
 
                         template<typename PowerType>
@@ -161,14 +169,9 @@ namespace nil {
                         }
 
                         template<typename PowerType>
-                        element_fp12_2over3over2 Frobenius_map(const PowerType &pwr) const {
-                            // return element_fp12_2over3over2(data[0].Frobenius_map(pwr),
-                            //                                 policy_type::Frobenius_coeffs_c1[pwr % 12] *
-                            //                                 data[1].Frobenius_map(pwr)});
+                        constexpr element_fp12_2over3over2 Frobenius_map(const PowerType &pwr) const {
                             return element_fp12_2over3over2(data[0].Frobenius_map(pwr),
-                                                            typename policy_type::non_residue_type(
-                                                                policy_type::Frobenius_coeffs_c1[(pwr % 12) * 2],
-                                                                policy_type::Frobenius_coeffs_c1[(pwr % 12) * 2 + 1]) *
+                                                            Frobenius_coeffs_c1[pwr % 12] *
                                                                 data[1].Frobenius_map(pwr));
                         }
 
@@ -192,18 +195,18 @@ namespace nil {
 
                             // t0 + t1*y = (z0 + z1*y)^2 = a^2
                             tmp = z0 * z1;
-                            t0 = (z0 + z1) * (z0 + underlying_type::non_residue * z1) - tmp -
-                                 underlying_type::non_residue * tmp;
+                            t0 = (z0 + z1) * (z0 + underlying_type::mul_by_non_residue(z1)) - tmp -
+                                 underlying_type::mul_by_non_residue(tmp);
                             t1 = tmp + tmp;
                             // t2 + t3*y = (z2 + z3*y)^2 = b^2
                             tmp = z2 * z3;
-                            t2 = (z2 + z3) * (z2 + underlying_type::non_residue * z3) - tmp -
-                                 underlying_type::non_residue * tmp;
+                            t2 = (z2 + z3) * (z2 + underlying_type::mul_by_non_residue(z3)) - tmp -
+                                 underlying_type::mul_by_non_residue(tmp);
                             t3 = tmp + tmp;
                             // t4 + t5*y = (z4 + z5*y)^2 = c^2
                             tmp = z4 * z5;
-                            t4 = (z4 + z5) * (z4 + underlying_type::non_residue * z5) - tmp -
-                                 underlying_type::non_residue * tmp;
+                            t4 = (z4 + z5) * (z4 + underlying_type::mul_by_non_residue(z5)) - tmp -
+                                 underlying_type::mul_by_non_residue(tmp);
                             t5 = tmp + tmp;
 
                             // for A
@@ -220,7 +223,7 @@ namespace nil {
                             // for B
 
                             // z2 = 3 * (xi * t5) + 2 * z2
-                            tmp = underlying_type::non_residue * t5;
+                            tmp = underlying_type::mul_by_non_residue(t5);
                             z2 = tmp + z2;
                             z2 = z2 + z2;
                             z2 = z2 + tmp;
@@ -291,19 +294,26 @@ namespace nil {
                             typename underlying_type::underlying_type x4 = ell_0;
                             typename underlying_type::underlying_type x5 = ell_VV;
 
-                            typename underlying_type::underlying_type t0, t1, t2, t3, t4, t5;
-                            typename underlying_type::underlying_type tmp1, tmp2;
+                            typedef typename underlying_type::underlying_type::dbl_type dbl_type;
 
-                            // TODO: non_residue should be used as static
-                            tmp1 = element_fp12_2over3over2().non_residue * x4;
-                            tmp2 = element_fp12_2over3over2().non_residue * x5;
+                            typename underlying_type::underlying_type tmp1, tmp2;
 
-                            t0 = x0 * z0 + tmp1 * z4 + tmp2 * z3;
-                            t1 = x0 * z1 + tmp1 * z5 + tmp2 * z4;
-                            t2 = x0 * z2 + x4 * z3 + tmp2 * z5;
-                            t3 = x0 * z3 + tmp1 * z2 + tmp2 * z1;
-                            t4 = x0 * z4 + x4 * z0 + tmp2 * z2;
-                            t5 = x0 * z5 + x4 * z1 + x5 * z0;
+                            tmp1 = non_residue_policy<policy_type>::mul(x4);
+                            tmp2 = non_residue_policy<policy_type>::mul(x5);
+
+                            // each coefficient is a sum of three Fp2 products, reduced once
+                            const typename underlying_type::underlying_type t0 =
+                                (dbl_type::mul(x0, z0) + dbl_type::mul(tmp1, z4) + dbl_type::mul(tmp2, z3)).reduce();
+                            const typename underlying_type::underlying_type t1 =
+                                (dbl_type::mul(x0, z1) + dbl_type::mul(tmp1, z5) + dbl_type::mul(tmp2, z4)).reduce();
+                            const typename underlying_type::underlying_type t2 =
+                                (dbl_type::mul(x0, z2) + dbl_type::mul(x4, z3) + dbl_type::mul(tmp2, z5)).reduce();
+                            const typename underlying_type::underlying_type t3 =
+                                (dbl_type::mul(x0, z3) + dbl_type::mul(tmp1, z2) + dbl_type::mul(tmp2, z1)).reduce();
+                            const typename underlying_type::underlying_type t4 =
+                                (dbl_type::mul(x0, z4) + dbl_type::mul(x4, z0) + dbl_type::mul(tmp2, z2)).reduce();
+                            const typename underlying_type::underlying_type t5 =
+                                (dbl_type::mul(x0, z5) + dbl_type::mul(x4, z1) + dbl_type::mul(x5, z0)).reduce();
 
                             return element_fp12_2over3over2(underlying_type(t0, t1, t2), underlying_type(t3, t4, t5));
                         }
@@ -312,12 +322,73 @@ namespace nil {
                             mul_by_024(const typename underlying_type::underlying_type &ell_0,
                                        const typename underlying_type::underlying_type &ell_VW,
                                        const typename underlying_type::underlying_type &ell_VV) const {
-                            element_fp12_2over3over2 a(
-                                underlying_type(ell_0, underlying_type::underlying_type::zero(), ell_VV),
-                                underlying_type(underlying_type::underlying_type::zero(), ell_VW,
-                                                underlying_type::underlying_type::zero()));
 
-                            return (*this) * a;
+                            // element_fp12_2over3over2 a(
+                            //     underlying_type(ell_0, underlying_type::underlying_type::zero(), ell_VV),
+                            //     underlying_type(underlying_type::underlying_type::zero(), ell_VW,
+                            //                     underlying_type::underlying_type::zero()));
+                            //
+                            // return (*this) * a;
+
+                            const typename underlying_type::underlying_type &z0 = this->data[0].data[0];
+                            const typename underlying_type::underlying_type &z1 = this->data[0].data[1];
+                            const typename underlying_type::underlying_type &z2 = this->data[0].data[2];
+                            const typename underlying_type::underlying_type &z3 = this->data[1].data[0];
+                            const typename underlying_type::underlying_type &z4 = this->data[1].data[1];
+                            const typename underlying_type::underlying_type &z5 = this->data[1].data[2];
+
+                            const typename underlying_type::underlying_type &x0 = ell_0;
+                            const typename underlying_type::underlying_type &x2 = ell_VV;
+                            const typename underlying_type::underlying_type &x4 = ell_VW;
+
+                            typedef typename underlying_type::underlying_type::dbl_type dbl_type;
+
+                            // products are kept unreduced and every output coefficient is reduced once
+                            const dbl_type D0 = dbl_type::mul(z0, x0);
+                            const dbl_type D2 = dbl_type::mul(z2, x2);
+                            const dbl_type D4 = dbl_type::mul(z4, x4);
+
+                            const dbl_type P12 = dbl_type::mul(z1, x2);
+                            const dbl_type P54 = dbl_type::mul(z5, x4);
+                            const dbl_type P10 = dbl_type::mul(z1, x0);
+                            const dbl_type P34 = dbl_type::mul(z3, x4);
+                            const dbl_type P30 = dbl_type::mul(z3, x0);
+                            const dbl_type P52 = dbl_type::mul(z5, x2);
+
+                            // z5 = z5 * x0 + z3 * x2 + z1 * x4
+                            const dbl_type S1 = P12 + P54 + P10 + P34 + P30 + P52;
+                            const typename underlying_type::underlying_type n5 =
+                                (dbl_type::mul(z1 + z3 + z5, x0 + x2 + x4) - S1).reduce();
+
+                            const dbl_type P24 = dbl_type::mul(z2 + z4, x2 + x4) - D2 - D4;
+                            const dbl_type P04 = dbl_type::mul(z0 + z4, x0 + x4) - D0 - D4;
+
+                            // z2 = z2 * x0 + z0 * x2 + z3 * x4
+                            const typename underlying_type::underlying_type n2 =
+                                (dbl_type::mul(z0 + z2, x0 + x2) - D0 - D2 + P34).reduce();
+
+                            typename underlying_type::underlying_type n0, n1, n3, n4;
+                            if constexpr (dbl_type::template has_lazy_non_residue<non_residue_policy<policy_type>>) {
+                                // z0 = non_residue * (z1 * x2 + z4 * x4) + z0 * x0
+                                n0 = ((P12 + D4).template mul_by_non_residue<non_residue_policy<policy_type>>() + D0)
+                                         .reduce();
+                                // z1 = non_residue * (z5 * x4 + z2 * x2) + z1 * x0
+                                n1 = ((P54 + D2).template mul_by_non_residue<non_residue_policy<policy_type>>() + P10)
+                                         .reduce();
+                                // z3 = non_residue * (z2 * x4 + z4 * x2) + z3 * x0
+                                n3 = (P24.template mul_by_non_residue<non_residue_policy<policy_type>>() + P30)
+                                         .reduce();
+                                // z4 = non_residue * z5 * x2 + z4 * x0 + z0 * x4
+                                n4 = (P52.template mul_by_non_residue<non_residue_policy<policy_type>>() + P04)
+                                         .reduce();
+                            } else {
+                                n0 = non_residue_policy<policy_type>::mul((P12 + D4).reduce()) + D0.reduce();
+                                n1 = non_residue_policy<policy_type>::mul((P54 + D2).reduce()) + P10.reduce();
+                                n3 = non_residue_policy<policy_type>::mul(P24.reduce()) + P30.reduce();
+                                n4 = non_residue_policy<policy_type>::mul(P52.reduce()) + P04.reduce();
+                            }
+
+                            return element_fp12_2over3over2(underlying_type(n0, n1, n2), underlying_type(n3, n4, n5));
                         }
 
                         /*element_fp12_2over3over2 sqru() {
@@ -355,9 +426,15 @@ namespace nil {
                             z3 = (t2 - z3).doubled() + t2;
                         }*/
 
-                        /*inline static*/ underlying_type mul_by_non_residue(const underlying_type &A) const {
-                            return underlying_type(non_residue * A.data[2], A.data[0], A.data[1]);
+                        /// Multiplies an Fp6 element by its generator, (A0, A1, A2) -> (non_residue * A2, A0, A1)
+                        inline static underlying_type mul_by_non_residue(const underlying_type &A) {
+                            return underlying_type(non_residue_policy<policy_type>::mul(A.data[2]), A.data[0],
+                                                   A.data[1]);
                         }
+
+                    private:
+                        constexpr static const std::array<non_residue_type, 12> Frobenius_coeffs_c1 =
+                            make_Frobenius_coeffs<non_residue_type, 12>(policy_type::Frobenius_coeffs_c1);
                     };
 
                     template<typename FieldParams>
@@ -483,6 +560,10 @@ namespace nil {
                     constexpr const typename element_fp12_2over3over2<FieldParams>::non_residue_type
                         element_fp12_2over3over2<FieldParams>::non_residue;
 
+                    template<typename FieldParams>
+                    constexpr const std::array<typename element_fp12_2over3over2<FieldParams>::non_residue_type, 12>
+                        element_fp12_2over3over2<FieldParams>::Frobenius_coeffs_c1;
+
                 }    // namespace detail
             }        // namespace fields
         }            // namespace algebra
@@ -28,6 +28,9 @@
 
 #include <nil/crypto3/algebra/fields/detail/exponentiation.hpp>
 #include <nil/crypto3/algebra/fields/detail/element/operations.hpp>
+#include <nil/crypto3/algebra/fields/detail/element/fp2_dbl.hpp>
+#include <nil/crypto3/algebra/fields/detail/element/non_residue_policy.hpp>
+#include <nil/crypto3/algebra/fields/detail/element/frobenius_coeffs.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -51,6 +54,9 @@ namespace nil {
 
                         typedef typename policy_type::underlying_type underlying_type;
 
+                        /// Unreduced double-width product type, see element_fp2_dbl
+                        typedef element_fp2_dbl<FieldParams> dbl_type;
+
                         using data_type = std::array<underlying_type, 2>;
 
                         data_type data;
@@ -137,7 +143,7 @@ namespace nil {
                             const underlying_type A0 = data[0], A1 = data[1], B0 = B.data[0], B1 = B.data[1];
                             const underlying_type A0B0 = data[0] * B.data[0], A1B1 = data[1] * B.data[1];
 
-                            return element_fp2(A0B0 + non_residue * A1B1, (A0 + A1) * (B0 + B1) - A0B0 - A1B1);
+                            return element_fp2(A0B0 + mul_by_non_residue(A1B1), (A0 + A1) * (B0 + B1) - A0B0 - A1B1);
                         }
 
                         constexpr element_fp2 &operator*=(const element_fp2 &B) {
@@ -204,42 +210,35 @@ namespace nil {
                             return element_fp2(data[0].doubled(), data[1].doubled());
                         }
 
+                        /// Square root by the complex method (Scott, "Implementing cryptographic pairings";
+                        /// Adj, Rodriguez-Henriquez, "Square root computation over even extension fields"):
+                        /// with alpha = sqrt(norm) one of (a0 +- alpha) / 2 is a square x0^2 and x1 = a1 / 2x0,
+                        /// so the cost is two or three Fp square roots instead of Tonelli--Shanks over Fp2.
+                        /// The result is unspecified if the element is not a square, see is_square().
                         constexpr element_fp2 sqrt() const {
+                            const underlying_type &A0 = data[0], &A1 = data[1];
 
-                            element_fp2 one = this->one();
-
-                            std::size_t v = policy_type::s;
-                            element_fp2 z(policy_type::nqr_to_t[0], policy_type::nqr_to_t[1]);
-                            element_fp2 w = this->pow(policy_type::t_minus_1_over_2);
-                            element_fp2 x((*this) * w);
-                            element_fp2 b = x * w;    // b = (*this)^t
-
-                            // compute square root with Tonelli--Shanks
-                            // (does not terminate if not a square!)
-
-                            while (b != one) {
-                                std::size_t m = 0;
-                                element_fp2 b2m = b;
-                                while (b2m != one) {
-                                    /* invariant: b2m = b^(2^m) after entering this loop */
-                                    b2m = b2m.squared();
-                                    m += 1;
+                            if (A1.is_zero()) {
+                                if (A0.is_square()) {
+                                    return element_fp2(A0.sqrt(), underlying_type::zero());
                                 }
+                                // A0 = non_residue * y^2, so the root is y * u
+                                return element_fp2(underlying_type::zero(),
+                                                   (A0 * underlying_type(non_residue).inversed()).sqrt());
+                            }
 
-                                int j = v - m - 1;
-                                w = z;
-                                while (j > 0) {
-                                    w = w.squared();
-                                    --j;
-                                }    // w = z^2^(v-m-1)
-
-                                z = w.squared();
-                                b = b * z;
-                                x = x * w;
-                                v = m;
+                            const underlying_type alpha = (A0.squared() - mul_by_non_residue(A1.squared())).sqrt();
+                            // (p + 1) / 2 is the inverse of 2
+                            const underlying_type two_inv = underlying_type(integral_type((modulus >> 1) + 1));
+
+                            underlying_type delta = (A0 + alpha) * two_inv;
+                            underlying_type x0 = delta.sqrt();
+                            if (x0.squared() != delta) {
+                                delta -= alpha;
+                                x0 = delta.sqrt();
                             }
 
-                            return x;
+                            return element_fp2(x0, A1 * x0.doubled().inversed());
                         }
 
                         constexpr element_fp2 squared() const {
@@ -251,12 +250,13 @@ namespace nil {
                             const underlying_type A = data[0], B = data[1];
                             const underlying_type AB = A * B;
 
-                            return element_fp2((A + B) * (A + non_residue * B) - AB - non_residue * AB, AB + AB);
+                            return element_fp2((A + B) * (A + mul_by_non_residue(B)) - AB - mul_by_non_residue(AB),
+                                               AB + AB);
                         }
 
+                        /// An Fp2 element is a square iff its norm A0^2 - non_residue * A1^2 is a square in Fp
                         constexpr bool is_square() const {
-                            element_fp2 tmp = this->pow(policy_type::group_order);
-                            return (tmp.is_one() || tmp.is_zero());    // maybe can be done more effective
+                            return (data[0].squared() - mul_by_non_residue(data[1].squared())).is_square();
                         }
 
                         template<typename PowerType>
@@ -273,7 +273,7 @@ namespace nil {
 
                             const underlying_type t0 = A0.squared();
                             const underlying_type t1 = A1.squared();
-                            const underlying_type t2 = t0 - non_residue * t1;
+                            const underlying_type t2 = t0 - mul_by_non_residue(t1);
                             const underlying_type t3 = t2.inversed();
                             const underlying_type c0 = A0 * t3;
                             const underlying_type c1 = -(A1 * t3);
@@ -283,12 +283,17 @@ namespace nil {
 
                         template<typename PowerType>
                         constexpr element_fp2 Frobenius_map(const PowerType &pwr) const {
-                            return element_fp2(
-                                data[0],
-                                typename policy_type::non_residue_type(policy_type::Frobenius_coeffs_c1[pwr % 2]) *
-                                    data[1]);
-                            // return element_fp2(data[0], policy_type::Frobenius_coeffs_c1[pwr % 2] * data[1]});
+                            return element_fp2(data[0], Frobenius_coeffs_c1[pwr % 2] * data[1]);
+                        }
+
+                        /// Multiplies an Fp element by the non-residue u^2, see non_residue_policy
+                        constexpr inline static underlying_type mul_by_non_residue(const underlying_type &A) {
+                            return non_residue_policy<policy_type>::mul(A);
                         }
+
+                    private:
+                        constexpr static const std::array<non_residue_type, 2> Frobenius_coeffs_c1 =
+                            make_Frobenius_coeffs<non_residue_type, 2>(policy_type::Frobenius_coeffs_c1);
                     };
 
                     template<typename FieldParams>
@@ -317,6 +322,10 @@ namespace nil {
                     constexpr const typename element_fp2<FieldParams>::non_residue_type
                         element_fp2<FieldParams>::non_residue;
 
+                    template<typename FieldParams>
+                    constexpr const std::array<typename element_fp2<FieldParams>::non_residue_type, 2>
+                        element_fp2<FieldParams>::Frobenius_coeffs_c1;
+
                 }    // namespace detail
             }        // namespace fields
         }            // namespace algebra
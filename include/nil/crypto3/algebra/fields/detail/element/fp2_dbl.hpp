@@ -0,0 +1,162 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_FIELDS_ELEMENT_FP2_DBL_HPP
+#define CRYPTO3_ALGEBRA_FIELDS_ELEMENT_FP2_DBL_HPP
+
+#include <array>
+
+#include <nil/crypto3/algebra/fields/detail/element/fp_dbl.hpp>
+#include <nil/crypto3/algebra/fields/detail/element/non_residue_policy.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace fields {
+                namespace detail {
+
+                    template<typename FieldParams>
+                    class element_fp2;
+
+                    /*!
+                     * @brief Unreduced double-width product of quadratic extension elements.
+                     *
+                     * Keeps the three Karatsuba products sum(a0 * b0), sum(a1 * b1) and
+                     * sum((a0 + a1) * (b0 + b1)) unreduced, so that sums of Fp2 products are reduced once per
+                     * coefficient in reduce().
+                     */
+                    template<typename FieldParams>
+                    class element_fp2_dbl {
+                        typedef FieldParams policy_type;
+
+                    public:
+                        typedef typename policy_type::non_residue_type non_residue_type;
+                        constexpr static const non_residue_type non_residue = policy_type::non_residue;
+
+                        typedef typename policy_type::underlying_type underlying_type;
+                        typedef typename underlying_type::dbl_type underlying_dbl_type;
+
+                        typedef element_fp2<FieldParams> element_type;
+
+                        using data_type = std::array<underlying_dbl_type, 3>;
+
+                        /// Unreduced coefficients c0 + c1 * u, the form the non_residue_policy kernels work on
+                        struct coefficients {
+                            std::array<underlying_dbl_type, 2> data;
+
+                            constexpr coefficients(const underlying_dbl_type &c0, const underlying_dbl_type &c1) :
+                                data({c0, c1}) {};
+                        };
+
+                        data_type data;
+
+                        constexpr element_fp2_dbl() = default;
+
+                        constexpr element_fp2_dbl(const underlying_dbl_type &in_data0,
+                                                  const underlying_dbl_type &in_data1,
+                                                  const underlying_dbl_type &in_data2) :
+                            data({in_data0, in_data1, in_data2}) {};
+
+                        /// Unreduced product A * B
+                        constexpr static element_fp2_dbl mul(const element_type &A, const element_type &B) {
+                            return element_fp2_dbl(underlying_dbl_type::mul(A.data[0], B.data[0]),
+                                                   underlying_dbl_type::mul(A.data[1], B.data[1]),
+                                                   underlying_dbl_type::mul(A.data[0] + A.data[1],
+                                                                            B.data[0] + B.data[1]));
+                        }
+
+                        constexpr element_fp2_dbl operator+(const element_fp2_dbl &B) const {
+                            return element_fp2_dbl(data[0] + B.data[0], data[1] + B.data[1], data[2] + B.data[2]);
+                        }
+
+                        constexpr element_fp2_dbl operator-(const element_fp2_dbl &B) const {
+                            return element_fp2_dbl(data[0] - B.data[0], data[1] - B.data[1], data[2] - B.data[2]);
+                        }
+
+                        constexpr element_fp2_dbl &operator+=(const element_fp2_dbl &B) {
+                            data[0] += B.data[0];
+                            data[1] += B.data[1];
+                            data[2] += B.data[2];
+
+                            return *this;
+                        }
+
+                        constexpr element_fp2_dbl &operator-=(const element_fp2_dbl &B) {
+                            data[0] -= B.data[0];
+                            data[1] -= B.data[1];
+                            data[2] -= B.data[2];
+
+                            return *this;
+                        }
+
+                        constexpr element_fp2_dbl operator-() const {
+                            return element_fp2_dbl(-data[0], -data[1], -data[2]);
+                        }
+
+                        /// True when NonResiduePolicy, a non-residue of an extension over Fp2, can be applied to the
+                        /// unreduced value by mul_by_non_residue()
+                        template<typename NonResiduePolicy>
+                        constexpr static const bool has_lazy_non_residue =
+                            NonResiduePolicy::is_additive && non_residue_policy<policy_type>::is_additive;
+
+                        /// Multiplication by the non-residue of an extension over Fp2 without reducing, so that a sum
+                        /// like A0B0 + xi * T0 in the cubic extension still costs one reduction per coefficient
+                        template<typename NonResiduePolicy>
+                        constexpr element_fp2_dbl mul_by_non_residue() const {
+                            static_assert(has_lazy_non_residue<NonResiduePolicy>,
+                                          "the non-residue kernels have to be additive");
+
+                            const coefficients c = NonResiduePolicy::mul(coefficients(
+                                data[0] + non_residue_policy<policy_type>::mul(data[1]), data[2] - data[0] - data[1]));
+
+                            // (c0, 0, c0 + c1) reduces to c0 + c1 * u
+                            return element_fp2_dbl(c.data[0], underlying_dbl_type(), c.data[0] + c.data[1]);
+                        }
+
+                        constexpr element_type reduce() const {
+                            const underlying_type c1 = (data[2] - data[0] - data[1]).reduce();
+
+                            // additive non-residues (u^2 = -1 for BN and BLS12-381, -5 for BLS12-377, small constants
+                            // for MNT4) are applied to the unreduced value, so c0 is reduced once as well
+                            if constexpr (non_residue_policy<policy_type>::is_additive) {
+                                return element_type((data[0] + non_residue_policy<policy_type>::mul(data[1])).reduce(),
+                                                    c1);
+                            } else {
+                                return element_type(data[0].reduce() + non_residue * data[1].reduce(), c1);
+                            }
+                        }
+                    };
+
+                    template<typename FieldParams>
+                    constexpr typename element_fp2_dbl<FieldParams>::non_residue_type const
+                        element_fp2_dbl<FieldParams>::non_residue;
+
+                }    // namespace detail
+            }        // namespace fields
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_FIELDS_ELEMENT_FP2_DBL_HPP
@@ -28,6 +28,8 @@
 
 #include <nil/crypto3/algebra/fields/detail/exponentiation.hpp>
 #include <nil/crypto3/algebra/fields/detail/element/operations.hpp>
+#include <nil/crypto3/algebra/fields/detail/element/non_residue_policy.hpp>
+#include <nil/crypto3/algebra/fields/detail/element/frobenius_coeffs.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -151,8 +153,8 @@ namespace nil {
                                                   A2B2 = data[2] * B.data[2];
 
                             return element_fp3(
-                                A0B0 + non_residue * ((data[1] + data[2]) * (B.data[1] + B.data[2]) - A1B1 - A2B2),
-                                (data[0] + data[1]) * (B.data[0] + B.data[1]) - A0B0 - A1B1 + non_residue * A2B2,
+                                A0B0 + mul_by_non_residue((data[1] + data[2]) * (B.data[1] + B.data[2]) - A1B1 - A2B2),
+                                (data[0] + data[1]) * (B.data[0] + B.data[1]) - A0B0 - A1B1 + mul_by_non_residue(A2B2),
                                 (data[0] + data[2]) * (B.data[0] + B.data[2]) - A0B0 + A1B1 - A2B2);
                         }
 
@@ -221,26 +223,31 @@ namespace nil {
                             const underlying_type t3 = A0 * A1;
                             const underlying_type t4 = A0 * A2;
                             const underlying_type t5 = A1 * A2;
-                            const underlying_type c0 = t0 - non_residue * t5;
-                            const underlying_type c1 = non_residue * t2 - t3;
+                            const underlying_type c0 = t0 - mul_by_non_residue(t5);
+                            const underlying_type c1 = mul_by_non_residue(t2) - t3;
                             const underlying_type c2 =
                                 t1 - t4;    // typo in paper referenced above. should be "-" as per Scott, but is "*"
-                            const underlying_type t6 = (A0 * c0 + non_residue * (A2 * c1 + A1 * c2)).inversed();
+                            const underlying_type t6 = (A0 * c0 + mul_by_non_residue(A2 * c1 + A1 * c2)).inversed();
                             return element_fp3(t6 * c0, t6 * c1, t6 * c2);
                         }
 
                         template<typename PowerType>
                         constexpr element_fp3 Frobenius_map(const PowerType &pwr) const {
-                            return element_fp3(
-                                data[0],
-                                typename policy_type::non_residue_type(policy_type::Frobenius_coeffs_c1[pwr % 3]) *
-                                    data[1],
-                                typename policy_type::non_residue_type(policy_type::Frobenius_coeffs_c2[pwr % 3]) *
-                                    data[2]);
-                            // return element_fp3(data[0],
-                            //                    policy_type::Frobenius_coeffs_c1[pwr % 3] * data[1],
-                            //                    policy_type::Frobenius_coeffs_c2[pwr % 3] * data[2]});
+                            return element_fp3(data[0],
+                                               Frobenius_coeffs_c1[pwr % 3] * data[1],
+                                               Frobenius_coeffs_c2[pwr % 3] * data[2]);
+                        }
+
+                        /// Multiplies an Fp element by the non-residue u^3, see non_residue_policy
+                        constexpr inline static underlying_type mul_by_non_residue(const underlying_type &A) {
+                            return non_residue_policy<policy_type>::mul(A);
                         }
+
+                    private:
+                        constexpr static const std::array<non_residue_type, 3> Frobenius_coeffs_c1 =
+                            make_Frobenius_coeffs<non_residue_type, 3>(policy_type::Frobenius_coeffs_c1);
+                        constexpr static const std::array<non_residue_type, 3> Frobenius_coeffs_c2 =
+                            make_Frobenius_coeffs<non_residue_type, 3>(policy_type::Frobenius_coeffs_c2);
                     };
 
                     template<typename FieldParams>
@@ -259,6 +266,14 @@ namespace nil {
                     constexpr const typename element_fp3<FieldParams>::non_residue_type
                         element_fp3<FieldParams>::non_residue;
 
+                    template<typename FieldParams>
+                    constexpr const std::array<typename element_fp3<FieldParams>::non_residue_type, 3>
+                        element_fp3<FieldParams>::Frobenius_coeffs_c1;
+
+                    template<typename FieldParams>
+                    constexpr const std::array<typename element_fp3<FieldParams>::non_residue_type, 3>
+                        element_fp3<FieldParams>::Frobenius_coeffs_c2;
+
                 }    // namespace detail
             }        // namespace fields
         }            // namespace algebra
@@ -28,6 +28,8 @@
 
 #include <nil/crypto3/algebra/fields/detail/exponentiation.hpp>
 #include <nil/crypto3/algebra/fields/detail/element/operations.hpp>
+#include <nil/crypto3/algebra/fields/detail/element/non_residue_policy.hpp>
+#include <nil/crypto3/algebra/fields/detail/element/frobenius_coeffs.hpp>
 
 #include <nil/crypto3/multiprecision/wnaf.hpp>
 
@@ -159,13 +161,8 @@ namespace nil {
 
                         template<typename PowerType>
                         constexpr element_fp4 Frobenius_map(const PowerType &pwr) const {
-                            return element_fp4(
-                                data[0].Frobenius_map(pwr),
-                                typename policy_type::non_residue_type(policy_type::Frobenius_coeffs_c1[pwr % 4]) *
-                                    data[1].Frobenius_map(pwr));
-                            // return element_fp4(data[0].Frobenius_map(pwr),
-                            //                    policy_type::Frobenius_coeffs_c1[pwr % 4] *
-                            //                    data[1].Frobenius_map(pwr)});
+                            return element_fp4(data[0].Frobenius_map(pwr),
+                                               Frobenius_coeffs_c1[pwr % 4] * data[1].Frobenius_map(pwr));
                         }
 
                         element_fp4 unitary_inversed() const {
@@ -213,8 +210,9 @@ namespace nil {
                             // return *this;
                         }
 
-                        constexpr /*inline static*/ underlying_type mul_by_non_residue(const underlying_type &A) const {
-                            return underlying_type(non_residue * A.data[1], A.data[0]);
+                        /// Multiplies an Fp2 element by its generator, (A0, A1) -> (non_residue * A1, A0)
+                        constexpr inline static underlying_type mul_by_non_residue(const underlying_type &A) {
+                            return underlying_type(non_residue_policy<policy_type>::mul(A.data[1]), A.data[0]);
                         }
 
                         element_fp4 mul_by_023(const element_fp4 &other) const {
@@ -230,12 +228,20 @@ namespace nil {
                             const underlying_type beta_bB = element_fp4::mul_by_non_residue(bB);
                             return element_fp4(aA + beta_bB, (a + b) * (A + B) - aA - bB);
                         }
+
+                    private:
+                        constexpr static const std::array<non_residue_type, 4> Frobenius_coeffs_c1 =
+                            make_Frobenius_coeffs<non_residue_type, 4>(policy_type::Frobenius_coeffs_c1);
                     };
 
                     template<typename FieldParams>
                     constexpr const typename element_fp4<FieldParams>::non_residue_type
                         element_fp4<FieldParams>::non_residue;
 
+                    template<typename FieldParams>
+                    constexpr const std::array<typename element_fp4<FieldParams>::non_residue_type, 4>
+                        element_fp4<FieldParams>::Frobenius_coeffs_c1;
+
                 }    // namespace detail
             }        // namespace fields
         }            // namespace algebra
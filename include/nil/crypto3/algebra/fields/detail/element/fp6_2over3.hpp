@@ -28,6 +28,8 @@
 
 #include <nil/crypto3/algebra/fields/detail/exponentiation.hpp>
 #include <nil/crypto3/algebra/fields/detail/element/operations.hpp>
+#include <nil/crypto3/algebra/fields/detail/element/non_residue_policy.hpp>
+#include <nil/crypto3/algebra/fields/detail/element/frobenius_coeffs.hpp>
 
 #include <nil/crypto3/multiprecision/wnaf.hpp>
 
@@ -167,13 +169,8 @@ namespace nil {
 
                         template<typename PowerType>
                         constexpr element_fp6_2over3 Frobenius_map(const PowerType &pwr) const {
-                            // return element_fp6_2over3(data[0].Frobenius_map(pwr),
-                            //                           policy_type::Frobenius_coeffs_c1[pwr % 6] *
-                            //                           data[1].Frobenius_map(pwr)});
-                            return element_fp6_2over3(
-                                data[0].Frobenius_map(pwr),
-                                typename policy_type::non_residue_type(policy_type::Frobenius_coeffs_c1[pwr % 6]) *
-                                    data[1].Frobenius_map(pwr));
+                            return element_fp6_2over3(data[0].Frobenius_map(pwr),
+                                                      Frobenius_coeffs_c1[pwr % 6] * data[1].Frobenius_map(pwr));
                         }
 
                         constexpr element_fp6_2over3 unitary_inversed() const {
@@ -189,7 +186,9 @@ namespace nil {
                                  * Fields.pdf; Section 3 (Complex squaring) */
                                 const e_fp AB = A * B;
 
-                                return e_fp2 {(A + B) * (A + non_residue * B) - AB - non_residue * AB, AB + AB};
+                                return e_fp2 {(A + B) * (A + non_residue_policy<policy_type>::mul(B)) - AB -
+                                                  non_residue_policy<policy_type>::mul(AB),
+                                              AB + AB};
                             };
 
                             // e_fp2 a(data[0].data[0], data[1].data[1]);
@@ -213,7 +212,7 @@ namespace nil {
 
                             // B = vector(3*Fp2([non_residue*c2[1],c2[0]]) + 2*Fp2([vector(b)[0],-vector(b)[1]]))
                             // my_Fp B_a = my_Fp(3l) * underlying_type::non_residue * csq_b + my_Fp(2l) * b_a;
-                            e_fp B_tmp = non_residue * csq[1];
+                            e_fp B_tmp = non_residue_policy<policy_type>::mul(csq[1]);
                             e_fp B_a = B_tmp + data[1].data[0];
                             B_a = B_a + B_a + B_tmp;
 
@@ -262,8 +261,10 @@ namespace nil {
                             return res;
                         }
 
-                        constexpr /*inline static*/ underlying_type mul_by_non_residue(const underlying_type &A) const {
-                            return underlying_type(non_residue * A.data[2], A.data[0], A.data[1]);
+                        /// Multiplies an Fp3 element by its generator, (A0, A1, A2) -> (non_residue * A2, A0, A1)
+                        constexpr inline static underlying_type mul_by_non_residue(const underlying_type &A) {
+                            return underlying_type(non_residue_policy<policy_type>::mul(A.data[2]), A.data[0],
+                                                   A.data[1]);
                         }
 
                         element_fp6_2over3 mul_by_2345(const element_fp6_2over3 &other) const {
@@ -272,14 +273,19 @@ namespace nil {
 
                             const underlying_type &B = other.data[1], &A = other.data[0], &b = this->data[1],
                                                   &a = this->data[0];
-                            const underlying_type aA = underlying_type(a.data[1] * A.data[2] * non_residue,
-                                                                       a.data[2] * A.data[2] * non_residue,
-                                                                       a.data[0] * A.data[2]);
+                            const underlying_type aA =
+                                underlying_type(non_residue_policy<policy_type>::mul(a.data[1] * A.data[2]),
+                                                non_residue_policy<policy_type>::mul(a.data[2] * A.data[2]),
+                                                a.data[0] * A.data[2]);
                             const underlying_type bB = b * B;
                             const underlying_type beta_bB = element_fp6_2over3::mul_by_non_residue(bB);
 
                             return element_fp6_2over3(aA + beta_bB, (a + b) * (A + B) - aA - bB);
                         }
+
+                    private:
+                        constexpr static const std::array<non_residue_type, 6> Frobenius_coeffs_c1 =
+                            make_Frobenius_coeffs<non_residue_type, 6>(policy_type::Frobenius_coeffs_c1);
                     };
 
                     template<typename FieldParams>
@@ -302,6 +308,10 @@ namespace nil {
                     constexpr const typename element_fp6_2over3<FieldParams>::non_residue_type
                         element_fp6_2over3<FieldParams>::non_residue;
 
+                    template<typename FieldParams>
+                    constexpr const std::array<typename element_fp6_2over3<FieldParams>::non_residue_type, 6>
+                        element_fp6_2over3<FieldParams>::Frobenius_coeffs_c1;
+
                 }    // namespace detail
             }        // namespace fields
         }            // namespace algebra
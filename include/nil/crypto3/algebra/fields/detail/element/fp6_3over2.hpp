@@ -28,6 +28,8 @@
 
 #include <nil/crypto3/algebra/fields/detail/exponentiation.hpp>
 #include <nil/crypto3/algebra/fields/detail/element/operations.hpp>
+#include <nil/crypto3/algebra/fields/detail/element/non_residue_policy.hpp>
+#include <nil/crypto3/algebra/fields/detail/element/frobenius_coeffs.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -126,13 +128,32 @@ namespace nil {
                         }
 
                         constexpr element_fp6_3over2 operator*(const element_fp6_3over2 &B) const {
-                            const underlying_type A0B0 = data[0] * B.data[0], A1B1 = data[1] * B.data[1],
-                                                  A2B2 = data[2] * B.data[2];
-
-                            return element_fp6_3over2(
-                                A0B0 + mul_by_non_residue((data[1] + data[2]) * (B.data[1] + B.data[2]) - A1B1 - A2B2),
-                                (data[0] + data[1]) * (B.data[0] + B.data[1]) - A0B0 - A1B1 + mul_by_non_residue(A2B2),
-                                (data[0] + data[2]) * (B.data[0] + B.data[2]) - A0B0 + A1B1 - A2B2);
+                            typedef typename underlying_type::dbl_type underlying_dbl_type;
+
+                            // Karatsuba with lazy reduction: sums of Fp2 products are reduced once
+                            const underlying_dbl_type A0B0 = underlying_dbl_type::mul(data[0], B.data[0]),
+                                                      A1B1 = underlying_dbl_type::mul(data[1], B.data[1]),
+                                                      A2B2 = underlying_dbl_type::mul(data[2], B.data[2]);
+
+                            const underlying_dbl_type T0 =
+                                underlying_dbl_type::mul(data[1] + data[2], B.data[1] + B.data[2]) - A1B1 - A2B2;
+                            const underlying_dbl_type T1 =
+                                underlying_dbl_type::mul(data[0] + data[1], B.data[0] + B.data[1]) - A0B0 - A1B1;
+                            const underlying_dbl_type T2 =
+                                underlying_dbl_type::mul(data[0] + data[2], B.data[0] + B.data[2]) - A0B0 + A1B1 - A2B2;
+
+                            if constexpr (underlying_dbl_type::template has_lazy_non_residue<
+                                              non_residue_policy<policy_type>>) {
+                                // xi is applied at double width as well: one reduction per coefficient
+                                return element_fp6_3over2(
+                                    (A0B0 + T0.template mul_by_non_residue<non_residue_policy<policy_type>>()).reduce(),
+                                    (T1 + A2B2.template mul_by_non_residue<non_residue_policy<policy_type>>()).reduce(),
+                                    T2.reduce());
+                            } else {
+                                return element_fp6_3over2(A0B0.reduce() + mul_by_non_residue(T0.reduce()),
+                                                          T1.reduce() + mul_by_non_residue(A2B2.reduce()),
+                                                          T2.reduce());
+                            }
                         }
 
                         element_fp6_3over2 sqrt() const {
@@ -184,25 +205,21 @@ namespace nil {
 
                         template<typename PowerType>
                         constexpr element_fp6_3over2 Frobenius_map(const PowerType &pwr) const {
-                            // return element_fp6_3over2(data[0].Frobenius_map(pwr),
-                            //                           policy_type::Frobenius_coeffs_c1[pwr % 6] *
-                            //                           data[1].Frobenius_map(pwr),
-                            //                           policy_type::Frobenius_coeffs_c2[pwr % 6] *
-                            //                           data[2].Frobenius_map(pwr)});
                             return element_fp6_3over2(data[0].Frobenius_map(pwr),
-                                                      typename policy_type::non_residue_type(
-                                                          policy_type::Frobenius_coeffs_c1[(pwr % 6) * 2],
-                                                          policy_type::Frobenius_coeffs_c1[(pwr % 6) * 2 + 1]) *
-                                                          data[1].Frobenius_map(pwr),
-                                                      typename policy_type::non_residue_type(
-                                                          policy_type::Frobenius_coeffs_c2[(pwr % 6) * 2],
-                                                          policy_type::Frobenius_coeffs_c2[(pwr % 6) * 2 + 1]) *
-                                                          data[2].Frobenius_map(pwr));
+                                                      Frobenius_coeffs_c1[pwr % 6] * data[1].Frobenius_map(pwr),
+                                                      Frobenius_coeffs_c2[pwr % 6] * data[2].Frobenius_map(pwr));
                         }
 
-                        constexpr /*inline static*/ underlying_type mul_by_non_residue(const underlying_type &A) const {
-                            return underlying_type(non_residue * A);
+                        /// Multiplies an Fp2 element by the cubic non-residue xi, see non_residue_policy
+                        constexpr inline static underlying_type mul_by_non_residue(const underlying_type &A) {
+                            return non_residue_policy<policy_type>::mul(A);
                         }
+
+                    private:
+                        constexpr static const std::array<non_residue_type, 6> Frobenius_coeffs_c1 =
+                            make_Frobenius_coeffs<non_residue_type, 6>(policy_type::Frobenius_coeffs_c1);
+                        constexpr static const std::array<non_residue_type, 6> Frobenius_coeffs_c2 =
+                            make_Frobenius_coeffs<non_residue_type, 6>(policy_type::Frobenius_coeffs_c2);
                     };
 
                     template<typename FieldParams>
@@ -240,6 +257,14 @@ namespace nil {
                     template<typename FieldParams>
                     constexpr const typename element_fp6_3over2<FieldParams>::non_residue_type
                         element_fp6_3over2<FieldParams>::non_residue;
+
+                    template<typename FieldParams>
+                    constexpr const std::array<typename element_fp6_3over2<FieldParams>::non_residue_type, 6>
+                        element_fp6_3over2<FieldParams>::Frobenius_coeffs_c1;
+
+                    template<typename FieldParams>
+                    constexpr const std::array<typename element_fp6_3over2<FieldParams>::non_residue_type, 6>
+                        element_fp6_3over2<FieldParams>::Frobenius_coeffs_c2;
                 }    // namespace detail
             }        // namespace fields
         }            // namespace algebra
@@ -0,0 +1,188 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_FIELDS_ELEMENT_FP_DBL_HPP
+#define CRYPTO3_ALGEBRA_FIELDS_ELEMENT_FP_DBL_HPP
+
+#include <climits>
+
+#include <nil/crypto3/algebra/fields/detail/element/fp.hpp>
+#include <nil/crypto3/algebra/operation_counters.hpp>
+
+#include <nil/crypto3/multiprecision/number.hpp>
+#include <nil/crypto3/multiprecision/cpp_int.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace fields {
+                namespace detail {
+
+                    /*!
+                     * @brief -p^(-1) mod 2^Bits, computed with Newton iteration x = x * (2 - p * x).
+                     */
+                    template<typename Number>
+                    constexpr Number montgomery_modulus_neg_inverse(const Number &modulus, std::size_t bits) {
+                        const Number mask = (Number(1) << bits) - 1;
+
+                        Number x = 1;
+                        for (std::size_t i = 1; i < bits; i <<= 1) {
+                            x = (x * (((mask + 3) - ((modulus * x) & mask)) & mask)) & mask;
+                        }
+
+                        return ((mask + 1) - x) & mask;
+                    }
+
+                    /*!
+                     * @brief Unreduced double-width product of base field elements.
+                     *
+                     * Holds a sum of products of Montgomery residues aR * bR without reducing it. Sums and
+                     * differences of such products stay exact, so a tower multiplication like
+                     * x0 * z0 + x1 * z1 + x2 * z2 costs three plain multiplications and a single Montgomery
+                     * reduction instead of three (Aranha et al., "Faster explicit formulas for computing
+                     * pairings over ordinary curves"). The Montgomery radix is assumed to be
+                     * 2^montgomery_bits, i.e. a whole number of limbs, as in the modular backend.
+                     */
+                    template<typename FieldParams>
+                    class element_fp_dbl {
+                        typedef FieldParams policy_type;
+
+                    public:
+                        typedef typename policy_type::field_type field_type;
+
+                        typedef element_fp<FieldParams> element_type;
+                        typedef typename policy_type::modular_backend modular_backend;
+
+                        constexpr static const std::size_t limb_bits = sizeof(multiprecision::limb_type) * CHAR_BIT;
+                        constexpr static const std::size_t montgomery_bits =
+                            ((policy_type::modulus_bits + limb_bits - 1) / limb_bits) * limb_bits;
+                        /// Two limbs of headroom above a single product for accumulation
+                        constexpr static const std::size_t data_bits = 2 * montgomery_bits + 2 * limb_bits;
+
+                        typedef multiprecision::number<
+                            multiprecision::backends::cpp_int_backend<data_bits, data_bits,
+                                                                      multiprecision::signed_magnitude,
+                                                                      multiprecision::unchecked, void>>
+                            data_type;
+
+                        constexpr static const data_type modulus = data_type(policy_type::modulus);
+                        constexpr static const data_type montgomery_mask = (data_type(1) << montgomery_bits) - 1;
+                        constexpr static const data_type modulus_neg_inverse =
+                            montgomery_modulus_neg_inverse(modulus, montgomery_bits);
+
+                        data_type data;
+
+                        constexpr element_fp_dbl() : data(0) {};
+
+                        constexpr element_fp_dbl(const data_type &data) : data(data) {};
+
+                        constexpr element_fp_dbl(const element_fp_dbl &B) : data(B.data) {};
+
+                        constexpr element_fp_dbl &operator=(const element_fp_dbl &B) {
+                            data = B.data;
+
+                            return *this;
+                        }
+
+                        /// Unreduced product A * B
+                        constexpr static element_fp_dbl mul(const element_type &A, const element_type &B) {
+                            CRYPTO3_ALGEBRA_COUNT_OPERATION(field_mul);
+                            return element_fp_dbl(residue(A) * residue(B));
+                        }
+
+                        constexpr element_fp_dbl operator+(const element_fp_dbl &B) const {
+                            return element_fp_dbl(data + B.data);
+                        }
+
+                        constexpr element_fp_dbl operator-(const element_fp_dbl &B) const {
+                            return element_fp_dbl(data - B.data);
+                        }
+
+                        constexpr element_fp_dbl &operator+=(const element_fp_dbl &B) {
+                            data += B.data;
+
+                            return *this;
+                        }
+
+                        constexpr element_fp_dbl &operator-=(const element_fp_dbl &B) {
+                            data -= B.data;
+
+                            return *this;
+                        }
+
+                        constexpr element_fp_dbl operator-() const {
+                            return element_fp_dbl(-data);
+                        }
+
+                        /// Montgomery reduction of the accumulated value back to a field element
+                        constexpr element_type reduce() const {
+                            if (data.sign() < 0) {
+                                return -element_fp_dbl(-data).reduce();
+                            }
+
+                            CRYPTO3_ALGEBRA_COUNT_OPERATION(field_reduce);
+
+                            const data_type m = ((data & montgomery_mask) * modulus_neg_inverse) & montgomery_mask;
+                            data_type t = (data + m * modulus) >> montgomery_bits;
+                            // t < data / R + p: a single product needs at most one subtraction, a sum of n
+                            // products can exceed p by about n * p / R and is brought back by one division
+                            if (t >= modulus) {
+                                t -= modulus;
+                                if (t >= modulus) {
+                                    t %= modulus;
+                                }
+                            }
+
+                            element_type result;
+                            result.data.backend().base_data() = multiprecision::number<modular_backend>(t).backend();
+
+                            return result;
+                        }
+
+                    private:
+                        constexpr static data_type residue(const element_type &A) {
+                            return data_type(multiprecision::number<modular_backend>(A.data.backend().base_data()));
+                        }
+                    };
+
+                    template<typename FieldParams>
+                    constexpr typename element_fp_dbl<FieldParams>::data_type const
+                        element_fp_dbl<FieldParams>::modulus;
+
+                    template<typename FieldParams>
+                    constexpr typename element_fp_dbl<FieldParams>::data_type const
+                        element_fp_dbl<FieldParams>::montgomery_mask;
+
+                    template<typename FieldParams>
+                    constexpr typename element_fp_dbl<FieldParams>::data_type const
+                        element_fp_dbl<FieldParams>::modulus_neg_inverse;
+
+                }    // namespace detail
+            }        // namespace fields
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_FIELDS_ELEMENT_FP_DBL_HPP
@@ -0,0 +1,67 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_FIELDS_ELEMENT_FROBENIUS_COEFFS_HPP
+#define CRYPTO3_ALGEBRA_FIELDS_ELEMENT_FROBENIUS_COEFFS_HPP
+
+#include <array>
+#include <cstddef>
+#include <utility>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace fields {
+                namespace detail {
+
+                    template<typename ElementType, std::size_t N, typename IntegralType, std::size_t M,
+                             std::size_t... I>
+                    constexpr std::array<ElementType, N> make_Frobenius_coeffs(const std::array<IntegralType, M> &table,
+                                                                               std::index_sequence<I...>) {
+                        if constexpr (M == N) {
+                            return {{ElementType(table[I])...}};
+                        } else {
+                            return {{ElementType(table[2 * I], table[2 * I + 1])...}};
+                        }
+                    }
+
+                    /// Converts an integral Frobenius coefficient table from the extension params into field
+                    /// elements. Tables over Fp2 keep each coefficient as two consecutive integrals. Element
+                    /// classes keep the result in a constexpr static member, so Frobenius_map neither converts the
+                    /// coefficient into Montgomery form nor goes through a static initialization guard.
+                    template<typename ElementType, std::size_t N, typename IntegralType, std::size_t M>
+                    constexpr std::array<ElementType, N>
+                        make_Frobenius_coeffs(const std::array<IntegralType, M> &table) {
+                        static_assert(M == N || M == 2 * N, "unexpected Frobenius coefficient table size");
+
+                        return make_Frobenius_coeffs<ElementType, N>(table, std::make_index_sequence<N>());
+                    }
+                }    // namespace detail
+            }        // namespace fields
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_FIELDS_ELEMENT_FROBENIUS_COEFFS_HPP
@@ -0,0 +1,119 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_FIELDS_ELEMENT_NON_RESIDUE_POLICY_HPP
+#define CRYPTO3_ALGEBRA_FIELDS_ELEMENT_NON_RESIDUE_POLICY_HPP
+
+#include <cstddef>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace fields {
+                namespace detail {
+
+                    /// Multiplication by the non-residue of the extension described by ExtensionParams.
+                    /// The primary template performs a generic field multiplication; parameter sets whose
+                    /// non-residue is a small constant specialize it (next to their extension params) with
+                    /// one of the additive kernels below.
+                    template<typename ExtensionParams>
+                    struct non_residue_policy {
+                        /// True when mul() only adds, doubles and negates, so it may be applied to
+                        /// unreduced double-width values as well
+                        constexpr static const bool is_additive = false;
+
+                        template<typename ElementType>
+                        constexpr static ElementType mul(const ElementType &A) {
+                            return ElementType(ExtensionParams::non_residue * A);
+                        }
+                    };
+
+                    /// x -> k * x by a left-to-right addition chain over the bits of K
+                    template<std::size_t K>
+                    struct small_non_residue_kernel {
+                        static_assert(K > 0, "non-residue must be non-zero");
+
+                        constexpr static const bool is_additive = true;
+
+                        template<typename ElementType>
+                        constexpr static ElementType mul(const ElementType &A) {
+                            std::size_t top = 0;
+                            while ((K >> (top + 1)) != 0) {
+                                ++top;
+                            }
+
+                            ElementType result = A;
+                            for (std::size_t i = top; i > 0; --i) {
+                                result = result + result;
+                                if ((K >> (i - 1)) & 1) {
+                                    result += A;
+                                }
+                            }
+                            return result;
+                        }
+                    };
+
+                    /// x -> -k * x, e.g. u^2 = -1 (BN, BLS12-381) or u^2 = -5 (BLS12-377)
+                    template<std::size_t K>
+                    struct negated_small_non_residue_kernel {
+                        constexpr static const bool is_additive = true;
+
+                        template<typename ElementType>
+                        constexpr static ElementType mul(const ElementType &A) {
+                            return -small_non_residue_kernel<K>::mul(A);
+                        }
+                    };
+
+                    /// (a + b * u) -> (a + b * u) * (k + u) over a quadratic extension with u^2 = -1:
+                    /// (k * a - b) + (a + k * b) * u. Covers xi = 9 + u (BN) and xi = 1 + u (BLS12-381).
+                    template<std::size_t K>
+                    struct k_plus_u_non_residue_kernel {
+                        constexpr static const bool is_additive = true;
+
+                        template<typename ElementType>
+                        constexpr static ElementType mul(const ElementType &A) {
+                            return ElementType(small_non_residue_kernel<K>::mul(A.data[0]) - A.data[1],
+                                               A.data[0] + small_non_residue_kernel<K>::mul(A.data[1]));
+                        }
+                    };
+
+                    /// (a + b * u) -> (a + b * u) * u = (b * u^2) + a * u, where multiplication by u^2 is
+                    /// itself the quadratic extension's non-residue kernel. Covers xi = u (BLS12-377).
+                    template<typename QuadraticKernel>
+                    struct u_non_residue_kernel {
+                        constexpr static const bool is_additive = QuadraticKernel::is_additive;
+
+                        template<typename ElementType>
+                        constexpr static ElementType mul(const ElementType &A) {
+                            return ElementType(QuadraticKernel::mul(A.data[1]), A.data[0]);
+                        }
+                    };
+                }    // namespace detail
+            }        // namespace fields
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_FIELDS_ELEMENT_NON_RESIDUE_POLICY_HPP
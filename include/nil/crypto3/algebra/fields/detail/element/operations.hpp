@@ -26,13 +26,81 @@
 #ifndef CRYPTO3_ALGEBRA_FIELDS_ELEMENT_OPERATIONS_HPP
 #define CRYPTO3_ALGEBRA_FIELDS_ELEMENT_OPERATIONS_HPP
 
+#include <cstddef>
+#include <type_traits>
+
 #include <nil/crypto3/algebra/type_traits.hpp>
 
 namespace nil {
     namespace crypto3 {
         namespace algebra {
             namespace fields {
+
+                /*!
+                 * @brief Multiplication by the small constant K through an addition chain: log2(K) doublings and
+                 * popcount(K) - 1 additions instead of converting K to Montgomery form and a full multiplication.
+                 */
+                template<std::size_t K, typename FieldElement>
+                constexpr FieldElement mul_small(const FieldElement &A) {
+                    if constexpr (K == 0) {
+                        return FieldElement::zero();
+                    } else if constexpr (K == 1) {
+                        return A;
+                    } else if constexpr (K % 2 == 0) {
+                        const FieldElement half = mul_small<K / 2>(A);
+                        return half + half;
+                    } else {
+                        return mul_small<K - 1>(A) + A;
+                    }
+                }
+
                 namespace detail {
+                    /// Built-in integers below this magnitude are multiplied through an addition chain. The chain
+                    /// for k < 2^6 takes at most ten additions, while the general path converts k to Montgomery form
+                    /// and multiplies, i.e. costs two full multiplications; see field_mul_integral in the benchmarks
+                    constexpr const unsigned long long mul_small_bound = 1ull << 6;
+
+                    /// @private
+                    /// Runtime counterpart of mul_small<K>, left-to-right double-and-add over the bits of k
+                    template<typename FieldElement>
+                    constexpr FieldElement mul_small(const FieldElement &A, unsigned long long k) {
+                        if (k == 0) {
+                            return FieldElement::zero();
+                        }
+
+                        std::size_t bit = 0;
+                        while ((k >> (bit + 1)) != 0) {
+                            ++bit;
+                        }
+
+                        FieldElement result = A;
+                        while (bit-- > 0) {
+                            result = result + result;
+                            if ((k >> bit) & 1) {
+                                result = result + A;
+                            }
+                        }
+                        return result;
+                    }
+
+                    /// @private
+                    /// B * A where B is a constant of any type FieldElement is constructible from: small built-in
+                    /// integers go through the addition chain, anything else through a full multiplication
+                    template<typename FieldElement, typename Integral>
+                    constexpr FieldElement mul_integral(const FieldElement &A, const Integral &B) {
+                        if constexpr (std::is_integral<Integral>::value) {
+                            const bool negative = std::is_signed<Integral>::value && B < Integral(0);
+                            const unsigned long long magnitude = negative ?
+                                                                     0ull - static_cast<unsigned long long>(B) :
+                                                                     static_cast<unsigned long long>(B);
+                            if (magnitude < mul_small_bound) {
+                                const FieldElement result = mul_small(A, magnitude);
+                                return negative ? -result : result;
+                            }
+                        }
+                        return A * FieldElement(B);
+                    }
+
                     template<typename FieldElement, typename Integral,
                              typename = typename std::enable_if<is_field_element<FieldElement>::value &&
                                                      std::is_constructible<FieldElement, Integral>::value>::type>
@@ -51,7 +119,7 @@ namespace nil {
                              typename = typename std::enable_if<is_field_element<FieldElement>::value &&
                                                      std::is_constructible<FieldElement, Integral>::value>::type>
                     constexpr FieldElement operator*(const FieldElement &A, Integral B) {
-                        return A * FieldElement(B);
+                        return mul_integral(A, B);
                     }
 
                     template<typename FieldElement, typename Integral,
@@ -80,7 +148,7 @@ namespace nil {
                              typename = typename std::enable_if<is_field_element<FieldElement>::value &&
                                  std::is_constructible<FieldElement, Integral>::value>::type>
                     constexpr FieldElement operator*(Integral A, const FieldElement &B) {
-                        return FieldElement(A) * B;
+                        return mul_integral(B, A);
                     }
 
                     template<typename FieldElement, typename Integral,
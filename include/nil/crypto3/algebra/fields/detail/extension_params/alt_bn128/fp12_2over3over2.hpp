@@ -30,6 +30,7 @@
 #include <nil/crypto3/algebra/fields/alt_bn128/base_field.hpp>
 #include <nil/crypto3/algebra/fields/fp6_3over2.hpp>
 #include <nil/crypto3/algebra/fields/fp2.hpp>
+#include <nil/crypto3/algebra/fields/detail/element/non_residue_policy.hpp>
 
 #include <nil/crypto3/detail/literals.hpp>
 
@@ -132,6 +133,10 @@ namespace nil {
                         12 * 2> const
                         fp12_2over3over2_extension_params<alt_bn128_base_field<Version>>::Frobenius_coeffs_c1;
 
+                    /// w^2 = v, v^3 = 9 + u
+                    template<std::size_t Version>
+                    struct non_residue_policy<fp12_2over3over2_extension_params<fields::alt_bn128<Version>>>
+                        : public k_plus_u_non_residue_kernel<9> {};
                 }    // namespace detail
             }        // namespace fields
         }            // namespace algebra
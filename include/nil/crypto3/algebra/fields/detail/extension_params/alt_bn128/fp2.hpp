@@ -28,6 +28,7 @@
 
 #include <nil/crypto3/algebra/fields/params.hpp>
 #include <nil/crypto3/algebra/fields/alt_bn128/base_field.hpp>
+#include <nil/crypto3/algebra/fields/detail/element/non_residue_policy.hpp>
 
 #include <nil/crypto3/detail/literals.hpp>
 
@@ -120,6 +121,11 @@ namespace nil {
                     constexpr std::array<typename fp2_extension_params<alt_bn128_base_field<Version>>::integral_type,
                                          2> const
                         fp2_extension_params<alt_bn128_base_field<Version>>::Frobenius_coeffs_c1;
+
+                    /// u^2 = -1
+                    template<std::size_t Version>
+                    struct non_residue_policy<fp2_extension_params<fields::alt_bn128<Version>>>
+                        : public negated_small_non_residue_kernel<1> {};
                 }    // namespace detail
             }        // namespace fields
         }            // namespace algebra
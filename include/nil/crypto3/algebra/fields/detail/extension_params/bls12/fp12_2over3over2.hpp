@@ -30,6 +30,7 @@
 #include <nil/crypto3/algebra/fields/bls12/base_field.hpp>
 #include <nil/crypto3/algebra/fields/fp6_3over2.hpp>
 #include <nil/crypto3/algebra/fields/fp2.hpp>
+#include <nil/crypto3/algebra/fields/detail/element/non_residue_policy.hpp>
 
 #include <nil/crypto3/detail/literals.hpp>
 
@@ -207,6 +208,16 @@ namespace nil {
                     constexpr std::array<
                         typename fp12_2over3over2_extension_params<bls12_base_field<377>>::integral_type, 12 * 2> const
                         fp12_2over3over2_extension_params<bls12_base_field<377>>::Frobenius_coeffs_c1;
+
+                    /// w^2 = v, v^3 = 1 + u
+                    template<>
+                    struct non_residue_policy<fp12_2over3over2_extension_params<fields::bls12<381>>>
+                        : public k_plus_u_non_residue_kernel<1> {};
+
+                    /// w^2 = v, v^3 = u
+                    template<>
+                    struct non_residue_policy<fp12_2over3over2_extension_params<fields::bls12<377>>>
+                        : public u_non_residue_kernel<negated_small_non_residue_kernel<5>> {};
                 }    // namespace detail
             }        // namespace fields
         }            // namespace algebra
@@ -28,6 +28,7 @@
 
 #include <nil/crypto3/algebra/fields/params.hpp>
 #include <nil/crypto3/algebra/fields/bls12/base_field.hpp>
+#include <nil/crypto3/algebra/fields/detail/element/non_residue_policy.hpp>
 
 #include <nil/crypto3/detail/literals.hpp>
 
@@ -174,6 +175,15 @@ namespace nil {
                     constexpr std::array<typename fp2_extension_params<bls12_base_field<377>>::integral_type, 2> const
                         fp2_extension_params<bls12_base_field<377>>::Frobenius_coeffs_c1;
 
+                    /// u^2 = -1
+                    template<>
+                    struct non_residue_policy<fp2_extension_params<fields::bls12<381>>>
+                        : public negated_small_non_residue_kernel<1> {};
+
+                    /// u^2 = -5
+                    template<>
+                    struct non_residue_policy<fp2_extension_params<fields::bls12<377>>>
+                        : public negated_small_non_residue_kernel<5> {};
                 }    // namespace detail
             }        // namespace fields
         }            // namespace algebra
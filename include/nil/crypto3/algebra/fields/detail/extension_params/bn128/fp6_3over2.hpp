@@ -29,6 +29,7 @@
 #include <nil/crypto3/algebra/fields/params.hpp>
 #include <nil/crypto3/algebra/fields/bn128/base_field.hpp>
 #include <nil/crypto3/algebra/fields/fp2.hpp>
+#include <nil/crypto3/algebra/fields/detail/element/non_residue_policy.hpp>
 
 #include <nil/crypto3/detail/literals.hpp>
 
@@ -98,6 +99,10 @@ namespace nil {
                                          6 * 2> const
                         fp6_3over2_extension_params<bn128_base_field<Version>>::Frobenius_coeffs_c2;
 
+                    /// v^3 = 9 + u
+                    template<std::size_t Version>
+                    struct non_residue_policy<fp6_3over2_extension_params<fields::bn128<Version>>>
+                        : public k_plus_u_non_residue_kernel<9> {};
                 }    // namespace detail
             }        // namespace fields
         }            // namespace algebra
@@ -28,6 +28,7 @@
 
 #include <nil/crypto3/algebra/fields/params.hpp>
 #include <nil/crypto3/algebra/fields/edwards/base_field.hpp>
+#include <nil/crypto3/algebra/fields/detail/element/non_residue_policy.hpp>
 
 #include <nil/crypto3/detail/literals.hpp>
 
@@ -136,6 +137,10 @@ namespace nil {
                                          3> const
                         fp3_extension_params<edwards_base_field<Version>>::Frobenius_coeffs_c2;
 
+                    /// u^3 = 61
+                    template<std::size_t Version>
+                    struct non_residue_policy<fp3_extension_params<fields::edwards_base_field<Version>>>
+                        : public small_non_residue_kernel<0x3D> {};
                 }    // namespace detail
             }        // namespace fields
         }            // namespace algebra
@@ -29,6 +29,7 @@
 #include <nil/crypto3/algebra/fields/params.hpp>
 #include <nil/crypto3/algebra/fields/edwards/base_field.hpp>
 #include <nil/crypto3/algebra/fields/fp3.hpp>
+#include <nil/crypto3/algebra/fields/detail/element/non_residue_policy.hpp>
 
 #include <nil/crypto3/detail/literals.hpp>
 
@@ -92,6 +93,11 @@ namespace nil {
                     constexpr std::array<
                         typename fp6_2over3_extension_params<edwards_base_field<Version>>::integral_type, 6> const
                         fp6_2over3_extension_params<edwards_base_field<Version>>::Frobenius_coeffs_c1;
+
+                    /// w^2 = u, u^3 = 61
+                    template<std::size_t Version>
+                    struct non_residue_policy<fp6_2over3_extension_params<fields::edwards_base_field<Version>>>
+                        : public small_non_residue_kernel<0x3D> {};
                 }    // namespace detail
             }        // namespace fields
         }            // namespace algebra
@@ -28,6 +28,7 @@
 
 #include <nil/crypto3/algebra/fields/params.hpp>
 #include <nil/crypto3/algebra/fields/mnt4/base_field.hpp>
+#include <nil/crypto3/algebra/fields/detail/element/non_residue_policy.hpp>
 
 #include <nil/crypto3/detail/literals.hpp>
 
@@ -123,6 +124,11 @@ namespace nil {
                     template<std::size_t Version>
                     constexpr std::array<typename fp2_extension_params<mnt4_base_field<Version>>::integral_type,
                                          2> const fp2_extension_params<mnt4_base_field<Version>>::Frobenius_coeffs_c1;
+
+                    /// u^2 = 17
+                    template<std::size_t Version>
+                    struct non_residue_policy<fp2_extension_params<fields::mnt4_base_field<Version>>>
+                        : public small_non_residue_kernel<0x11> {};
                 }    // namespace detail
             }        // namespace fields
         }            // namespace algebra
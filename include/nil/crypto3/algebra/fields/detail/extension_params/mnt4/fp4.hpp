@@ -29,6 +29,7 @@
 #include <nil/crypto3/algebra/fields/params.hpp>
 #include <nil/crypto3/algebra/fields/mnt4/base_field.hpp>
 #include <nil/crypto3/algebra/fields/fp2.hpp>
+#include <nil/crypto3/algebra/fields/detail/element/non_residue_policy.hpp>
 
 #include <nil/crypto3/detail/literals.hpp>
 
@@ -87,6 +88,10 @@ namespace nil {
                     constexpr std::array<typename fp4_extension_params<mnt4_base_field<Version>>::integral_type,
                                          4> const fp4_extension_params<mnt4_base_field<Version>>::Frobenius_coeffs_c1;
 
+                    /// w^2 = u, u^2 = 17
+                    template<std::size_t Version>
+                    struct non_residue_policy<fp4_extension_params<fields::mnt4_base_field<Version>>>
+                        : public small_non_residue_kernel<0x11> {};
                 }    // namespace detail
             }        // namespace fields
         }            // namespace algebra
@@ -0,0 +1,125 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_FIXED_BASE_MUL_HPP
+#define CRYPTO3_ALGEBRA_FIXED_BASE_MUL_HPP
+
+#include <cstddef>
+#include <vector>
+
+#include <nil/crypto3/multiprecision/number.hpp>
+#include <nil/crypto3/multiprecision/cpp_int.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+
+            /*!
+             * @brief Comb-style table of a fixed base for multiplication without doublings.
+             *
+             * For every window i of Window bits the table holds j * 2^(Window * i) * base for j = 1..2^(Window-1).
+             * Scalars are recoded to signed digits in [-2^(Window-1), 2^(Window-1)], so a multiplication is one
+             * table addition or subtraction per window: 33 additions for a 256-bit scalar with the default
+             * window, instead of about 256 doublings and 128 additions of the double-and-add scalar_mul.
+             */
+            template<typename GroupType,
+#ifdef LOWMEM
+                     std::size_t Window = 5
+#else
+                     std::size_t Window = 8
+#endif
+                     >
+            class fixed_base_table {
+                typedef typename GroupType::curve_type::scalar_field_type scalar_field_type;
+                typedef typename scalar_field_type::integral_type integral_type;
+
+            public:
+                typedef GroupType group_type;
+                typedef typename group_type::value_type value_type;
+                typedef typename scalar_field_type::value_type scalar_value_type;
+
+                constexpr static const std::size_t window = Window;
+                /// One extra bit absorbs the carry of the signed recoding
+                constexpr static const std::size_t windows_count = (scalar_field_type::modulus_bits + window) / window;
+
+                explicit fixed_base_table(const value_type &base) :
+                    table(windows_count, std::vector<value_type>(std::size_t(1) << (window - 1))) {
+                    value_type outer = base;
+                    for (std::size_t i = 0; i < windows_count; ++i) {
+                        table[i][0] = outer;
+                        for (std::size_t j = 1; j < table[i].size(); ++j) {
+                            table[i][j] = table[i][j - 1] + outer;
+                        }
+                        // 2^(Window-1) * outer is the last entry, one more doubling gives the next window's base
+                        outer = table[i].back().doubled();
+                    }
+                }
+
+                /// Table of value_type::one(), built on first use and shared by all threads
+                static const fixed_base_table &generator() {
+                    static const fixed_base_table table(value_type::one());
+                    return table;
+                }
+
+                value_type mul(const scalar_value_type &scalar) const {
+                    const integral_type k = scalar.data.template convert_to<integral_type>();
+
+                    value_type result = value_type::zero();
+                    std::size_t carry = 0;
+                    for (std::size_t i = 0; i < windows_count; ++i) {
+                        std::size_t digit = carry;
+                        for (std::size_t b = 0; b < window; ++b) {
+                            if (i * window + b < scalar_field_type::modulus_bits &&
+                                multiprecision::bit_test(k, i * window + b)) {
+                                digit += std::size_t(1) << b;
+                            }
+                        }
+
+                        // digit in [0, 2^Window]; the upper half becomes digit - 2^Window with a carry
+                        carry = digit > (std::size_t(1) << (window - 1)) ? 1 : 0;
+                        const std::size_t magnitude = carry ? (std::size_t(1) << window) - digit : digit;
+                        if (magnitude != 0) {
+                            result = carry ? result - table[i][magnitude - 1] : result + table[i][magnitude - 1];
+                        }
+                    }
+
+                    return result;
+                }
+
+            private:
+                std::vector<std::vector<value_type>> table;
+            };
+
+            /// scalar * value_type::one() through the shared generator table of the group
+            template<typename GroupType>
+            typename GroupType::value_type
+                fixed_base_mul(const typename GroupType::curve_type::scalar_field_type::value_type &scalar) {
+                return fixed_base_table<GroupType>::generator().mul(scalar);
+            }
+        }    // namespace algebra
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_FIXED_BASE_MUL_HPP
@@ -0,0 +1,307 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_MATRIX_DENSE_MATRIX_HPP
+#define CRYPTO3_ALGEBRA_MATRIX_DENSE_MATRIX_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include <boost/assert.hpp>
+
+#include <nil/crypto3/algebra/matrix/matrix.hpp>
+#include <nil/crypto3/algebra/matrix/math.hpp>
+
+#include <nil/crypto3/detail/parallel_for.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            /** \addtogroup matrix
+             *  @{
+             */
+
+            /** @brief A runtime-sized matrix of field elements
+             *    @tparam T field element type
+             *
+             *    `dense_matrix` stores its elements row-major in a single heap buffer. It complements the
+             *    compile-time sized `matrix` for systems whose dimensions are only known at runtime, runtime
+             *    vectors are plain `std::vector<T>`. `m[i][j]` accesses the element in row i and column j.
+             */
+            template<typename T>
+            class dense_matrix {
+            public:
+                using value_type = T;
+                using size_type = std::size_t;
+
+                dense_matrix() : m_rows(0), m_cols(0) {
+                }
+
+                /// Matrix of the given dimensions filled with value
+                dense_matrix(size_type rows, size_type cols, const value_type &value = value_type::zero()) :
+                    m_rows(rows), m_cols(cols), m_elements(rows * cols, value) {
+                }
+
+                template<std::size_t N, std::size_t M>
+                explicit dense_matrix(const matrix<T, N, M> &m) : m_rows(N), m_cols(M), m_elements(N * M) {
+                    for (size_type i = 0; i < N; ++i) {
+                        std::copy(m[i], m[i] + M, (*this)[i]);
+                    }
+                }
+
+                static dense_matrix identity(size_type size) {
+                    dense_matrix result(size, size);
+                    for (size_type i = 0; i < size; ++i) {
+                        result[i][i] = value_type::one();
+                    }
+                    return result;
+                }
+
+                size_type rows() const {
+                    return m_rows;
+                }
+
+                size_type cols() const {
+                    return m_cols;
+                }
+
+                /// Pointer to the first element of row i
+                value_type *operator[](size_type i) {
+                    return m_elements.data() + i * m_cols;
+                }
+
+                /// @copydoc operator[]
+                const value_type *operator[](size_type i) const {
+                    return m_elements.data() + i * m_cols;
+                }
+
+                std::vector<value_type> row(size_type i) const {
+                    BOOST_ASSERT(i < m_rows);
+                    return std::vector<value_type>((*this)[i], (*this)[i] + m_cols);
+                }
+
+                std::vector<value_type> column(size_type j) const {
+                    BOOST_ASSERT(j < m_cols);
+                    std::vector<value_type> result(m_rows);
+                    for (size_type i = 0; i < m_rows; ++i) {
+                        result[i] = (*this)[i][j];
+                    }
+                    return result;
+                }
+
+                value_type *data() {
+                    return m_elements.data();
+                }
+
+                const value_type *data() const {
+                    return m_elements.data();
+                }
+
+                bool operator==(const dense_matrix &other) const {
+                    return m_rows == other.m_rows && m_cols == other.m_cols && m_elements == other.m_elements;
+                }
+
+                bool operator!=(const dense_matrix &other) const {
+                    return !(*this == other);
+                }
+
+            private:
+                size_type m_rows;
+                size_type m_cols;
+                std::vector<value_type> m_elements;
+            };
+
+            /** @brief computes the transpose
+             *  @param m an \f$ M \times N \f$ dense_matrix
+             *  @return the \f$ N \times M \f$ transpose of m
+             */
+            template<typename T>
+            dense_matrix<T> transpose(const dense_matrix<T> &m) {
+                dense_matrix<T> result(m.cols(), m.rows());
+                for (std::size_t i = 0; i < m.rows(); ++i) {
+                    for (std::size_t j = 0; j < m.cols(); ++j) {
+                        result[j][i] = m[i][j];
+                    }
+                }
+                return result;
+            }
+
+            /** @brief computes the matrix product
+             *  @param a an \f$M \times N\f$ dense_matrix
+             *  @param b an \f$N \times P\f$ dense_matrix
+             *  @param threads_count number of threads sharing the row blocks of the result
+             *  @return the \f$ M \times P \f$ product ab
+             *
+             *  Same blocked kernel as the field matmul of `matrix`: b is transposed once and every entry is a
+             *  contiguous dot product reduced once.
+             */
+            template<typename T>
+            dense_matrix<T> matmul(const dense_matrix<T> &a, const dense_matrix<T> &b, std::size_t threads_count = 1) {
+                BOOST_ASSERT(a.cols() == b.rows());
+
+                constexpr std::size_t block = detail::field_matmul_block_size;
+                const std::size_t rows = a.rows(), cols = b.cols(), inner = a.cols();
+                const dense_matrix<T> bt = transpose(b);
+                dense_matrix<T> result(rows, cols);
+
+                crypto3::detail::parallel_for(
+                    0, (rows + block - 1) / block, threads_count, [&](std::size_t begin, std::size_t end) {
+                        for (std::size_t ib = begin * block; ib < std::min(end * block, rows); ib += block) {
+                            const std::size_t ie = std::min(ib + block, rows);
+                            for (std::size_t jb = 0; jb < cols; jb += block) {
+                                const std::size_t je = std::min(jb + block, cols);
+                                for (std::size_t i = ib; i < ie; ++i) {
+                                    for (std::size_t j = jb; j < je; ++j) {
+                                        result[i][j] = detail::field_dot(a[i], bt[j], inner);
+                                    }
+                                }
+                            }
+                        }
+                    });
+
+                return result;
+            }
+
+            /*!
+             * @brief computes the product of matrix and vector
+             * @param m an \f$M \times N\f$ dense_matrix
+             * @param v an N-vector
+             * @param threads_count number of threads sharing the rows of m
+             * @return an M-vector
+             */
+            template<typename T>
+            std::vector<T> matvectmul(const dense_matrix<T> &m, const std::vector<T> &v,
+                                      std::size_t threads_count = 1) {
+                BOOST_ASSERT(m.cols() == v.size());
+
+                std::vector<T> result(m.rows());
+                crypto3::detail::parallel_for(0, m.rows(), threads_count, [&](std::size_t begin, std::size_t end) {
+                    for (std::size_t i = begin; i < end; ++i) {
+                        result[i] = detail::field_dot(m[i], v.data(), m.cols());
+                    }
+                });
+                return result;
+            }
+
+            /*!
+             * @brief computes the product of vector and matrix
+             * @param v an M-vector
+             * @param m an \f$M \times N\f$ dense_matrix
+             * @return an N-vector
+             */
+            template<typename T>
+            std::vector<T> vectmatmul(const std::vector<T> &v, const dense_matrix<T> &m) {
+                return matvectmul(transpose(m), v);
+            }
+
+            /** @brief Compute the reduced row echelon form
+             *  @param m a dense_matrix of field elements
+             *  @return the reduced row echelon form of m
+             */
+            template<typename T>
+            dense_matrix<T> rref(dense_matrix<T> m) {
+                T det = T::one();
+                detail::field_gauss_jordan(m, m.rows(), m.cols(), det);
+                return m;
+            }
+
+            /** @brief Compute the rank
+             *  @param m a dense_matrix of field elements
+             *  @return the rank of m
+             */
+            template<typename T>
+            std::size_t rank(dense_matrix<T> m) {
+                T det = T::one();
+                return detail::field_gauss_jordan(m, m.rows(), m.cols(), det);
+            }
+
+            /** @brief Compute the determinant
+             *  @param m a square dense_matrix of field elements
+             *  @return the determinant of m
+             */
+            template<typename T>
+            T det(dense_matrix<T> m) {
+                BOOST_ASSERT(m.rows() == m.cols());
+
+                T result = T::one();
+                detail::field_gauss_jordan(m, m.rows(), m.cols(), result);
+                return result;
+            }
+
+            /** @brief computes the matrix inverse
+             *  @param m a square dense_matrix of field elements
+             *  @return the inverse of m
+             *
+             *  Eliminates \f$ \left[\textbf{m} | \textbf{I}\right] \f$ once and throws if m is singular.
+             */
+            template<typename T>
+            dense_matrix<T> inverse(const dense_matrix<T> &m) {
+                BOOST_ASSERT(m.rows() == m.cols());
+
+                const std::size_t size = m.rows();
+                dense_matrix<T> augmented(size, 2 * size);
+                for (std::size_t i = 0; i < size; ++i) {
+                    std::copy(m[i], m[i] + size, augmented[i]);
+                    augmented[i][size + i] = T::one();
+                }
+
+                T det = T::one();
+                detail::field_gauss_jordan(augmented, size, 2 * size, det);
+                // m is invertible iff the left half was reduced to the identity
+                for (std::size_t i = 0; i < size; ++i) {
+                    if (augmented[i][i] != T::one())
+                        throw "matrix is not invertible";
+                }
+
+                dense_matrix<T> result(size, size);
+                for (std::size_t i = 0; i < size; ++i) {
+                    std::copy(augmented[i] + size, augmented[i] + 2 * size, result[i]);
+                }
+                return result;
+            }
+
+            /** @brief computes the trace
+             *  @param m a square dense_matrix
+             *  @return the sum of the diagonal of m
+             */
+            template<typename T>
+            T trace(const dense_matrix<T> &m) {
+                BOOST_ASSERT(m.rows() == m.cols());
+
+                T result = T::zero();
+                for (std::size_t i = 0; i < m.rows(); ++i) {
+                    result = result + m[i][i];
+                }
+                return result;
+            }
+
+            /** }@*/
+
+        }    // namespace algebra
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_MATRIX_DENSE_MATRIX_HPP
@@ -28,6 +28,9 @@
 #define CRYPTO3_ALGEBRA_MATRIX_MATH_HPP
 
 #include <algorithm>
+#include <type_traits>
+
+#include <nil/crypto3/algebra/type_traits.hpp>
 
 #include <nil/crypto3/detail/assert.hpp>
 
@@ -35,6 +38,7 @@
 #include <nil/crypto3/algebra/vector/math.hpp>
 
 #include <nil/crypto3/algebra/matrix/matrix.hpp>
+#include <nil/crypto3/algebra/matrix/operators.hpp>
 #include <nil/crypto3/algebra/matrix/utility.hpp>
 
 #include <nil/crypto3/algebra/scalar/math.hpp>
@@ -106,17 +110,77 @@ namespace nil {
                 return transpose(conj(m));
             }
 
+            namespace detail {
+                /// @private
+                template<typename T, typename = void>
+                struct has_dbl_type : std::false_type { };
+
+                /// @private
+                template<typename T>
+                struct has_dbl_type<T, std::void_t<typename T::dbl_type>> : std::true_type { };
+
+                /// @private
+                /// Tile edge of the blocked field matmul, keeps a block of rows of both operands in L1
+                constexpr std::size_t field_matmul_block_size = 8;
+
+                /// @private
+                /// Dot product of two contiguous ranges of field elements. Elements with an unreduced product
+                /// type (element_fp, element_fp2) accumulate at double width and are reduced once.
+                template<typename T>
+                constexpr T field_dot(const T *a, const T *b, std::size_t n) {
+                    if constexpr (has_dbl_type<T>::value) {
+                        typename T::dbl_type acc;
+                        for (std::size_t k = 0; k < n; ++k) {
+                            acc += T::dbl_type::mul(a[k], b[k]);
+                        }
+                        return acc.reduce();
+                    } else {
+                        T acc = T::zero();
+                        for (std::size_t k = 0; k < n; ++k) {
+                            acc = acc + a[k] * b[k];
+                        }
+                        return acc;
+                    }
+                }
+
+                /// @private
+                template<typename T, std::size_t M, std::size_t N, std::size_t P>
+                constexpr matrix<T, M, P> field_matmul(const matrix<T, M, N> &a, const matrix<T, N, P> &b) {
+                    // Transposing b makes both operands of every dot product contiguous
+                    const matrix<T, P, N> bt = transpose(b);
+
+                    matrix<T, M, P> result {};
+                    for (std::size_t ib = 0; ib < M; ib += field_matmul_block_size) {
+                        const std::size_t ie = std::min(ib + field_matmul_block_size, M);
+                        for (std::size_t jb = 0; jb < P; jb += field_matmul_block_size) {
+                            const std::size_t je = std::min(jb + field_matmul_block_size, P);
+                            for (std::size_t i = ib; i < ie; ++i) {
+                                for (std::size_t j = jb; j < je; ++j) {
+                                    result[i][j] = field_dot(a[i], bt[j], N);
+                                }
+                            }
+                        }
+                    }
+                    return result;
+                }
+            }    // namespace detail
+
             /** @brief computes the matrix product
              *  @param a an \f$M \times N\f$ matrix
              *  @param b an \f$N \times P\f$ matrix
              *  @return an \f$ M \times P \f$ matrix \f$ \textbf{a}\textbf{b} \f$ of type T such that
              *  \f$ \left(\textbf{ab}\right)_{ij} = \sum\limits_{k=1}^{N}\textbf{a}_{ik}\textbf{b}_{kj} \f$
              *
-             *  Computes the product of two matrices.
+             *  Computes the product of two matrices. Over a field the product is computed by a blocked kernel
+             *  on the transposed b, with each entry reduced once.
              */
             template<typename T, std::size_t M, std::size_t N, std::size_t P>
             constexpr matrix<T, M, P> matmul(const matrix<T, M, N> &a, const matrix<T, N, P> &b) {
-                return generate<M, P>([&a, &b](auto i, auto j) { return algebra::sum(a.row(i) * b.column(j)); });
+                if constexpr (is_field_element<T>::value) {
+                    return detail::field_matmul(a, b);
+                } else {
+                    return generate<M, P>([&a, &b](auto i, auto j) { return algebra::sum(a.row(i) * b.column(j)); });
+                }
             }
 
             /*!
@@ -127,7 +191,12 @@ namespace nil {
              */
             template<typename T, std::size_t M, std::size_t N>
             constexpr vector<T, N> vectmatmul(const vector<T, M> &v, const matrix<T, M, N> &m) {
-                return generate<N>([&v, &m](auto i) { return sum(v * m.column(i)); });
+                if constexpr (is_field_element<T>::value) {
+                    const matrix<T, N, M> mt = transpose(m);
+                    return generate<N>([&v, &mt](auto i) { return detail::field_dot(&v[0], mt[i], M); });
+                } else {
+                    return generate<N>([&v, &m](auto i) { return sum(v * m.column(i)); });
+                }
             }
 
             /*!
@@ -138,7 +207,29 @@ namespace nil {
              */
             template<typename T, std::size_t M, std::size_t N>
             constexpr vector<T, M> matvectmul(const matrix<T, M, N> &m, const vector<T, N> &v) {
-                return generate<M>([&v, &m](auto i) { return sum(m.row(i) * v); });
+                if constexpr (is_field_element<T>::value) {
+                    return generate<M>([&v, &m](auto i) { return detail::field_dot(m[i], &v[0], N); });
+                } else {
+                    return generate<M>([&v, &m](auto i) { return sum(m.row(i) * v); });
+                }
+            }
+
+            /*!
+             * @brief applies the same matrix to a batch of vectors
+             * @param m an \f$M \times N\f$ matrix
+             * @param first, last the range of N-vectors
+             * @param out the beginning of the destination range of M-vectors, may be equal to first when M == N
+             * @return the end of the destination range
+             *
+             * Intended for permutations applying a fixed (MDS) matrix to many states.
+             */
+            template<typename T, std::size_t M, std::size_t N, typename InputIterator, typename OutputIterator>
+            OutputIterator batch_matvectmul(const matrix<T, M, N> &m, InputIterator first, InputIterator last,
+                                            OutputIterator out) {
+                for (; first != last; ++first, ++out) {
+                    *out = matvectmul(m, *first);
+                }
+                return out;
             }
 
             /** @brief Computes the kronecker tensor product
@@ -241,11 +332,86 @@ namespace nil {
                 return {m, rank, det};
             }
 
+            namespace detail {
+                /// @private
+                /// Exact Gauss-Jordan elimination over a field of the rows x cols matrix m, indexable as m[i][j]:
+                /// any nonzero element is a valid pivot, the pivot row is scaled by a single inversion and only
+                /// the columns right of the pivot are updated. Returns the rank, det receives the determinant.
+                template<typename T, typename Matrix>
+                constexpr std::size_t field_gauss_jordan(Matrix &m, std::size_t rows, std::size_t cols, T &det) {
+                    const T zero = T::zero(), one = T::one();
+
+                    det = one;
+                    std::size_t rank = 0;
+                    std::size_t i = 0, j = 0;
+                    while (i < rows && j < cols) {
+                        // Take the first nonzero element of the column as pivot
+                        std::size_t ip = i;
+                        while (ip < rows && m[ip][j] == zero) {
+                            ++ip;
+                        }
+                        if (ip == rows) {
+                            ++j;
+                            continue;
+                        }
+                        if (ip != i) {
+                            for (std::size_t jp = j; jp < cols; ++jp) {
+                                auto tmp = m[ip][jp];
+                                m[ip][jp] = m[i][jp];
+                                m[i][jp] = tmp;
+                            }
+                            det = -det;
+                        }
+
+                        // Scale m_ij to 1 with one inversion
+                        const T s = m[i][j];
+                        det = det * s;
+                        const T s_inv = s.inversed();
+                        m[i][j] = one;
+                        for (std::size_t jp = j + 1; jp < cols; ++jp) {
+                            m[i][jp] = m[i][jp] * s_inv;
+                        }
+
+                        // Eliminate other values in the column, columns left of j are already zero in row i
+                        for (ip = 0; ip < rows; ++ip) {
+                            if (ip == i || m[ip][j] == zero) {
+                                continue;
+                            }
+                            const T f = m[ip][j];
+                            m[ip][j] = zero;
+                            for (std::size_t jp = j + 1; jp < cols; ++jp) {
+                                m[ip][jp] = m[ip][jp] - f * m[i][jp];
+                            }
+                        }
+
+                        ++rank;
+                        ++i;
+                        ++j;
+                    }
+                    if (rank != rows) {
+                        det = zero;
+                    }
+                    return rank;
+                }
+            }    // namespace detail
+
+            /// @private
+            template<typename T, std::size_t M, std::size_t N>
+            constexpr std::tuple<matrix<T, M, N>, std::size_t, T> gauss_jordan_field_impl(matrix<T, M, N> m) {
+                T det = T::one();
+                const std::size_t rank = detail::field_gauss_jordan(m, M, N, det);
+                return {m, rank, det};
+            }
+
             /// @private
             template<typename T, std::size_t M, std::size_t N>
             constexpr std::tuple<matrix<T, M, N>, std::size_t, T> gauss_jordan_impl(const matrix<T, M, N> &m) {
-                T tol = T(std::max(N, M)) * std::numeric_limits<T>::epsilon() * mars(m);
-                return gauss_jordan_impl(m, tol);
+                if constexpr (is_field_element<T>::value) {
+                    return gauss_jordan_field_impl(m);
+                } else {
+                    T tol = T(std::max(N, M)) * std::numeric_limits<T>::epsilon() * mars(m);
+                    return gauss_jordan_impl(m, tol);
+                }
             }
 
             /** @brief Compute the reduced row echelon form
@@ -306,13 +472,21 @@ namespace nil {
              *  \f$ \textbf{m}\textbf{m}^{-1} = \textbf{m}^{-1}\textbf{m} = \textbf{I}_{M}
              * \f$
              *
-             *  Computes the inverse of a matrix using the reduced row echelon form.
+             *  Computes the inverse of a matrix using the reduced row echelon form. Over a field the
+             *  invertibility check reuses the elimination of \f$ \left[\textbf{m} | \textbf{I}_{M}\right] \f$.
              */
             template<typename T, std::size_t M>
             constexpr matrix<T, M, M> inverse(const matrix<T, M, M> &m) {
-                if (rank(m) < M)
-                    throw "matrix is not invertible";
-                return submat<M, M>(rref(horzcat(m, get_identity<T, M>())), 0, M);
+                if constexpr (is_field_element<T>::value) {
+                    const matrix<T, M, 2 * M> r = rref(horzcat(m, get_identity<T, M>()));
+                    if (submat<M, M>(r, 0, 0) != get_identity<T, M>())
+                        throw "matrix is not invertible";
+                    return submat<M, M>(r, 0, M);
+                } else {
+                    if (rank(m) < M)
+                        throw "matrix is not invertible";
+                    return submat<M, M>(rref(horzcat(m, get_identity<T, M>())), 0, M);
+                }
             }
 
             /** @brief computes the trace
@@ -0,0 +1,263 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_MATRIX_SPARSE_MATRIX_HPP
+#define CRYPTO3_ALGEBRA_MATRIX_SPARSE_MATRIX_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <tuple>
+#include <vector>
+
+#include <boost/assert.hpp>
+
+#include <nil/crypto3/algebra/matrix/math.hpp>
+#include <nil/crypto3/algebra/matrix/dense_matrix.hpp>
+
+#include <nil/crypto3/detail/parallel_for.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            /** \addtogroup matrix
+             *  @{
+             */
+
+            /** @brief A runtime-sized sparse matrix of field elements in compressed sparse row (CSR) form
+             *    @tparam T field element type
+             *
+             *    The nonzero elements of row i are values()[k] at columns column_indices()[k] for k in
+             *    [row_offsets()[i], row_offsets()[i + 1]), ordered by column. Typical use is the evaluation of
+             *    the R1CS products A z, B z and C z with matvectmul.
+             */
+            template<typename T>
+            class sparse_matrix {
+            public:
+                using value_type = T;
+                using size_type = std::size_t;
+                /// (row, column, value) entry used to build a matrix
+                using triplet_type = std::tuple<size_type, size_type, value_type>;
+
+                sparse_matrix() : m_rows(0), m_cols(0), m_row_offsets(1, 0) {
+                }
+
+                /// Builds the matrix from entries in any order, summing duplicates and dropping zeros
+                sparse_matrix(size_type rows, size_type cols, std::vector<triplet_type> entries) :
+                    m_rows(rows), m_cols(cols), m_row_offsets(rows + 1, 0) {
+                    std::sort(entries.begin(), entries.end(), [](const triplet_type &a, const triplet_type &b) {
+                        return std::get<0>(a) < std::get<0>(b) ||
+                               (std::get<0>(a) == std::get<0>(b) && std::get<1>(a) < std::get<1>(b));
+                    });
+
+                    m_column_indices.reserve(entries.size());
+                    m_values.reserve(entries.size());
+                    for (std::size_t k = 0; k < entries.size();) {
+                        const size_type i = std::get<0>(entries[k]), j = std::get<1>(entries[k]);
+                        BOOST_ASSERT(i < rows && j < cols);
+
+                        value_type sum = std::get<2>(entries[k]);
+                        for (++k; k < entries.size() && std::get<0>(entries[k]) == i && std::get<1>(entries[k]) == j;
+                             ++k) {
+                            sum = sum + std::get<2>(entries[k]);
+                        }
+                        if (sum != value_type::zero()) {
+                            m_column_indices.push_back(j);
+                            m_values.push_back(sum);
+                            ++m_row_offsets[i + 1];
+                        }
+                    }
+                    std::partial_sum(m_row_offsets.begin(), m_row_offsets.end(), m_row_offsets.begin());
+                }
+
+                explicit sparse_matrix(const dense_matrix<T> &m) :
+                    m_rows(m.rows()), m_cols(m.cols()), m_row_offsets(m.rows() + 1, 0) {
+                    for (size_type i = 0; i < m_rows; ++i) {
+                        for (size_type j = 0; j < m_cols; ++j) {
+                            if (m[i][j] != value_type::zero()) {
+                                m_column_indices.push_back(j);
+                                m_values.push_back(m[i][j]);
+                            }
+                        }
+                        m_row_offsets[i + 1] = m_values.size();
+                    }
+                }
+
+                size_type rows() const {
+                    return m_rows;
+                }
+
+                size_type cols() const {
+                    return m_cols;
+                }
+
+                /// Number of stored (nonzero) elements
+                size_type nonzeros() const {
+                    return m_values.size();
+                }
+
+                const std::vector<size_type> &row_offsets() const {
+                    return m_row_offsets;
+                }
+
+                const std::vector<size_type> &column_indices() const {
+                    return m_column_indices;
+                }
+
+                const std::vector<value_type> &values() const {
+                    return m_values;
+                }
+
+                dense_matrix<T> to_dense() const {
+                    dense_matrix<T> result(m_rows, m_cols);
+                    for (size_type i = 0; i < m_rows; ++i) {
+                        for (size_type k = m_row_offsets[i]; k < m_row_offsets[i + 1]; ++k) {
+                            result[i][m_column_indices[k]] = m_values[k];
+                        }
+                    }
+                    return result;
+                }
+
+                bool operator==(const sparse_matrix &other) const {
+                    return m_rows == other.m_rows && m_cols == other.m_cols &&
+                           m_row_offsets == other.m_row_offsets && m_column_indices == other.m_column_indices &&
+                           m_values == other.m_values;
+                }
+
+                bool operator!=(const sparse_matrix &other) const {
+                    return !(*this == other);
+                }
+
+            private:
+                size_type m_rows;
+                size_type m_cols;
+                std::vector<size_type> m_row_offsets;
+                std::vector<size_type> m_column_indices;
+                std::vector<value_type> m_values;
+            };
+
+            namespace detail {
+                /// @private
+                /// Sparse dot product sum values[k] * v[indices[k]], reduced once when T has an unreduced
+                /// product type
+                template<typename T>
+                T field_sparse_dot(const T *values, const std::size_t *indices, const T *v, std::size_t n) {
+                    if constexpr (has_dbl_type<T>::value) {
+                        typename T::dbl_type acc;
+                        for (std::size_t k = 0; k < n; ++k) {
+                            acc += T::dbl_type::mul(values[k], v[indices[k]]);
+                        }
+                        return acc.reduce();
+                    } else {
+                        T acc = T::zero();
+                        for (std::size_t k = 0; k < n; ++k) {
+                            acc = acc + values[k] * v[indices[k]];
+                        }
+                        return acc;
+                    }
+                }
+            }    // namespace detail
+
+            /** @brief computes the transpose
+             *  @param m an \f$ M \times N \f$ sparse_matrix
+             *  @return the \f$ N \times M \f$ transpose of m, in CSR form
+             */
+            template<typename T>
+            sparse_matrix<T> transpose(const sparse_matrix<T> &m) {
+                std::vector<typename sparse_matrix<T>::triplet_type> entries;
+                entries.reserve(m.nonzeros());
+                for (std::size_t i = 0; i < m.rows(); ++i) {
+                    for (std::size_t k = m.row_offsets()[i]; k < m.row_offsets()[i + 1]; ++k) {
+                        entries.emplace_back(m.column_indices()[k], i, m.values()[k]);
+                    }
+                }
+                return sparse_matrix<T>(m.cols(), m.rows(), std::move(entries));
+            }
+
+            /*!
+             * @brief computes the product of sparse matrix and vector
+             * @param m an \f$M \times N\f$ sparse_matrix
+             * @param v an N-vector
+             * @param threads_count number of threads
+             * @return an M-vector
+             *
+             * The rows are split between the threads so that each gets about the same number of nonzero
+             * elements, and every row is accumulated with a single reduction.
+             */
+            template<typename T>
+            std::vector<T> matvectmul(const sparse_matrix<T> &m, const std::vector<T> &v,
+                                      std::size_t threads_count = 1) {
+                BOOST_ASSERT(m.cols() == v.size());
+
+                const std::vector<std::size_t> &offsets = m.row_offsets();
+                const std::size_t parts_count = std::max<std::size_t>(std::min(threads_count, m.rows()), 1);
+
+                std::vector<T> result(m.rows());
+                crypto3::detail::parallel_for(0, parts_count, parts_count, [&](std::size_t begin, std::size_t end) {
+                    for (std::size_t part = begin; part < end; ++part) {
+                        // Rows whose first nonzero falls in this part's share of the nonzeros
+                        const auto first = std::lower_bound(offsets.begin(), offsets.end() - 1,
+                                                            m.nonzeros() * part / parts_count);
+                        const auto last = std::lower_bound(offsets.begin(), offsets.end() - 1,
+                                                           m.nonzeros() * (part + 1) / parts_count);
+                        const std::size_t row_begin = first - offsets.begin();
+                        const std::size_t row_end = part + 1 == parts_count ? m.rows() : last - offsets.begin();
+
+                        for (std::size_t i = row_begin; i < row_end; ++i) {
+                            result[i] = detail::field_sparse_dot(m.values().data() + offsets[i],
+                                                                 m.column_indices().data() + offsets[i], v.data(),
+                                                                 offsets[i + 1] - offsets[i]);
+                        }
+                    }
+                });
+                return result;
+            }
+
+            /*!
+             * @brief computes the product of vector and sparse matrix
+             * @param v an M-vector
+             * @param m an \f$M \times N\f$ sparse_matrix
+             * @return an N-vector
+             */
+            template<typename T>
+            std::vector<T> vectmatmul(const std::vector<T> &v, const sparse_matrix<T> &m) {
+                BOOST_ASSERT(m.rows() == v.size());
+
+                std::vector<T> result(m.cols(), T::zero());
+                for (std::size_t i = 0; i < m.rows(); ++i) {
+                    for (std::size_t k = m.row_offsets()[i]; k < m.row_offsets()[i + 1]; ++k) {
+                        result[m.column_indices()[k]] = result[m.column_indices()[k]] + m.values()[k] * v[i];
+                    }
+                }
+                return result;
+            }
+
+            /** }@*/
+
+        }    // namespace algebra
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_MATRIX_SPARSE_MATRIX_HPP
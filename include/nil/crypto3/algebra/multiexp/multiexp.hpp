@@ -27,14 +27,21 @@
 #ifndef CRYPTO3_ALGEBRA_MULTIEXP_HPP
 #define CRYPTO3_ALGEBRA_MULTIEXP_HPP
 
+#include <algorithm>
+#include <memory>
+#include <type_traits>
 #include <vector>
 
 #include <nil/crypto3/multiprecision/number.hpp>
 #include <nil/crypto3/multiprecision/cpp_int.hpp>
 
+#include <nil/crypto3/algebra/fixed_base_mul.hpp>
 #include <nil/crypto3/algebra/multiexp/policies.hpp>
+#include <nil/crypto3/algebra/multiexp/window_tables.hpp>
 #include <nil/crypto3/algebra/curves/params.hpp>
 
+#include <nil/crypto3/detail/parallel_for.hpp>
+
 namespace nil {
     namespace crypto3 {
         namespace algebra {
@@ -48,6 +55,14 @@ namespace nil {
 
                 const std::size_t total_size = std::distance(vec_start, vec_end);
 
+                // multiexp_method_naive_plain is also used over plain fields and keeps its operator * semantics
+                if constexpr (!std::is_same<MultiexpMethod, policies::multiexp_method_naive_plain>::value) {
+                    if (total_size <= policies::multiexp_method_straus::max_size) {
+                        return policies::multiexp_method_straus::process(vec_start, vec_end, scalar_start,
+                                                                         scalar_end);
+                    }
+                }
+
                 if ((total_size < chunks_count) || (chunks_count == 1)) {
                     // no need to split into "chunks_count", can call implementation directly
                     return MultiexpMethod::process(vec_start, vec_end, scalar_start, scalar_end);
@@ -69,6 +84,73 @@ namespace nil {
                 return result;
             }
 
+            /**
+             * generator_scalar * value_type::one() + sum of scalars[i] * bases[i] for a few bases: the generator
+             * goes through the shared fixed_base_table, the remaining bases through multiexp_method_straus.
+             */
+            template<typename GroupType, typename InputBaseIterator, typename InputFieldIterator>
+            typename GroupType::value_type multiexp_with_generator(
+                const typename GroupType::curve_type::scalar_field_type::value_type &generator_scalar,
+                InputBaseIterator vec_start, InputBaseIterator vec_end, InputFieldIterator scalar_start,
+                InputFieldIterator scalar_end) {
+                return fixed_base_mul<GroupType>(generator_scalar) +
+                       policies::multiexp_method_straus::process(vec_start, vec_end, scalar_start, scalar_end);
+            }
+
+            /**
+             * a * value_type::one() + b * base, the double-scalar multiplication of ECDSA and Schnorr verification.
+             * The generator side is a lookup into the shared fixed_base_table, so only base pays for doublings.
+             */
+            template<typename GroupType>
+            typename GroupType::value_type
+                double_scalar_mul(const typename GroupType::curve_type::scalar_field_type::value_type &a,
+                                  const typename GroupType::curve_type::scalar_field_type::value_type &b,
+                                  const typename GroupType::value_type &base) {
+                return multiexp_with_generator<GroupType>(a, &base, &base + 1, &b, &b + 1);
+            }
+
+            /**
+             * Splits the instance into at most threads_count contiguous parts, runs MultiexpMethod on each
+             * of them concurrently and adds up the partial results. Requires random access iterators.
+             */
+            template<typename MultiexpMethod, typename InputBaseIterator, typename InputFieldIterator>
+            typename std::iterator_traits<InputBaseIterator>::value_type
+                parallel_multiexp(InputBaseIterator vec_start, InputBaseIterator vec_end,
+                                  InputFieldIterator scalar_start, InputFieldIterator scalar_end,
+                                  const std::size_t threads_count) {
+
+                typedef typename std::iterator_traits<InputBaseIterator>::value_type base_value_type;
+
+                const std::size_t total_size = std::distance(vec_start, vec_end);
+                BOOST_ASSERT(total_size == std::size_t(std::distance(scalar_start, scalar_end)));
+
+                if (total_size <= policies::multiexp_method_straus::max_size) {
+                    // not worth a thread, multiexp picks the method for small instances
+                    return multiexp<MultiexpMethod>(vec_start, vec_end, scalar_start, scalar_end, 1);
+                }
+
+                const std::size_t parts_count = std::max<std::size_t>(std::min(threads_count, total_size), 1);
+                std::vector<base_value_type> partial(parts_count, base_value_type::zero());
+                const std::size_t part_size = (total_size + parts_count - 1) / parts_count;
+
+                crypto3::detail::parallel_for(0, parts_count, parts_count, [&](std::size_t begin, std::size_t end) {
+                    for (std::size_t i = begin; i < end; ++i) {
+                        const std::size_t from = std::min(i * part_size, total_size);
+                        const std::size_t to = std::min(from + part_size, total_size);
+                        if (from != to) {
+                            partial[i] = MultiexpMethod::process(vec_start + from, vec_start + to,
+                                                                 scalar_start + from, scalar_start + to);
+                        }
+                    }
+                });
+
+                base_value_type result = base_value_type::zero();
+                for (const base_value_type &p : partial) {
+                    result = result + p;
+                }
+                return result;
+            }
+
             template<typename MultiexpMethod, typename InputBaseIterator, typename InputFieldIterator>
             typename std::iterator_traits<InputBaseIterator>::value_type
                 multiexp_with_mixed_addition(InputBaseIterator vec_start, InputBaseIterator vec_end,
@@ -115,25 +197,29 @@ namespace nil {
             template<typename GroupType>
             using window_table = std::vector<std::vector<typename GroupType::value_type>>;
 
+            /**
+             * Window size for batch_exp over num_scalars scalars. Tables installed through
+             * set_window_tables or CRYPTO3_ALGEBRA_WINDOW_TABLES take precedence over the static
+             * curves::multiexp_params ones.
+             */
             template<typename GroupType>
             std::size_t get_exp_window_size(const std::size_t num_scalars) {
-                if (curves::multiexp_params<GroupType>::fixed_base_exp_window_table.empty()) {
+                std::size_t window;
+
+                const std::shared_ptr<const window_tables> tuned = tuned_window_tables<GroupType>();
+                if (tuned && !tuned->fixed_base.empty()) {
+                    window = std::max<std::size_t>(detail::window_from_thresholds(tuned->fixed_base, num_scalars), 1);
+                } else if (curves::multiexp_params<GroupType>::fixed_base_exp_window_table.empty()) {
 #ifdef LOWMEM
                     return 14;
 #else
                     return 17;
 #endif
-                }
-
-                std::size_t window = 1;
-
-                for (std::size_t i = curves::multiexp_params<GroupType>::fixed_base_exp_window_table.size() - 1; i >= 0;
-                     --i) {
-                    if (curves::multiexp_params<GroupType>::fixed_base_exp_window_table[i] != 0 &&
-                        num_scalars >= curves::multiexp_params<GroupType>::fixed_base_exp_window_table[i]) {
-                        window = i + 1;
-                        break;
-                    }
+                } else {
+                    window = std::max<std::size_t>(
+                        detail::window_from_thresholds(
+                            curves::multiexp_params<GroupType>::fixed_base_exp_window_table, num_scalars),
+                        1);
                 }
 
 #ifdef LOWMEM
@@ -232,32 +318,6 @@ namespace nil {
 
                 return res;
             }
-
-            template<typename GroupType, typename InputRange>
-            typename std::enable_if<
-                std::is_same<typename InputRange::value_type, typename GroupType::value_type>::value, void>::type
-                batch_to_special(InputRange &vec) {
-
-                std::vector<typename GroupType::value_type> non_zero_vec;
-                for (std::size_t i = 0; i < vec.size(); ++i) {
-                    if (!vec[i].is_zero()) {
-                        non_zero_vec.emplace_back(vec[i]);
-                    }
-                }
-
-                GroupType::batch_to_special_all_non_zeros(non_zero_vec);
-                typename std::vector<typename GroupType::value_type>::const_iterator it = non_zero_vec.begin();
-                typename GroupType::value_type zero_special = GroupType::value_type::zero().to_projective();
-
-                for (std::size_t i = 0; i < vec.size(); ++i) {
-                    if (!vec[i].is_zero()) {
-                        vec[i] = *it;
-                        ++it;
-                    } else {
-                        vec[i] = zero_special;
-                    }
-                }
-            }
         }    // namespace algebra
     }        // namespace crypto3
 }    // namespace nil
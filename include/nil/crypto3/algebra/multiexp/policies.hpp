@@ -27,16 +27,45 @@
 #ifndef CRYPTO3_ALGEBRA_MULTIEXP_BASIC_POLICIES_HPP
 #define CRYPTO3_ALGEBRA_MULTIEXP_BASIC_POLICIES_HPP
 
+#include <algorithm>
+#include <memory>
 #include <vector>
 
 #include <nil/crypto3/multiprecision/number.hpp>
 #include <nil/crypto3/multiprecision/cpp_int.hpp>
 
 #include <nil/crypto3/algebra/wnaf.hpp>
+#include <nil/crypto3/algebra/multiexp/window_tables.hpp>
 
 namespace nil {
     namespace crypto3 {
         namespace algebra {
+            /**
+             * Brings the elements of vec to the special form expected by mixed_add (Z = 1) with a single field
+             * inversion. Points at infinity are left as they are.
+             */
+            template<typename InputRange>
+            void batch_to_special(InputRange &vec) {
+                typedef typename InputRange::value_type value_type;
+
+                std::vector<value_type> non_zero_vec;
+                for (std::size_t i = 0; i < vec.size(); ++i) {
+                    if (!vec[i].is_zero()) {
+                        non_zero_vec.emplace_back(vec[i]);
+                    }
+                }
+
+                value_type::batch_to_special_all_non_zeros(non_zero_vec);
+                typename std::vector<value_type>::const_iterator it = non_zero_vec.begin();
+
+                for (std::size_t i = 0; i < vec.size(); ++i) {
+                    if (!vec[i].is_zero()) {
+                        vec[i] = *it;
+                        ++it;
+                    }
+                }
+            }
+
             namespace policies {
                 namespace detail {
                     template<typename NumberType>
@@ -88,6 +117,94 @@ namespace nil {
                     }
                 };
 
+                /**
+                 * Straus' interleaved multi-exponentiation ("Shamir's trick" for two bases) over wNAF digits:
+                 * a single chain of doublings is shared by all bases, and each base only contributes the
+                 * additions of its own odd-multiples table. For a handful of bases this avoids the heap of
+                 * Bos-Coster and the buckets of BDLO12, so multiexp selects it for up to max_size bases.
+                 */
+                struct multiexp_method_straus {
+                    constexpr static const std::size_t max_size = 8;
+
+                    /// Window minimizing 2^(w-1) table additions plus bits / (w + 2) digit additions
+                    static inline std::size_t window_size(const std::size_t scalar_bits) {
+                        std::size_t best = 1;
+                        std::size_t best_cost = 1 + scalar_bits / 3;
+                        for (std::size_t w = 2; w <= 8; ++w) {
+                            const std::size_t cost = (std::size_t(1) << (w - 1)) + scalar_bits / (w + 2);
+                            if (cost < best_cost) {
+                                best = w;
+                                best_cost = cost;
+                            }
+                        }
+                        return best;
+                    }
+
+                    template<typename InputBaseIterator, typename InputFieldIterator>
+                    static inline typename std::iterator_traits<InputBaseIterator>::value_type
+                        process(InputBaseIterator vec_start,
+                                InputBaseIterator vec_end,
+                                InputFieldIterator scalar_start,
+                                InputFieldIterator scalar_end) {
+
+                        typedef typename std::iterator_traits<InputBaseIterator>::value_type base_value_type;
+
+                        // temporary added until fixed-precision modular adaptor is ready:
+                        typedef multiprecision::number<multiprecision::backends::cpp_int_backend<>>
+                            non_fixed_precision_number_type;
+
+                        std::vector<std::vector<long>> nafs;
+                        std::vector<std::vector<base_value_type>> tables;
+                        std::size_t naf_size = 0;
+
+                        InputBaseIterator vec_it;
+                        InputFieldIterator scalar_it;
+                        for (vec_it = vec_start, scalar_it = scalar_start; vec_it != vec_end; ++vec_it, ++scalar_it) {
+                            const non_fixed_precision_number_type k(scalar_it->data);
+                            if (k.is_zero() || vec_it->is_zero()) {
+                                continue;
+                            }
+
+                            const std::size_t window = window_size(multiprecision::msb(k) + 1);
+                            nafs.emplace_back(multiprecision::find_wnaf(window, k));
+                            naf_size = std::max(naf_size, nafs.back().size());
+
+                            // table[i] = (2 * i + 1) * base, the digits of find_wnaf are odd
+                            std::vector<base_value_type> table(std::size_t(1) << (window - 1));
+                            const base_value_type dbl = vec_it->doubled();
+                            table[0] = *vec_it;
+                            for (std::size_t i = 1; i < table.size(); ++i) {
+                                table[i] = table[i - 1] + dbl;
+                            }
+                            tables.emplace_back(std::move(table));
+                        }
+
+                        BOOST_ASSERT(scalar_it == scalar_end);
+
+                        base_value_type result = base_value_type::zero();
+                        bool found_nonzero = false;
+                        for (std::size_t i = naf_size; i-- > 0;) {
+                            if (found_nonzero) {
+                                result = result.doubled();
+                            }
+
+                            for (std::size_t j = 0; j < nafs.size(); ++j) {
+                                if (i >= nafs[j].size() || nafs[j][i] == 0) {
+                                    continue;
+                                }
+                                found_nonzero = true;
+                                if (nafs[j][i] > 0) {
+                                    result = result + tables[j][nafs[j][i] / 2];
+                                } else {
+                                    result = result - tables[j][(-nafs[j][i]) / 2];
+                                }
+                            }
+                        }
+
+                        return result;
+                    }
+                };
+
                 /**
                  * A special case of Pippenger's algorithm from Page 15 of
                  * Bernstein, Doumen, Lange, Oosterwijk,
@@ -95,7 +212,7 @@ namespace nil {
                  * (https://eprint.iacr.org/2012/549.pdf)
                  * When compiled with USE_MIXED_ADDITION, assumes input is in special form.
                  * Requires that base_value_type implements .dbl() (and, if USE_MIXED_ADDITION is defined,
-                 * .to_projective(), .mixed_add(), and batch_to_projective()).
+                 * .mixed_add() and a static batch_to_special_all_non_zeros()).
                  */
                 struct multiexp_method_BDLO12 {
                     template<typename InputBaseIterator, typename InputFieldIterator>
@@ -113,10 +230,17 @@ namespace nil {
 
                         assert(length == scalars_length);
 
-                        // empirically, this seems to be a decent estimate of the optimal value of c
+                        // empirically, this seems to be a decent estimate of the optimal value of c;
+                        // tables tuned for this machine take precedence
                         std::size_t log2_length = std::log2(length);
                         std::size_t c = log2_length - (log2_length / 3 - 2);
 
+                        const std::shared_ptr<const window_tables> tuned =
+                            tuned_window_tables<typename base_value_type::group_type>();
+                        if (tuned && !tuned->pippenger.empty()) {
+                            c = tuned->pippenger[std::min(log2_length, tuned->pippenger.size() - 1)];
+                        }
+
                         std::size_t num_bits = 0;
 
                         for (std::size_t i = 0; i < length; i++) {
@@ -0,0 +1,181 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_MULTIEXP_TUNING_HPP
+#define CRYPTO3_ALGEBRA_MULTIEXP_TUNING_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include <nil/crypto3/algebra/multiexp/window_tables.hpp>
+#include <nil/crypto3/algebra/random_element.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace detail {
+                /*!
+                 * @brief Threshold table of the lower envelope of the cost lines intercepts[i] + n * slopes[i].
+                 *
+                 * Entry i is the smallest n >= 1 for which line i is the cheapest, or 0 if it never is; ties
+                 * go to the smaller index.
+                 */
+                inline std::vector<std::size_t> thresholds_from_cost_lines(const std::vector<double> &intercepts,
+                                                                           const std::vector<double> &slopes) {
+                    const std::size_t count = intercepts.size();
+                    std::vector<std::size_t> thresholds(count, 0);
+
+                    for (std::size_t i = 0; i < count; ++i) {
+                        double low = 0;
+                        double high = std::numeric_limits<double>::infinity();
+
+                        for (std::size_t j = 0; j < count && low <= high; ++j) {
+                            if (j == i) {
+                                continue;
+                            }
+                            // line i is at most line j iff n * (slopes[i] - slopes[j]) <= intercepts[j] - intercepts[i]
+                            const double intercept_gap = intercepts[j] - intercepts[i];
+                            const double slope_gap = slopes[i] - slopes[j];
+                            if (slope_gap > 0) {
+                                high = std::min(high, intercept_gap / slope_gap);
+                            } else if (slope_gap < 0) {
+                                low = std::max(low, intercept_gap / slope_gap);
+                            } else if (intercept_gap < 0 || (intercept_gap == 0 && j < i)) {
+                                high = -1;
+                            }
+                        }
+
+                        const double first = std::max(1.0, std::ceil(low));
+                        if (first <= high) {
+                            thresholds[i] = static_cast<std::size_t>(first);
+                        }
+                    }
+
+                    return thresholds;
+                }
+            }    // namespace detail
+
+            /*!
+             * @brief Derives window tables for scalars of scalar_bits bits from the cost of a point addition
+             * and a doubling, in any common unit.
+             *
+             * The models count group operations only: batch_exp with window w costs
+             * ceil(b / w) * (2^w + n) additions plus b doublings for n scalars, Pippenger with bucket width c
+             * costs ceil(b / c) * (n + 2^(c + 1)) additions, and wNAF with window w costs 2^(w - 1) additions
+             * for the table plus b doublings and b / (w + 1) additions.
+             */
+            inline window_tables make_window_tables(std::size_t scalar_bits, double add_cost, double dbl_cost) {
+                constexpr std::size_t max_fixed_base_window = window_tables::max_fixed_base_window;
+                constexpr std::size_t max_pippenger_window = window_tables::max_pippenger_window;
+                constexpr std::size_t max_wnaf_window = window_tables::max_wnaf_window;
+                constexpr std::size_t max_log2_length = 31;
+
+                window_tables tables;
+                tables.add_cost = add_cost;
+                tables.dbl_cost = dbl_cost;
+
+                std::vector<double> intercepts, slopes;
+                for (std::size_t w = 1; w <= max_fixed_base_window; ++w) {
+                    const double outerc = static_cast<double>((scalar_bits + w - 1) / w);
+                    intercepts.push_back(outerc * std::ldexp(1.0, w) * add_cost + scalar_bits * dbl_cost);
+                    slopes.push_back(outerc * add_cost);
+                }
+                tables.fixed_base = detail::thresholds_from_cost_lines(intercepts, slopes);
+
+                intercepts.clear();
+                slopes.clear();
+                for (std::size_t w = 1; w <= max_wnaf_window; ++w) {
+                    intercepts.push_back(dbl_cost + std::ldexp(1.0, w - 1) * add_cost);
+                    slopes.push_back(dbl_cost + add_cost / (w + 1));
+                }
+                tables.wnaf = detail::thresholds_from_cost_lines(intercepts, slopes);
+
+                for (std::size_t k = 0; k <= max_log2_length; ++k) {
+                    std::size_t best = 1;
+                    double best_cost = std::numeric_limits<double>::infinity();
+                    for (std::size_t c = 1; c <= max_pippenger_window; ++c) {
+                        const double groups = static_cast<double>((scalar_bits + c - 1) / c);
+                        const double cost = groups * (std::ldexp(1.0, k) + std::ldexp(1.0, c + 1)) * add_cost;
+                        if (cost < best_cost) {
+                            best_cost = cost;
+                            best = c;
+                        }
+                    }
+                    tables.pippenger.push_back(best);
+                }
+
+                return tables;
+            }
+
+            /// Average cost of a point addition and of a doubling in GroupType, in nanoseconds
+            template<typename GroupType>
+            std::pair<double, double> measure_point_costs(std::size_t iterations = 1000) {
+                using clock_type = std::chrono::steady_clock;
+                typedef typename GroupType::value_type value_type;
+
+                value_type P = random_element<GroupType>();
+                const value_type Q = random_element<GroupType>();
+
+                clock_type::time_point start = clock_type::now();
+                for (std::size_t i = 0; i < iterations; ++i) {
+                    P = P + Q;
+                }
+                const double add_cost =
+                    std::chrono::duration<double, std::nano>(clock_type::now() - start).count() / iterations;
+
+                start = clock_type::now();
+                for (std::size_t i = 0; i < iterations; ++i) {
+                    P = P.doubled();
+                }
+                const double dbl_cost =
+                    std::chrono::duration<double, std::nano>(clock_type::now() - start).count() / iterations;
+
+                // keeps the loops from being optimized away
+                volatile bool sink = P.is_zero();
+                (void)sink;
+
+                return std::make_pair(add_cost, dbl_cost);
+            }
+
+            /*!
+             * @brief Measures GroupType on this machine and derives its window tables. Persist them with
+             * save_window_tables and point CRYPTO3_ALGEBRA_WINDOW_TABLES at the file to use them on startup.
+             */
+            template<typename GroupType>
+            window_tables tune_window_tables(std::size_t iterations = 1000) {
+                const std::pair<double, double> costs = measure_point_costs<GroupType>(iterations);
+                return make_window_tables(GroupType::curve_type::scalar_field_type::modulus_bits, costs.first,
+                                          costs.second);
+            }
+        }    // namespace algebra
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_MULTIEXP_TUNING_HPP
@@ -0,0 +1,265 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_MULTIEXP_WINDOW_TABLES_HPP
+#define CRYPTO3_ALGEBRA_MULTIEXP_WINDOW_TABLES_HPP
+
+#include <cstddef>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+
+            /*!
+             * @brief Window sizes tuned for one group on the current machine.
+             *
+             * Tables follow the layout of the static curves::multiexp_params and curves::wnaf_params ones, so
+             * a tuned table can stand in for a missing or outdated constant one. An empty table means "not
+             * tuned" and the static defaults are used instead.
+             */
+            struct window_tables {
+                /// Entry i is the smallest number of scalars for which window i + 1 is the best choice in
+                /// batch_exp, 0 if it never is
+                std::vector<std::size_t> fixed_base;
+                /// Entry k is the bucket width multiexp_method_BDLO12 uses for 2^k points
+                std::vector<std::size_t> pippenger;
+                /// Entry i is the smallest scalar bit length for which wNAF window i + 1 is the best choice,
+                /// 0 if it never is
+                std::vector<std::size_t> wnaf;
+
+                /// Measured costs of a point addition and doubling in nanoseconds
+                double add_cost = 0;
+                double dbl_cost = 0;
+
+                /// Largest windows the tables may select; larger ones would not fit in memory
+#ifdef LOWMEM
+                constexpr static const std::size_t max_fixed_base_window = 14;
+                constexpr static const std::size_t max_pippenger_window = 16;
+#else
+                constexpr static const std::size_t max_fixed_base_window = 22;
+                constexpr static const std::size_t max_pippenger_window = 20;
+#endif
+                constexpr static const std::size_t max_wnaf_window = 8;
+            };
+
+            namespace detail {
+                /// Window picked from a threshold table: the largest i + 1 with table[i] != 0 and
+                /// n >= table[i], or 0 if there is none
+                template<typename Table>
+                std::size_t window_from_thresholds(const Table &table, std::size_t n) {
+                    for (std::size_t i = table.size(); i-- > 0;) {
+                        if (table[i] != 0 && n >= table[i]) {
+                            return i + 1;
+                        }
+                    }
+                    return 0;
+                }
+
+                /*!
+                 * @brief Section name of GroupType in a tables file, built from the moduli of its base and
+                 * scalar fields and the extension degree of its coordinates, e.g. G2 of a pairing-friendly curve
+                 * is "p=0x... k=2 r=0x...". Unlike type names this is the same for every compiler and build.
+                 * Coordinate systems and curve models over the same fields share a section.
+                 */
+                template<typename GroupType>
+                std::string window_tables_key() {
+                    std::ostringstream key;
+                    key << std::hex << "p=0x" << GroupType::field_type::modulus << std::dec
+                        << " k=" << GroupType::field_type::arity << std::hex
+                        << " r=0x" << GroupType::curve_type::scalar_field_type::modulus;
+                    return key.str();
+                }
+
+                /// Rejects tables that select a window of 0 or one larger than the algorithms support
+                inline bool window_tables_are_valid(const window_tables &tables) {
+                    if (tables.fixed_base.size() > window_tables::max_fixed_base_window ||
+                        tables.wnaf.size() > window_tables::max_wnaf_window) {
+                        return false;
+                    }
+                    for (std::size_t c : tables.pippenger) {
+                        if (c == 0 || c > window_tables::max_pippenger_window) {
+                            return false;
+                        }
+                    }
+                    return true;
+                }
+
+                inline void write_window_tables_section(std::ostream &os, const std::string &key,
+                                                        const window_tables &tables) {
+                    const auto write_table = [&os](const char *name, const std::vector<std::size_t> &table) {
+                        os << name;
+                        for (std::size_t v : table) {
+                            os << ' ' << v;
+                        }
+                        os << '\n';
+                    };
+
+                    os << '[' << key << "]\n";
+                    os << "add_cost " << tables.add_cost << '\n';
+                    os << "dbl_cost " << tables.dbl_cost << '\n';
+                    write_table("fixed_base", tables.fixed_base);
+                    write_table("pippenger", tables.pippenger);
+                    write_table("wnaf", tables.wnaf);
+                }
+
+                /// Reads the section named key; returns false if the stream has no such section or it is
+                /// malformed
+                inline bool read_window_tables_section(std::istream &is, const std::string &key,
+                                                       window_tables &tables) {
+                    const std::string header = '[' + key + ']';
+                    std::string line;
+                    bool found = false;
+
+                    while (std::getline(is, line)) {
+                        if (!line.empty() && line[0] == '[') {
+                            if (found) {
+                                break;
+                            }
+                            found = (line == header);
+                            continue;
+                        }
+                        if (!found) {
+                            continue;
+                        }
+
+                        std::istringstream fields(line);
+                        std::string name;
+                        fields >> name;
+                        if (name == "add_cost") {
+                            fields >> tables.add_cost;
+                        } else if (name == "dbl_cost") {
+                            fields >> tables.dbl_cost;
+                        } else if (name == "fixed_base" || name == "pippenger" || name == "wnaf") {
+                            std::vector<std::size_t> &table = name == "fixed_base" ? tables.fixed_base :
+                                                              name == "pippenger"  ? tables.pippenger :
+                                                                                     tables.wnaf;
+                            table.clear();
+                            std::size_t v;
+                            while (fields >> v) {
+                                table.push_back(v);
+                            }
+                        }
+                        if (fields.fail() && !fields.eof()) {
+                            return false;
+                        }
+                    }
+
+                    return found && window_tables_are_valid(tables);
+                }
+
+                template<typename GroupType>
+                std::shared_ptr<const window_tables> load_window_tables_from_environment() {
+                    const char *path = std::getenv("CRYPTO3_ALGEBRA_WINDOW_TABLES");
+                    if (path == nullptr) {
+                        return nullptr;
+                    }
+
+                    std::ifstream is(path);
+                    window_tables tables;
+                    if (!is || !read_window_tables_section(is, window_tables_key<GroupType>(), tables)) {
+                        return nullptr;
+                    }
+                    return std::make_shared<const window_tables>(std::move(tables));
+                }
+
+                template<typename GroupType>
+                std::shared_ptr<const window_tables> &window_tables_slot() {
+                    static std::shared_ptr<const window_tables> slot =
+                        load_window_tables_from_environment<GroupType>();
+                    return slot;
+                }
+            }    // namespace detail
+
+            /*!
+             * @brief Tuned tables for GroupType, or nullptr when none were installed.
+             *
+             * On first use the file named by the CRYPTO3_ALGEBRA_WINDOW_TABLES environment variable is
+             * consulted, so tables written by save_window_tables are picked up at startup without code changes.
+             */
+            template<typename GroupType>
+            std::shared_ptr<const window_tables> tuned_window_tables() {
+                return std::atomic_load(&detail::window_tables_slot<GroupType>());
+            }
+
+            template<typename GroupType>
+            void set_window_tables(const window_tables &tables) {
+                std::atomic_store(&detail::window_tables_slot<GroupType>(),
+                                  std::make_shared<const window_tables>(tables));
+            }
+
+            template<typename GroupType>
+            void reset_window_tables() {
+                std::atomic_store(&detail::window_tables_slot<GroupType>(), std::shared_ptr<const window_tables>());
+            }
+
+            /// Installs the GroupType section of the file at path; returns false if there is none or it selects
+            /// invalid windows, leaving the installed tables unchanged
+            template<typename GroupType>
+            bool load_window_tables(const std::string &path) {
+                std::ifstream is(path);
+                window_tables tables;
+                if (!is || !detail::read_window_tables_section(is, detail::window_tables_key<GroupType>(), tables)) {
+                    return false;
+                }
+                set_window_tables<GroupType>(tables);
+                return true;
+            }
+
+            /// Writes the GroupType section to the file at path, keeping the sections of other groups
+            template<typename GroupType>
+            bool save_window_tables(const std::string &path, const window_tables &tables) {
+                const std::string header = '[' + detail::window_tables_key<GroupType>() + ']';
+
+                std::ostringstream kept;
+                {
+                    std::ifstream is(path);
+                    std::string line;
+                    bool skipping = false;
+                    while (is && std::getline(is, line)) {
+                        if (!line.empty() && line[0] == '[') {
+                            skipping = (line == header);
+                        }
+                        if (!skipping) {
+                            kept << line << '\n';
+                        }
+                    }
+                }
+
+                std::ofstream os(path, std::ios::trunc);
+                os << kept.str();
+                detail::write_window_tables_section(os, detail::window_tables_key<GroupType>(), tables);
+                return static_cast<bool>(os);
+            }
+        }    // namespace algebra
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_MULTIEXP_WINDOW_TABLES_HPP
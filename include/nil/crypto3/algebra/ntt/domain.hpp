@@ -0,0 +1,167 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_NTT_DOMAIN_HPP
+#define CRYPTO3_ALGEBRA_NTT_DOMAIN_HPP
+
+#include <cstddef>
+#include <vector>
+
+#include <boost/assert.hpp>
+
+#include <nil/crypto3/algebra/fields/params.hpp>
+
+#include <nil/crypto3/detail/parallel_for.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+
+            /*!
+             * @brief Evaluation domain of a radix-2 number theoretic transform: the subgroup of 2^k-th roots
+             * of unity of a field and its coset by the multiplicative generator.
+             *
+             * The field needs arithmetic_params with s (two-adicity), root_of_unity (a primitive 2^s-th root)
+             * and multiplicative_generator, as defined in fields/arithmetic_params. Twiddles are stored per
+             * butterfly stage: for a stage of half-length m the entries [m - 1, 2m - 1) hold w_{2m}^j, so every
+             * stage reads its factors contiguously.
+             */
+            template<typename FieldType>
+            class ntt_domain {
+                typedef fields::arithmetic_params<FieldType> arithmetic_params_type;
+
+            public:
+                typedef FieldType field_type;
+                typedef typename field_type::value_type value_type;
+
+                /// Domain of the given size, which must be a power of two not exceeding 2^s
+                explicit ntt_domain(std::size_t size, std::size_t threads_count = 1) : m_size(size), m_log2_size(0) {
+                    BOOST_ASSERT_MSG(size != 0 && (size & (size - 1)) == 0, "NTT size must be a power of two");
+
+                    while ((std::size_t(1) << m_log2_size) < size) {
+                        ++m_log2_size;
+                    }
+                    BOOST_ASSERT_MSG(m_log2_size <= arithmetic_params_type::s, "field has insufficient two-adicity");
+
+                    m_omega = value_type(arithmetic_params_type::root_of_unity);
+                    for (std::size_t i = m_log2_size; i < arithmetic_params_type::s; ++i) {
+                        m_omega = m_omega.squared();
+                    }
+                    m_omega_inversed = m_omega.inversed();
+                    m_size_inversed = value_type(size).inversed();
+                    m_coset_shift = value_type(arithmetic_params_type::multiplicative_generator);
+                    m_coset_shift_inversed = m_coset_shift.inversed();
+
+                    m_twiddles = make_twiddles(m_omega, threads_count);
+                    m_inverse_twiddles = make_twiddles(m_omega_inversed, threads_count);
+                }
+
+                std::size_t size() const {
+                    return m_size;
+                }
+
+                std::size_t log2_size() const {
+                    return m_log2_size;
+                }
+
+                /// Primitive size-th root of unity
+                const value_type &omega() const {
+                    return m_omega;
+                }
+
+                const value_type &omega_inversed() const {
+                    return m_omega_inversed;
+                }
+
+                const value_type &size_inversed() const {
+                    return m_size_inversed;
+                }
+
+                /// Offset g of the coset g * <omega> used by the coset transforms
+                const value_type &coset_shift() const {
+                    return m_coset_shift;
+                }
+
+                const value_type &coset_shift_inversed() const {
+                    return m_coset_shift_inversed;
+                }
+
+                const std::vector<value_type> &twiddles() const {
+                    return m_twiddles;
+                }
+
+                const std::vector<value_type> &inverse_twiddles() const {
+                    return m_inverse_twiddles;
+                }
+
+            private:
+                std::vector<value_type> make_twiddles(const value_type &root, std::size_t threads_count) const {
+                    std::vector<value_type> result(m_size > 1 ? m_size - 1 : 0);
+                    if (m_size < 2) {
+                        return result;
+                    }
+
+                    // last stage: root^j for j < size / 2, each chunk starting from one exponentiation
+                    const std::size_t half = m_size / 2;
+                    value_type *last_stage = result.data() + half - 1;
+                    crypto3::detail::parallel_for(
+                        0, half, threads_count,
+                        [&](std::size_t begin, std::size_t end) {
+                            value_type w = root.pow(begin);
+                            for (std::size_t j = begin; j < end; ++j) {
+                                last_stage[j] = w;
+                                w *= root;
+                            }
+                        },
+                        1024);
+
+                    // earlier stages are strided copies of the last one
+                    for (std::size_t m = 1; m < half; m <<= 1) {
+                        const std::size_t stride = half / m;
+                        for (std::size_t j = 0; j < m; ++j) {
+                            result[m - 1 + j] = last_stage[j * stride];
+                        }
+                    }
+
+                    return result;
+                }
+
+                std::size_t m_size;
+                std::size_t m_log2_size;
+
+                value_type m_omega;
+                value_type m_omega_inversed;
+                value_type m_size_inversed;
+                value_type m_coset_shift;
+                value_type m_coset_shift_inversed;
+
+                std::vector<value_type> m_twiddles;
+                std::vector<value_type> m_inverse_twiddles;
+            };
+        }    // namespace algebra
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_NTT_DOMAIN_HPP
@@ -0,0 +1,198 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_NTT_HPP
+#define CRYPTO3_ALGEBRA_NTT_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include <boost/assert.hpp>
+
+#include <nil/crypto3/algebra/ntt/domain.hpp>
+
+#include <nil/crypto3/detail/parallel_for.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace detail {
+
+                /// Stages whose butterfly blocks fit in this many elements run block by block while the block
+                /// is cache resident; the remaining stages sweep the whole vector
+                constexpr static const std::size_t ntt_cache_block_size = 1024;
+
+                /// Below this many butterflies per thread a stage is not worth splitting
+                constexpr static const std::size_t ntt_min_chunk_size = 1024;
+
+                template<typename ValueType>
+                void ntt_bit_reverse(std::vector<ValueType> &a, std::size_t log2_size, std::size_t threads_count) {
+                    crypto3::detail::parallel_for(
+                        0, a.size(), threads_count,
+                        [&](std::size_t begin, std::size_t end) {
+                            for (std::size_t i = begin; i < end; ++i) {
+                                std::size_t r = 0;
+                                for (std::size_t b = 0, x = i; b < log2_size; ++b, x >>= 1) {
+                                    r = (r << 1) | (x & 1);
+                                }
+                                // each pair is swapped by its smaller index only, so chunks never race
+                                if (i < r) {
+                                    std::swap(a[i], a[r]);
+                                }
+                            }
+                        },
+                        ntt_min_chunk_size);
+                }
+
+                /// Radix-2 Cooley--Tukey butterflies k in [begin, end) of the stage with half-length m
+                template<typename ValueType>
+                void ntt_butterflies(ValueType *a, const ValueType *twiddles, std::size_t m, std::size_t log2_m,
+                                     std::size_t begin, std::size_t end) {
+                    for (std::size_t k = begin; k < end; ++k) {
+                        const std::size_t j = k & (m - 1);
+                        const std::size_t i0 = ((k >> log2_m) << (log2_m + 1)) + j;
+
+                        const ValueType t = twiddles[j] * a[i0 + m];
+                        a[i0 + m] = a[i0] - t;
+                        a[i0] += t;
+                    }
+                }
+
+                /// In-place decimation-in-time transform of bit-reversed input; natural order output
+                template<typename ValueType>
+                void ntt_process(std::vector<ValueType> &a, const std::vector<ValueType> &twiddles,
+                                 std::size_t log2_size, std::size_t threads_count) {
+                    const std::size_t n = a.size();
+                    const std::size_t block = std::min(n, ntt_cache_block_size);
+
+                    ntt_bit_reverse(a, log2_size, threads_count);
+
+                    // stages with 2m <= block: independent blocks, all of their stages at once
+                    crypto3::detail::parallel_for(
+                        0, n / block, threads_count,
+                        [&](std::size_t begin, std::size_t end) {
+                            for (std::size_t b = begin; b < end; ++b) {
+                                ValueType *chunk = a.data() + b * block;
+                                for (std::size_t m = 1, log2_m = 0; 2 * m <= block; m <<= 1, ++log2_m) {
+                                    ntt_butterflies(chunk, twiddles.data() + m - 1, m, log2_m, 0, block / 2);
+                                }
+                            }
+                        },
+                        1);
+
+                    // remaining stages: split every stage's n / 2 butterflies between threads
+                    std::size_t log2_m = 0;
+                    while ((std::size_t(1) << log2_m) < block) {
+                        ++log2_m;
+                    }
+                    for (std::size_t m = block; m < n; m <<= 1, ++log2_m) {
+                        crypto3::detail::parallel_for(
+                            0, n / 2, threads_count,
+                            [&](std::size_t begin, std::size_t end) {
+                                ntt_butterflies(a.data(), twiddles.data() + m - 1, m, log2_m, begin, end);
+                            },
+                            ntt_min_chunk_size);
+                    }
+                }
+
+                /// a[i] *= factor * shift^i
+                template<typename ValueType>
+                void ntt_scale_by_powers(std::vector<ValueType> &a, const ValueType &factor, const ValueType &shift,
+                                         std::size_t threads_count) {
+                    crypto3::detail::parallel_for(
+                        0, a.size(), threads_count,
+                        [&](std::size_t begin, std::size_t end) {
+                            ValueType w = factor * shift.pow(begin);
+                            for (std::size_t i = begin; i < end; ++i) {
+                                a[i] *= w;
+                                w *= shift;
+                            }
+                        },
+                        ntt_min_chunk_size);
+                }
+
+                template<typename ValueType>
+                void ntt_scale(std::vector<ValueType> &a, const ValueType &factor, std::size_t threads_count) {
+                    crypto3::detail::parallel_for(
+                        0, a.size(), threads_count,
+                        [&](std::size_t begin, std::size_t end) {
+                            for (std::size_t i = begin; i < end; ++i) {
+                                a[i] *= factor;
+                            }
+                        },
+                        ntt_min_chunk_size);
+                }
+            }    // namespace detail
+
+            /*!
+             * @brief Forward transform in place: coefficients a_0..a_{n-1} become the evaluations
+             * a(omega^i), both in natural order.
+             */
+            template<typename FieldType>
+            void ntt(std::vector<typename FieldType::value_type> &a, const ntt_domain<FieldType> &domain,
+                     std::size_t threads_count = 1) {
+                BOOST_ASSERT(a.size() == domain.size());
+
+                detail::ntt_process(a, domain.twiddles(), domain.log2_size(), threads_count);
+            }
+
+            /// Inverse of ntt(): evaluations on the domain back to coefficients
+            template<typename FieldType>
+            void inverse_ntt(std::vector<typename FieldType::value_type> &a, const ntt_domain<FieldType> &domain,
+                             std::size_t threads_count = 1) {
+                BOOST_ASSERT(a.size() == domain.size());
+
+                detail::ntt_process(a, domain.inverse_twiddles(), domain.log2_size(), threads_count);
+                detail::ntt_scale(a, domain.size_inversed(), threads_count);
+            }
+
+            /// Evaluations a(g * omega^i) on the coset of the domain shifted by its coset_shift() g
+            template<typename FieldType>
+            void coset_ntt(std::vector<typename FieldType::value_type> &a, const ntt_domain<FieldType> &domain,
+                           std::size_t threads_count = 1) {
+                typedef typename FieldType::value_type value_type;
+
+                BOOST_ASSERT(a.size() == domain.size());
+
+                detail::ntt_scale_by_powers(a, value_type::one(), domain.coset_shift(), threads_count);
+                detail::ntt_process(a, domain.twiddles(), domain.log2_size(), threads_count);
+            }
+
+            /// Inverse of coset_ntt(); the 1 / n factor is folded into the coset unshifting
+            template<typename FieldType>
+            void inverse_coset_ntt(std::vector<typename FieldType::value_type> &a,
+                                   const ntt_domain<FieldType> &domain, std::size_t threads_count = 1) {
+                BOOST_ASSERT(a.size() == domain.size());
+
+                detail::ntt_process(a, domain.inverse_twiddles(), domain.log2_size(), threads_count);
+                detail::ntt_scale_by_powers(a, domain.size_inversed(), domain.coset_shift_inversed(), threads_count);
+            }
+        }    // namespace algebra
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_NTT_HPP
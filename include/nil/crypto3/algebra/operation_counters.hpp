@@ -0,0 +1,166 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_OPERATION_COUNTERS_HPP
+#define CRYPTO3_ALGEBRA_OPERATION_COUNTERS_HPP
+
+#include <cstdint>
+
+/*!
+ * Opt-in operation counting. Defining CRYPTO3_ALGEBRA_COUNT_OPERATIONS before including any algebra header
+ * makes prime field elements and curve elements tally their multiplications, squarings, inversions,
+ * Montgomery reductions of unreduced products, additions, doublings and mixed additions into per-thread
+ * counters. Without the macro the hooks expand
+ * to nothing, so regular builds pay no cost.
+ *
+ * Counts are taken at the prime field level, so an Fp2 multiplication shows up as the Fp operations it is
+ * built from, and scalar field arithmetic is counted alongside base field arithmetic. An unreduced
+ * multiplication (element_fp_dbl::mul) counts as field_mul; its later reduction counts as field_reduce,
+ * while the reduction inside a regular multiplication is not counted separately. A curve addition that
+ * finds equal inputs counts only as the doubling it falls back to, and one that finds opposite inputs counts
+ * nothing.
+ */
+
+#if defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 9)
+#define CRYPTO3_ALGEBRA_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#else
+#define CRYPTO3_ALGEBRA_IS_CONSTANT_EVALUATED() false
+#endif
+
+#ifdef CRYPTO3_ALGEBRA_COUNT_OPERATIONS
+#define CRYPTO3_ALGEBRA_COUNT_OPERATION(name)                                  \
+    do {                                                                       \
+        if (!CRYPTO3_ALGEBRA_IS_CONSTANT_EVALUATED()) {                        \
+            ++::nil::crypto3::algebra::detail::thread_operation_counts().name; \
+        }                                                                      \
+    } while (false)
+#else
+#define CRYPTO3_ALGEBRA_COUNT_OPERATION(name) \
+    do {                                      \
+    } while (false)
+#endif
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+
+            struct operation_counts {
+                std::uint64_t field_mul = 0;
+                std::uint64_t field_sqr = 0;
+                std::uint64_t field_inv = 0;
+                std::uint64_t field_reduce = 0;
+                std::uint64_t point_add = 0;
+                std::uint64_t point_dbl = 0;
+                std::uint64_t point_madd = 0;
+
+                operation_counts &operator+=(const operation_counts &other) {
+                    field_mul += other.field_mul;
+                    field_sqr += other.field_sqr;
+                    field_inv += other.field_inv;
+                    field_reduce += other.field_reduce;
+                    point_add += other.point_add;
+                    point_dbl += other.point_dbl;
+                    point_madd += other.point_madd;
+                    return *this;
+                }
+
+                operation_counts &operator-=(const operation_counts &other) {
+                    field_mul -= other.field_mul;
+                    field_sqr -= other.field_sqr;
+                    field_inv -= other.field_inv;
+                    field_reduce -= other.field_reduce;
+                    point_add -= other.point_add;
+                    point_dbl -= other.point_dbl;
+                    point_madd -= other.point_madd;
+                    return *this;
+                }
+
+                operation_counts operator+(const operation_counts &other) const {
+                    return operation_counts(*this) += other;
+                }
+
+                operation_counts operator-(const operation_counts &other) const {
+                    return operation_counts(*this) -= other;
+                }
+
+                bool operator==(const operation_counts &other) const {
+                    return field_mul == other.field_mul && field_sqr == other.field_sqr &&
+                           field_inv == other.field_inv && field_reduce == other.field_reduce &&
+                           point_add == other.point_add && point_dbl == other.point_dbl &&
+                           point_madd == other.point_madd;
+                }
+
+                bool operator!=(const operation_counts &other) const {
+                    return !(*this == other);
+                }
+            };
+
+            namespace detail {
+                inline operation_counts &thread_operation_counts() {
+                    thread_local operation_counts counts;
+                    return counts;
+                }
+            }    // namespace detail
+
+            /// Running totals of the calling thread; always zero unless CRYPTO3_ALGEBRA_COUNT_OPERATIONS is set
+            inline operation_counts thread_operation_counts() {
+                return detail::thread_operation_counts();
+            }
+
+            inline void reset_thread_operation_counts() {
+                detail::thread_operation_counts() = operation_counts();
+            }
+
+            /*!
+             * @brief Snapshots the calling thread's counters on construction; counts() returns what was
+             * performed on this thread since then. Work done by helper threads is not included.
+             *
+             * @code
+             * scoped_operation_counter counter;
+             * auto result = pair_reduced<curves::bls12<381>>(P, Q);
+             * operation_counts used = counter.counts();
+             * @endcode
+             */
+            class scoped_operation_counter {
+            public:
+                scoped_operation_counter() : start(detail::thread_operation_counts()) {
+                }
+
+                operation_counts counts() const {
+                    return detail::thread_operation_counts() - start;
+                }
+
+                void restart() {
+                    start = detail::thread_operation_counts();
+                }
+
+            private:
+                operation_counts start;
+            };
+        }    // namespace algebra
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_OPERATION_COUNTERS_HPP
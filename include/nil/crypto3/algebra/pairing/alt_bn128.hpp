@@ -29,11 +29,14 @@
 #include <nil/crypto3/algebra/curves/babyjubjub.hpp>
 #include <nil/crypto3/algebra/curves/alt_bn128.hpp>
 #include <nil/crypto3/algebra/pairing/detail/alt_bn128/254/params.hpp>
-#include <nil/crypto3/algebra/pairing/forms/short_weierstrass/jacobian_with_a4_0/ate_double_miller_loop.hpp>
-#include <nil/crypto3/algebra/pairing/forms/short_weierstrass/jacobian_with_a4_0/ate_miller_loop.hpp>
+#include <nil/crypto3/algebra/pairing/alt_bn128/254/ate_double_miller_loop.hpp>
+#include <nil/crypto3/algebra/pairing/alt_bn128/254/ate_miller_loop.hpp>
 #include <nil/crypto3/algebra/pairing/forms/short_weierstrass/jacobian_with_a4_0/ate_precompute_g1.hpp>
-#include <nil/crypto3/algebra/pairing/forms/short_weierstrass/jacobian_with_a4_0/ate_precompute_g2.hpp>
-#include <nil/crypto3/algebra/pairing/forms/short_weierstrass/jacobian_with_a4_0/final_exponentiation.hpp>
+#include <nil/crypto3/algebra/pairing/alt_bn128/254/ate_precompute_g2.hpp>
+#include <nil/crypto3/algebra/pairing/alt_bn128/254/final_exponentiation.hpp>
+#include <nil/crypto3/algebra/pairing/alt_bn128/254/ate_fused_double_miller_loop.hpp>
+#include <nil/crypto3/algebra/pairing/alt_bn128/254/ate_fused_miller_loop.hpp>
+#include <nil/crypto3/algebra/pairing/forms/short_weierstrass/ate_fused_precompute_g2.hpp>
 #include <nil/crypto3/algebra/pairing/pairing_policy.hpp>
 
 namespace nil {
@@ -48,17 +51,26 @@ namespace nil {
                     using chained_curve_type = curves::babyjubjub;
 
                     using precompute_g1 = pairing::short_weierstrass_jacobian_with_a4_0_ate_precompute_g1<curve_type>;
-                    using precompute_g2 = pairing::short_weierstrass_jacobian_with_a4_0_ate_precompute_g2<curve_type>;
-                    using miller_loop = pairing::short_weierstrass_jacobian_with_a4_0_ate_miller_loop<curve_type>;
-                    using double_miller_loop =
-                        pairing::short_weierstrass_jacobian_with_a4_0_ate_double_miller_loop<curve_type>;
-                    using final_exponentiation =
-                        pairing::short_weierstrass_jacobian_with_a4_0_final_exponentiation<curve_type>;
+                    using precompute_g2 = pairing::alt_bn128_ate_precompute_g2<254>;
+                    using miller_loop = pairing::alt_bn128_ate_miller_loop<254>;
+                    using double_miller_loop = pairing::alt_bn128_ate_double_miller_loop<254>;
+                    using final_exponentiation = pairing::alt_bn128_final_exponentiation<254>;
 
                     using g1_precomputed_type = typename precompute_g1::g1_precomputed_type;
                     using g2_precomputed_type = typename precompute_g2::g2_precomputed_type;
                 };
 
+                template<>
+                struct fused_pairing_policy<curves::alt_bn128<254>> : public pairing_policy<curves::alt_bn128<254>> {
+                    using curve_type = curves::alt_bn128<254>;
+
+                    using precompute_g2 = pairing::short_weierstrass_ate_fused_precompute_g2<curve_type>;
+                    using miller_loop = pairing::alt_bn128_ate_fused_miller_loop<254>;
+                    using double_miller_loop = pairing::alt_bn128_ate_fused_double_miller_loop<254>;
+
+                    using g2_precomputed_type = typename precompute_g2::g2_precomputed_type;
+                };
+
             }    // namespace pairing
         }        // namespace algebra
     }            // namespace crypto3
@@ -0,0 +1,129 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_PAIRING_ALT_BN128_254_ATE_FUSED_DOUBLE_MILLER_LOOP_HPP
+#define CRYPTO3_ALGEBRA_PAIRING_ALT_BN128_254_ATE_FUSED_DOUBLE_MILLER_LOOP_HPP
+
+#include <nil/crypto3/algebra/curves/alt_bn128.hpp>
+#include <nil/crypto3/algebra/pairing/detail/alt_bn128/254/params.hpp>
+#include <nil/crypto3/algebra/pairing/detail/forms/short_weierstrass/jacobian_with_a4_0/types.hpp>
+#include <nil/crypto3/algebra/pairing/alt_bn128/254/ate_precompute_g2.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace pairing {
+
+                template<std::size_t Version = 254>
+                class alt_bn128_ate_fused_double_miller_loop;
+
+                /*!
+                 * @brief Fused variant of alt_bn128_ate_double_miller_loop: both G2 points are stepped
+                 * together and share a single squaring of the accumulator per NAF digit.
+                 */
+                template<>
+                class alt_bn128_ate_fused_double_miller_loop<254> {
+                    using curve_type = curves::alt_bn128<254>;
+
+                    using params_type = detail::pairing_params<curve_type>;
+                    typedef detail::short_weierstrass_jacobian_with_a4_0_types_policy<curve_type> policy_type;
+
+                    using base_field_type = typename curve_type::base_field_type;
+                    using g2_type = typename curve_type::template g2_type<>;
+                    using g2_affine_type = typename curve_type::template g2_type<curves::coordinates::affine>;
+                    using gt_type = typename curve_type::gt_type;
+
+                    using steps_type = alt_bn128_ate_precompute_g2<254>;
+
+                public:
+                    static typename gt_type::value_type
+                        process(const typename policy_type::ate_g1_precomputed_type &prec_P1,
+                                const typename g2_affine_type::value_type &Q1,
+                                const typename policy_type::ate_g1_precomputed_type &prec_P2,
+                                const typename g2_affine_type::value_type &Q2) {
+
+                        const typename base_field_type::value_type two_inv =
+                            typename base_field_type::value_type(0x02).inversed();
+
+                        const typename g2_affine_type::value_type Q1neg = steps_type::negate(Q1);
+                        const typename g2_affine_type::value_type Q2neg = steps_type::negate(Q2);
+
+                        typename g2_type::value_type R1, R2;
+                        R1.X = Q1.X;
+                        R1.Y = Q1.Y;
+                        R1.Z = g2_type::field_type::value_type::one();
+                        R2.X = Q2.X;
+                        R2.Y = Q2.Y;
+                        R2.Z = g2_type::field_type::value_type::one();
+
+                        typename gt_type::value_type f = gt_type::value_type::one();
+
+                        typename policy_type::ate_ell_coeffs c1, c2;
+
+                        for (long i = params_type::ate_loop_count_naf_size - 2; i >= 0; --i) {
+                            steps_type::doubling_step_for_miller_loop(two_inv, R1, c1);
+                            steps_type::doubling_step_for_miller_loop(two_inv, R2, c2);
+
+                            f = f.squared();
+
+                            f = f.mul_by_024(c1.ell_0, prec_P1.PY * c1.ell_VW, prec_P1.PX * c1.ell_VV);
+                            f = f.mul_by_024(c2.ell_0, prec_P2.PY * c2.ell_VW, prec_P2.PX * c2.ell_VV);
+
+                            if (params_type::ate_loop_count_naf[i] != 0) {
+                                const bool positive = params_type::ate_loop_count_naf[i] > 0;
+                                steps_type::mixed_addition_step_for_miller_loop(positive ? Q1 : Q1neg, R1, c1);
+                                steps_type::mixed_addition_step_for_miller_loop(positive ? Q2 : Q2neg, R2, c2);
+
+                                f = f.mul_by_024(c1.ell_0, prec_P1.PY * c1.ell_VW, prec_P1.PX * c1.ell_VV);
+                                f = f.mul_by_024(c2.ell_0, prec_P2.PY * c2.ell_VW, prec_P2.PX * c2.ell_VV);
+                            }
+                        }
+
+                        /* lines through pi(Q) and -pi^2(Q) for both points */
+                        const typename g2_affine_type::value_type Q1_q = steps_type::mul_by_q(Q1);
+                        const typename g2_affine_type::value_type Q2_q = steps_type::mul_by_q(Q2);
+                        const typename g2_affine_type::value_type Q1_q2 =
+                            steps_type::negate(steps_type::mul_by_q(Q1_q));
+                        const typename g2_affine_type::value_type Q2_q2 =
+                            steps_type::negate(steps_type::mul_by_q(Q2_q));
+
+                        steps_type::mixed_addition_step_for_miller_loop(Q1_q, R1, c1);
+                        steps_type::mixed_addition_step_for_miller_loop(Q2_q, R2, c2);
+                        f = f.mul_by_024(c1.ell_0, prec_P1.PY * c1.ell_VW, prec_P1.PX * c1.ell_VV);
+                        f = f.mul_by_024(c2.ell_0, prec_P2.PY * c2.ell_VW, prec_P2.PX * c2.ell_VV);
+
+                        steps_type::mixed_addition_step_for_miller_loop(Q1_q2, R1, c1);
+                        steps_type::mixed_addition_step_for_miller_loop(Q2_q2, R2, c2);
+                        f = f.mul_by_024(c1.ell_0, prec_P1.PY * c1.ell_VW, prec_P1.PX * c1.ell_VV);
+                        f = f.mul_by_024(c2.ell_0, prec_P2.PY * c2.ell_VW, prec_P2.PX * c2.ell_VV);
+
+                        return f;
+                    }
+                };
+            }    // namespace pairing
+        }        // namespace algebra
+    }            // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_ALGEBRA_PAIRING_ALT_BN128_254_ATE_FUSED_DOUBLE_MILLER_LOOP_HPP
@@ -0,0 +1,107 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_PAIRING_ALT_BN128_254_ATE_FUSED_MILLER_LOOP_HPP
+#define CRYPTO3_ALGEBRA_PAIRING_ALT_BN128_254_ATE_FUSED_MILLER_LOOP_HPP
+
+#include <nil/crypto3/algebra/curves/alt_bn128.hpp>
+#include <nil/crypto3/algebra/pairing/detail/alt_bn128/254/params.hpp>
+#include <nil/crypto3/algebra/pairing/detail/forms/short_weierstrass/jacobian_with_a4_0/types.hpp>
+#include <nil/crypto3/algebra/pairing/alt_bn128/254/ate_precompute_g2.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace pairing {
+
+                template<std::size_t Version = 254>
+                class alt_bn128_ate_fused_miller_loop;
+
+                /*!
+                 * @brief Optimal ate Miller loop for BN254 which evaluates the line functions inline
+                 * instead of walking a precomputed coefficients vector.
+                 */
+                template<>
+                class alt_bn128_ate_fused_miller_loop<254> {
+                    using curve_type = curves::alt_bn128<254>;
+
+                    using params_type = detail::pairing_params<curve_type>;
+                    typedef detail::short_weierstrass_jacobian_with_a4_0_types_policy<curve_type> policy_type;
+
+                    using base_field_type = typename curve_type::base_field_type;
+                    using g2_type = typename curve_type::template g2_type<>;
+                    using g2_affine_type = typename curve_type::template g2_type<curves::coordinates::affine>;
+                    using gt_type = typename curve_type::gt_type;
+
+                    using steps_type = alt_bn128_ate_precompute_g2<254>;
+
+                public:
+                    static typename gt_type::value_type
+                        process(const typename policy_type::ate_g1_precomputed_type &prec_P,
+                                const typename g2_affine_type::value_type &Q) {
+
+                        const typename base_field_type::value_type two_inv =
+                            typename base_field_type::value_type(0x02).inversed();
+
+                        const typename g2_affine_type::value_type Qneg = steps_type::negate(Q);
+
+                        typename g2_type::value_type R;
+                        R.X = Q.X;
+                        R.Y = Q.Y;
+                        R.Z = g2_type::field_type::value_type::one();
+
+                        typename gt_type::value_type f = gt_type::value_type::one();
+
+                        typename policy_type::ate_ell_coeffs c;
+
+                        for (long i = params_type::ate_loop_count_naf_size - 2; i >= 0; --i) {
+                            steps_type::doubling_step_for_miller_loop(two_inv, R, c);
+                            f = f.squared();
+                            f = f.mul_by_024(c.ell_0, prec_P.PY * c.ell_VW, prec_P.PX * c.ell_VV);
+
+                            if (params_type::ate_loop_count_naf[i] != 0) {
+                                steps_type::mixed_addition_step_for_miller_loop(
+                                    params_type::ate_loop_count_naf[i] > 0 ? Q : Qneg, R, c);
+                                f = f.mul_by_024(c.ell_0, prec_P.PY * c.ell_VW, prec_P.PX * c.ell_VV);
+                            }
+                        }
+
+                        const typename g2_affine_type::value_type Q1 = steps_type::mul_by_q(Q);
+                        const typename g2_affine_type::value_type Q2 = steps_type::negate(steps_type::mul_by_q(Q1));
+
+                        steps_type::mixed_addition_step_for_miller_loop(Q1, R, c);
+                        f = f.mul_by_024(c.ell_0, prec_P.PY * c.ell_VW, prec_P.PX * c.ell_VV);
+
+                        steps_type::mixed_addition_step_for_miller_loop(Q2, R, c);
+                        f = f.mul_by_024(c.ell_0, prec_P.PY * c.ell_VW, prec_P.PX * c.ell_VV);
+
+                        return f;
+                    }
+                };
+            }    // namespace pairing
+        }        // namespace algebra
+    }            // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_ALGEBRA_PAIRING_ALT_BN128_254_ATE_FUSED_MILLER_LOOP_HPP
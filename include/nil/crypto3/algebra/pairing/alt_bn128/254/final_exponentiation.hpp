@@ -0,0 +1,138 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_PAIRING_ALT_BN128_254_FINAL_EXPONENTIATION_HPP
+#define CRYPTO3_ALGEBRA_PAIRING_ALT_BN128_254_FINAL_EXPONENTIATION_HPP
+
+#include <nil/crypto3/algebra/curves/alt_bn128.hpp>
+#include <nil/crypto3/algebra/pairing/detail/alt_bn128/254/params.hpp>
+#include <nil/crypto3/algebra/pairing/detail/forms/short_weierstrass/jacobian_with_a4_0/types.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace pairing {
+
+                template<std::size_t Version = 254>
+                class alt_bn128_final_exponentiation;
+
+                template<>
+                class alt_bn128_final_exponentiation<254> {
+                    using curve_type = curves::alt_bn128<254>;
+
+                    using params_type = detail::pairing_params<curve_type>;
+                    typedef detail::short_weierstrass_jacobian_with_a4_0_types_policy<curve_type> policy_type;
+
+                    using gt_type = typename curve_type::gt_type;
+
+                    static typename gt_type::value_type
+                        final_exponentiation_first_chunk(const typename gt_type::value_type &elt) {
+
+                        /*
+                          Computes result = elt^((q^6-1)*(q^2+1)).
+                          Follows, e.g., Beuchat et al page 9, by computing result as follows:
+                             elt^((q^6-1)*(q^2+1)) = (conj(elt) * elt^(-1))^(q^2+1)
+                          More precisely:
+                          A = conj(elt)
+                          B = elt.inversed()
+                          C = A * B
+                          D = C.Frobenius_map(2)
+                          result = D * C
+                        */
+
+                        const typename gt_type::value_type A = elt.unitary_inversed();
+                        const typename gt_type::value_type B = elt.inversed();
+                        const typename gt_type::value_type C = A * B;
+                        const typename gt_type::value_type D = C.Frobenius_map(2);
+                        const typename gt_type::value_type result = D * C;
+
+                        return result;
+                    }
+
+                    static typename gt_type::value_type exp_by_neg_z(const typename gt_type::value_type &elt) {
+
+                        typename gt_type::value_type result = elt.cyclotomic_exp(params_type::final_exponent_z);
+                        if (!params_type::final_exponent_is_z_neg) {
+                            result = result.unitary_inversed();
+                        }
+
+                        return result;
+                    }
+
+                    static typename gt_type::value_type
+                        final_exponentiation_last_chunk(const typename gt_type::value_type &elt) {
+
+                        /*
+                          Follows Laura Fuentes-Castaneda et al. "Faster hashing to G2" by computing
+
+                          result = elt^(q^3 * (12*z^3 + 6z^2 + 4z - 1) +
+                                        q^2 * (12*z^3 + 6z^2 + 6z) +
+                                        q   * (12*z^3 + 6z^2 + 4z) +
+                                        1   * (12*z^3 + 12z^2 + 6z + 1))
+
+                          which equals result = elt^(2z * (6z^2 + 3z + 1) * (q^4 - q^2 + 1) / r).
+                        */
+
+                        const typename gt_type::value_type A = exp_by_neg_z(elt);         // elt^(-z)
+                        const typename gt_type::value_type B = A.cyclotomic_squared();    // elt^(-2z)
+                        const typename gt_type::value_type C = B.cyclotomic_squared();    // elt^(-4z)
+                        const typename gt_type::value_type D = C * B;                     // elt^(-6z)
+                        const typename gt_type::value_type E = exp_by_neg_z(D);           // elt^(6z^2)
+                        const typename gt_type::value_type F = E.cyclotomic_squared();    // elt^(12z^2)
+                        const typename gt_type::value_type G = exp_by_neg_z(F);           // elt^(-12z^3)
+                        const typename gt_type::value_type H = D.unitary_inversed();      // elt^(6z)
+                        const typename gt_type::value_type I = G.unitary_inversed();      // elt^(12z^3)
+                        const typename gt_type::value_type J = I * E;                     // elt^(12z^3 + 6z^2)
+                        const typename gt_type::value_type K = J * H;    // elt^(12z^3 + 6z^2 + 6z)
+                        const typename gt_type::value_type L = K * B;    // elt^(12z^3 + 6z^2 + 4z)
+                        const typename gt_type::value_type M = K * E;    // elt^(12z^3 + 12z^2 + 6z)
+                        const typename gt_type::value_type N = M * elt;    // elt^(12z^3 + 12z^2 + 6z + 1)
+                        const typename gt_type::value_type O = L.Frobenius_map(1);    // elt^(q * (12z^3 + 6z^2 + 4z))
+                        const typename gt_type::value_type P = O * N;
+                        const typename gt_type::value_type Q = K.Frobenius_map(2);    // elt^(q^2 * (12z^3 + 6z^2 + 6z))
+                        const typename gt_type::value_type R = Q * P;
+                        const typename gt_type::value_type S = elt.unitary_inversed();    // elt^(-1)
+                        const typename gt_type::value_type T = S * L;                     // elt^(12z^3 + 6z^2 + 4z - 1)
+                        const typename gt_type::value_type U =
+                            T.Frobenius_map(3);    // elt^(q^3 * (12z^3 + 6z^2 + 4z - 1))
+                        const typename gt_type::value_type V = U * R;
+
+                        return V;
+                    }
+
+                public:
+                    static typename gt_type::value_type process(const typename gt_type::value_type &elt) {
+
+                        typename gt_type::value_type A = final_exponentiation_first_chunk(elt);
+                        typename gt_type::value_type result = final_exponentiation_last_chunk(A);
+
+                        return result;
+                    }
+                };
+            }    // namespace pairing
+        }        // namespace algebra
+    }            // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_ALGEBRA_PAIRING_ALT_BN128_254_FINAL_EXPONENTIATION_HPP
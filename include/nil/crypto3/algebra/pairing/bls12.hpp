@@ -34,6 +34,10 @@
 #include <nil/crypto3/algebra/pairing/forms/short_weierstrass/jacobian_with_a4_0/ate_precompute_g1.hpp>
 #include <nil/crypto3/algebra/pairing/forms/short_weierstrass/jacobian_with_a4_0/ate_precompute_g2.hpp>
 #include <nil/crypto3/algebra/pairing/forms/short_weierstrass/jacobian_with_a4_0/final_exponentiation.hpp>
+#include <nil/crypto3/algebra/pairing/forms/short_weierstrass/jacobian_with_a4_0/ate_fused_double_miller_loop.hpp>
+#include <nil/crypto3/algebra/pairing/forms/short_weierstrass/jacobian_with_a4_0/ate_fused_miller_loop.hpp>
+#include <nil/crypto3/algebra/pairing/forms/short_weierstrass/jacobian_with_a4_0/ate_fused_multi_miller_loop.hpp>
+#include <nil/crypto3/algebra/pairing/forms/short_weierstrass/ate_fused_precompute_g2.hpp>
 #include <nil/crypto3/algebra/pairing/pairing_policy.hpp>
 
 namespace nil {
@@ -52,6 +56,8 @@ namespace nil {
                     using miller_loop = pairing::short_weierstrass_jacobian_with_a4_0_ate_miller_loop<curve_type>;
                     using double_miller_loop =
                         pairing::short_weierstrass_jacobian_with_a4_0_ate_double_miller_loop<curve_type>;
+                    using multi_miller_loop =
+                        pairing::short_weierstrass_jacobian_with_a4_0_ate_fused_multi_miller_loop<curve_type>;
                     using final_exponentiation =
                         pairing::short_weierstrass_jacobian_with_a4_0_final_exponentiation<curve_type>;
 
@@ -59,6 +65,18 @@ namespace nil {
                     using g2_precomputed_type = typename precompute_g2::g2_precomputed_type;
                 };
 
+                template<>
+                struct fused_pairing_policy<curves::bls12<381>> : public pairing_policy<curves::bls12<381>> {
+                    using curve_type = curves::bls12<381>;
+
+                    using precompute_g2 = pairing::short_weierstrass_ate_fused_precompute_g2<curve_type>;
+                    using miller_loop = pairing::short_weierstrass_jacobian_with_a4_0_ate_fused_miller_loop<curve_type>;
+                    using double_miller_loop =
+                        pairing::short_weierstrass_jacobian_with_a4_0_ate_fused_double_miller_loop<curve_type>;
+
+                    using g2_precomputed_type = typename precompute_g2::g2_precomputed_type;
+                };
+
             }    // namespace pairing
         }        // namespace algebra
     }            // namespace crypto3
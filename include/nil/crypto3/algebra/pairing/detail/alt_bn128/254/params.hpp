@@ -23,8 +23,11 @@
 // SOFTWARE.
 //---------------------------------------------------------------------------//
 
-#ifndef CRYPTO3_ALGEBRA_PAIRING_ALT_BN128_PAIRING_PARAMS_HPP
-#define CRYPTO3_ALGEBRA_PAIRING_ALT_BN128_PAIRING_PARAMS_HPP
+#ifndef CRYPTO3_ALGEBRA_PAIRING_ALT_BN128_254_PARAMS_HPP
+#define CRYPTO3_ALGEBRA_PAIRING_ALT_BN128_254_PARAMS_HPP
+
+#include <array>
+#include <cstdint>
 
 #include <nil/crypto3/algebra/curves/alt_bn128.hpp>
 
@@ -54,11 +57,33 @@ namespace nil {
                             0x2F4B6DC97020FDDADF107D20BC842D43BF6369B1FF6A1C71015F3F7BE2E1E30A73BB94FEC0DAF15466B2383A5D3EC3D15AD524D8F70C54EFEE1BD8C3B21377E563A09A1B705887E72ECEADDEA3790364A61F676BAAF977870E88D5C6C8FEF0781361E443AE77F5B63A2A2264487F2940A8B1DDB3D15062CD0FB2015DFC6668449AED3CC48A82D0D602D268C7DAAB6A41294C0CC4EBE5664568DFC50E1648A45A4A1E3A5195846A3ED011A337A02088EC80E0EBAE8755CFE107ACF3AAFB40494E406F804216BB10CF430B0F37856B42DB8DC5514724EE93DFB10826F0DD4A0364B9580291D2CD65664814FDE37CA80BB4EA44EACC5E641BBADF423F9A2CBF813B8D145DA90029BAEE7DDADDA71C7F3811C4105262945BBA1668C3BE69A3C230974D83561841D766F9C9D570BB7FBE04C7E8A6C3C760C0DE81DEF35692DA361102B6B9B2B918837FA97896E84ABB40A4EFB7E54523A486964B64CA86F120_cppui2790);
 
                         constexpr static const integral_type final_exponent_z = integral_type(0x44E992B44A6909F1);
-                        constexpr static const integral_type final_exponent_is_z_neg = false;
-
-                        using g2_field_type_value = typename curve_type::g2_type::field_type::value_type;
-
-                        constexpr static const g2_field_type_value twist = g2_type::params_type::twist;
+                        constexpr static const bool final_exponent_is_z_neg = false;
+
+                        /// Non-adjacent form of ate_loop_count = 6 * final_exponent_z + 2, least significant digit
+                        /// first.
+                        constexpr static const std::size_t ate_loop_count_naf_size = 66;
+                        constexpr static const std::array<std::int8_t, ate_loop_count_naf_size> ate_loop_count_naf = {
+                             0,  0,  0,  1,  0,  1,  0, -1,  0,  0, -1,  0,  0,  0,  1,  0,  0, -1,  0, -1,  0,  0,
+                             0,  1,  0, -1,  0,  0,  0,  0, -1,  0,  0,  1,  0, -1,  0,  0,  1,  0,  0,  0,  0,  0,
+                            -1,  0,  0, -1,  0,  1,  0, -1,  0,  0,  0, -1,  0, -1,  0,  0,  0,  1,  0, -1,  0,  1};
+
+                        using g2_field_type_value = typename curve_type::template g2_type<>::field_type::value_type;
+
+                        constexpr static const g2_field_type_value twist =
+                            curve_type::template g2_type<>::params_type::twist;
+
+                        constexpr static const g2_field_type_value twist_coeff_b =
+                            curve_type::template g2_type<>::params_type::b;
+
+                        /// Coefficients of the Frobenius endomorphism on the twist:
+                        /// pi(x, y) = (twist_mul_by_q_X * conj(x), twist_mul_by_q_Y * conj(y)),
+                        /// twist_mul_by_q_X = twist^((q-1)/3), twist_mul_by_q_Y = twist^((q-1)/2).
+                        constexpr static const g2_field_type_value twist_mul_by_q_X = g2_field_type_value(
+                            0x2FB347984F7911F74C0BEC3CF559B143B78CC310C2C3330C99E39557176F553D_cppui254,
+                            0x16C9E55061EBAE204BA4CC8BD75A079432AE2A1D0B7C9DCE1665D51C640FCBA2_cppui253);
+                        constexpr static const g2_field_type_value twist_mul_by_q_Y = g2_field_type_value(
+                            0x63CF305489AF5DCDC5EC698B6E2F9B9DBAAE0EDA9C95998DC54014671A0135A_cppui251,
+                            0x7C03CBCAC41049A0704B5A7EC796F2B21807DC98FA25BD282D37F632623B0E3_cppui251);
                     };
 
                     constexpr typename pairing_params<curves::alt_bn128<254>>::integral_type const
@@ -70,6 +95,20 @@ namespace nil {
                     constexpr typename pairing_params<curves::alt_bn128<254>>::extended_integral_type const
                         pairing_params<curves::alt_bn128<254>>::final_exponent;
 
+                    constexpr std::size_t const pairing_params<curves::alt_bn128<254>>::ate_loop_count_naf_size;
+                    constexpr std::array<std::int8_t,
+                                         pairing_params<curves::alt_bn128<254>>::ate_loop_count_naf_size> const
+                        pairing_params<curves::alt_bn128<254>>::ate_loop_count_naf;
+
+                    constexpr typename pairing_params<curves::alt_bn128<254>>::g2_field_type_value const
+                        pairing_params<curves::alt_bn128<254>>::twist;
+                    constexpr typename pairing_params<curves::alt_bn128<254>>::g2_field_type_value const
+                        pairing_params<curves::alt_bn128<254>>::twist_coeff_b;
+                    constexpr typename pairing_params<curves::alt_bn128<254>>::g2_field_type_value const
+                        pairing_params<curves::alt_bn128<254>>::twist_mul_by_q_X;
+                    constexpr typename pairing_params<curves::alt_bn128<254>>::g2_field_type_value const
+                        pairing_params<curves::alt_bn128<254>>::twist_mul_by_q_Y;
+
                     constexpr bool const pairing_params<curves::alt_bn128<254>>::ate_is_loop_count_neg;
                     constexpr bool const pairing_params<curves::alt_bn128<254>>::final_exponent_is_z_neg;
 
@@ -79,4 +118,4 @@ namespace nil {
     }                // namespace crypto3
 }    // namespace nil
 
-#endif    // CRYPTO3_ALGEBRA_PAIRING_ALT_BN128_PAIRING_PARAMS_HPP
+#endif    // CRYPTO3_ALGEBRA_PAIRING_ALT_BN128_254_PARAMS_HPP
@@ -0,0 +1,105 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_PAIRING_EDWARDS_183_CONIC_LINE_HPP
+#define CRYPTO3_ALGEBRA_PAIRING_EDWARDS_183_CONIC_LINE_HPP
+
+#include <nil/crypto3/algebra/curves/edwards.hpp>
+#include <nil/crypto3/algebra/pairing/detail/edwards/183/types.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace pairing {
+                namespace detail {
+
+                    template<typename CurveType>
+                    class conic_line_functions;
+
+                    /*!
+                     * @brief Multiplication of a Miller loop accumulator f = f0 + f1 * w in Fp6 = Fp3[w] by a conic
+                     * line evaluated at a point. The line is kept as its two Fp3 halves, each obtained from base field
+                     * scalings of the precomputed Fp3 coefficients, and is folded into f with one Karatsuba product,
+                     * so no Fp6 line element is ever built. For the Tate line the constant term c_XZ lies in Fp and
+                     * only touches the first coordinate of the first half.
+                     */
+                    template<>
+                    class conic_line_functions<curves::edwards<183>> {
+                        using curve_type = curves::edwards<183>;
+
+                        typedef types_policy<curve_type> policy_type;
+                        using gt_value_type = typename curve_type::gt_type::value_type;
+                        using g2_field_value_type = typename policy_type::g2_field_value_type;
+
+                        static gt_value_type mul_by_line(const gt_value_type &f, const g2_field_value_type &l0,
+                                                         const g2_field_value_type &l1) {
+
+                            const g2_field_value_type v0 = f.data[0] * l0;
+                            const g2_field_value_type v1 = f.data[1] * l1;
+
+                            return gt_value_type(v0 + gt_value_type::mul_by_non_residue(v1),
+                                                 (f.data[0] + f.data[1]) * (l0 + l1) - v0 - v1);
+                        }
+
+                    public:
+                        /// f * (c_XZ + c_XY * y0 + c_ZZ * eta * w), the Tate line at Q
+                        static gt_value_type mul_by_tate_line(const gt_value_type &f,
+                                                              const typename policy_type::Fq_conic_coefficients &cc,
+                                                              const typename policy_type::tate_g2_precomp &prec_Q) {
+
+                            g2_field_value_type l0 = cc.c_XY * prec_Q.y0;
+                            l0.data[0] += cc.c_XZ;
+
+                            return mul_by_line(f, l0, cc.c_ZZ * prec_Q.eta);
+                        }
+
+                        /// f * (P_XY * c_XY + P_XZ * c_XZ + P_ZZplusYZ * c_ZZ * w), the ate doubling line at P
+                        static gt_value_type
+                            mul_by_ate_line(const gt_value_type &f,
+                                            const typename policy_type::ate_g1_precomputed_type &prec_P,
+                                            const typename policy_type::Fq3_conic_coefficients &cc) {
+
+                            return mul_by_line(f, prec_P.P_XY * cc.c_XY + prec_P.P_XZ * cc.c_XZ,
+                                               prec_P.P_ZZplusYZ * cc.c_ZZ);
+                        }
+
+                        /// f * (P_ZZplusYZ * c_ZZ + (P_XY * c_XY + P_XZ * c_XZ) * w), the ate addition line at P
+                        static gt_value_type
+                            mul_by_flipped_ate_line(const gt_value_type &f,
+                                                    const typename policy_type::ate_g1_precomputed_type &prec_P,
+                                                    const typename policy_type::Fq3_conic_coefficients &cc) {
+
+                            return mul_by_line(f, prec_P.P_ZZplusYZ * cc.c_ZZ,
+                                               prec_P.P_XY * cc.c_XY + prec_P.P_XZ * cc.c_XZ);
+                        }
+                    };
+
+                }    // namespace detail
+            }        // namespace pairing
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_PAIRING_EDWARDS_183_CONIC_LINE_HPP
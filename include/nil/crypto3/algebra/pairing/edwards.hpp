@@ -30,9 +30,13 @@
 #include <nil/crypto3/algebra/pairing/detail/edwards/183/params.hpp>
 #include <nil/crypto3/algebra/pairing/edwards/183/ate_double_miller_loop.hpp>
 #include <nil/crypto3/algebra/pairing/edwards/183/ate_miller_loop.hpp>
+#include <nil/crypto3/algebra/pairing/edwards/183/ate_multi_miller_loop.hpp>
 #include <nil/crypto3/algebra/pairing/edwards/183/ate_precompute_g1.hpp>
 #include <nil/crypto3/algebra/pairing/edwards/183/ate_precompute_g2.hpp>
 #include <nil/crypto3/algebra/pairing/edwards/183/final_exponentiation.hpp>
+#include <nil/crypto3/algebra/pairing/edwards/183/tate_miller_loop.hpp>
+#include <nil/crypto3/algebra/pairing/edwards/183/tate_precompute_g1.hpp>
+#include <nil/crypto3/algebra/pairing/edwards/183/tate_precompute_g2.hpp>
 #include <nil/crypto3/algebra/pairing/pairing_policy.hpp>
 
 namespace nil {
@@ -48,10 +52,19 @@ namespace nil {
                     using precompute_g2 = pairing::edwards_ate_precompute_g2<183>;
                     using miller_loop = pairing::edwards_ate_miller_loop<183>;
                     using double_miller_loop = pairing::edwards_ate_double_miller_loop<183>;
+                    using multi_miller_loop = pairing::edwards_ate_multi_miller_loop<183>;
                     using final_exponentiation = pairing::edwards_final_exponentiation<183>;
 
                     using g1_precomputed_type = typename precompute_g1::g1_precomputed_type;
                     using g2_precomputed_type = typename precompute_g2::g2_precomputed_type;
+
+                    // Reduced Tate pairing, kept for libsnark-compatible verifiers; shares final_exponentiation
+                    using tate_precompute_g1 = pairing::edwards_tate_precompute_g1<183>;
+                    using tate_precompute_g2 = pairing::edwards_tate_precompute_g2<183>;
+                    using tate_miller_loop = pairing::edwards_tate_miller_loop<183>;
+
+                    using tate_g1_precomputed_type = typename tate_precompute_g1::g1_precomputed_type;
+                    using tate_g2_precomputed_type = typename tate_precompute_g2::g2_precomputed_type;
                 };
 
             }    // namespace pairing
@@ -32,6 +32,7 @@
 #include <nil/crypto3/algebra/curves/edwards.hpp>
 #include <nil/crypto3/algebra/pairing/detail/edwards/183/params.hpp>
 #include <nil/crypto3/algebra/pairing/detail/edwards/183/types.hpp>
+#include <nil/crypto3/algebra/pairing/detail/edwards/183/conic_line.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -49,6 +50,8 @@ namespace nil {
                     typedef detail::types_policy<curve_type> policy_type;
                     using gt_type = typename curve_type::gt_type;
 
+                    typedef detail::conic_line_functions<curve_type> line_functions;
+
                 public:
                     static typename gt_type::value_type
                         process(const typename policy_type::ate_g1_precomputed_type &prec_P1,
@@ -74,26 +77,14 @@ namespace nil {
                             /* code below gets executed for all bits (EXCEPT the MSB itself) of
                                param_p (skipping leading zeros) in MSB to LSB
                                order */
-                            typename policy_type::Fq3_conic_coefficients cc1 = prec_Q1[idx];
-                            typename policy_type::Fq3_conic_coefficients cc2 = prec_Q2[idx];
+                            f = line_functions::mul_by_ate_line(f.squared(), prec_P1, prec_Q1[idx]);
+                            f = line_functions::mul_by_ate_line(f, prec_P2, prec_Q2[idx]);
                             ++idx;
 
-                            typename gt_type::value_type g_RR_at_P1 = typename gt_type::value_type(
-                                prec_P1.P_XY * cc1.c_XY + prec_P1.P_XZ * cc1.c_XZ, prec_P1.P_ZZplusYZ * cc1.c_ZZ);
-
-                            typename gt_type::value_type g_RR_at_P2 = typename gt_type::value_type(
-                                prec_P2.P_XY * cc2.c_XY + prec_P2.P_XZ * cc2.c_XZ, prec_P2.P_ZZplusYZ * cc2.c_ZZ);
-                            f = f.squared() * g_RR_at_P1 * g_RR_at_P2;
-
                             if (bit) {
-                                cc1 = prec_Q1[idx];
-                                cc2 = prec_Q2[idx];
+                                f = line_functions::mul_by_flipped_ate_line(f, prec_P1, prec_Q1[idx]);
+                                f = line_functions::mul_by_flipped_ate_line(f, prec_P2, prec_Q2[idx]);
                                 ++idx;
-                                typename gt_type::value_type g_RQ_at_P1 = typename gt_type::value_type(
-                                    prec_P1.P_ZZplusYZ * cc1.c_ZZ, prec_P1.P_XY * cc1.c_XY + prec_P1.P_XZ * cc1.c_XZ);
-                                typename gt_type::value_type g_RQ_at_P2 = typename gt_type::value_type(
-                                    prec_P2.P_ZZplusYZ * cc2.c_ZZ, prec_P2.P_XY * cc2.c_XY + prec_P2.P_XZ * cc2.c_XZ);
-                                f = f * g_RQ_at_P1 * g_RQ_at_P2;
                             }
                         }
 
@@ -32,6 +32,7 @@
 #include <nil/crypto3/algebra/curves/edwards.hpp>
 #include <nil/crypto3/algebra/pairing/detail/edwards/183/params.hpp>
 #include <nil/crypto3/algebra/pairing/detail/edwards/183/types.hpp>
+#include <nil/crypto3/algebra/pairing/detail/edwards/183/conic_line.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -49,6 +50,8 @@ namespace nil {
                     typedef detail::types_policy<curve_type> policy_type;
                     using gt_type = typename curve_type::gt_type;
 
+                    typedef detail::conic_line_functions<curve_type> line_functions;
+
                 public:
                     static typename gt_type::value_type process(const policy_type::ate_g1_precomputed_type &prec_P,
                                                                 const policy_type::ate_g2_precomputed_type &prec_Q) {
@@ -71,16 +74,9 @@ namespace nil {
                             /* code below gets executed for all bits (EXCEPT the MSB itself) of
                                param_p (skipping leading zeros) in MSB to LSB
                                order */
-                            typename policy_type::Fq3_conic_coefficients cc = prec_Q[idx++];
-
-                            typename gt_type::value_type g_RR_at_P = typename gt_type::value_type(
-                                prec_P.P_XY * cc.c_XY + prec_P.P_XZ * cc.c_XZ, prec_P.P_ZZplusYZ * cc.c_ZZ);
-                            f = f.squared() * g_RR_at_P;
+                            f = line_functions::mul_by_ate_line(f.squared(), prec_P, prec_Q[idx++]);
                             if (bit) {
-                                cc = prec_Q[idx++];
-                                typename gt_type::value_type g_RQ_at_P = typename gt_type::value_type(
-                                    prec_P.P_ZZplusYZ * cc.c_ZZ, prec_P.P_XY * cc.c_XY + prec_P.P_XZ * cc.c_XZ);
-                                f = f * g_RQ_at_P;
+                                f = line_functions::mul_by_flipped_ate_line(f, prec_P, prec_Q[idx++]);
                             }
                         }
 
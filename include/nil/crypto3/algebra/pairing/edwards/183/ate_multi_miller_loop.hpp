@@ -0,0 +1,129 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_PAIRING_EDWARDS_183_ATE_MULTI_MILLER_LOOP_HPP
+#define CRYPTO3_ALGEBRA_PAIRING_EDWARDS_183_ATE_MULTI_MILLER_LOOP_HPP
+
+#include <vector>
+
+#include <boost/assert.hpp>
+
+#include <nil/crypto3/multiprecision/number.hpp>
+#include <nil/crypto3/multiprecision/cpp_int.hpp>
+
+#include <nil/crypto3/algebra/curves/edwards.hpp>
+#include <nil/crypto3/algebra/pairing/detail/edwards/183/params.hpp>
+#include <nil/crypto3/algebra/pairing/detail/edwards/183/types.hpp>
+#include <nil/crypto3/algebra/pairing/detail/edwards/183/conic_line.hpp>
+#include <nil/crypto3/algebra/pairing/edwards/183/ate_precompute_g2.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace pairing {
+
+                /*!
+                 * @brief Ate Miller loop computing the product f_{P_1,Q_1} * ... * f_{P_N,Q_N} in a single pass.
+                 * The accumulator is squared once per bit of the loop count for all pairs, and the conic
+                 * coefficients of every Q_j are produced on the fly from its running multiple instead of being
+                 * read back from a precomputed vector. Feeding the result to a single final exponentiation gives
+                 * the product of N reduced pairings.
+                 * @tparam Version
+                 */
+                template<std::size_t Version = 183>
+                class edwards_ate_multi_miller_loop;
+
+                template<>
+                class edwards_ate_multi_miller_loop<183> {
+                    using curve_type = curves::edwards<183>;
+
+                    using params_type = detail::pairing_params<curve_type>;
+                    typedef detail::types_policy<curve_type> policy_type;
+                    using g2_affine_type = typename curve_type::template g2_type<curves::coordinates::affine>;
+                    using gt_type = typename curve_type::gt_type;
+
+                    typedef detail::conic_line_functions<curve_type> line_functions;
+
+                    using steps_type = edwards_ate_precompute_g2<183>;
+                    using extended_g2_projective = typename steps_type::extended_g2_projective;
+
+                public:
+                    static typename gt_type::value_type
+                        process(const std::vector<typename policy_type::ate_g1_precomputed_type> &prec_P,
+                                const std::vector<typename g2_affine_type::value_type> &Q) {
+
+                        BOOST_ASSERT(prec_P.size() == Q.size());
+
+                        const std::size_t n = Q.size();
+
+                        std::vector<extended_g2_projective> Q_ext(n);
+                        for (std::size_t j = 0; j < n; ++j) {
+                            const typename g2_affine_type::value_type Qcopy = Q[j].to_affine();
+                            Q_ext[j].X = Qcopy.X;
+                            Q_ext[j].Y = Qcopy.Y;
+                            Q_ext[j].Z = Qcopy.Z;
+                            Q_ext[j].T = Qcopy.X * Qcopy.Y;
+                        }
+                        std::vector<extended_g2_projective> R = Q_ext;
+
+                        typename gt_type::value_type f = gt_type::value_type::one();
+
+                        bool found_one = false;
+
+                        const typename policy_type::integral_type &loop_count = params_type::ate_loop_count;
+
+                        typename policy_type::Fq3_conic_coefficients cc;
+
+                        for (long i = params_type::integral_type_max_bits - 1; i >= 0; --i) {
+                            const bool bit = nil::crypto3::multiprecision::bit_test(loop_count, i);
+                            if (!found_one) {
+                                /* this skips the MSB itself */
+                                found_one |= bit;
+                                continue;
+                            }
+
+                            f = f.squared();
+
+                            for (std::size_t j = 0; j < n; ++j) {
+                                steps_type::doubling_step_for_flipped_miller_loop(R[j], cc);
+                                f = line_functions::mul_by_ate_line(f, prec_P[j], cc);
+                            }
+
+                            if (bit) {
+                                for (std::size_t j = 0; j < n; ++j) {
+                                    steps_type::mixed_addition_step_for_flipped_miller_loop(Q_ext[j], R[j], cc);
+                                    f = line_functions::mul_by_flipped_ate_line(f, prec_P[j], cc);
+                                }
+                            }
+                        }
+
+                        return f;
+                    }
+                };
+            }    // namespace pairing
+        }        // namespace algebra
+    }            // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_ALGEBRA_PAIRING_EDWARDS_183_ATE_MULTI_MILLER_LOOP_HPP
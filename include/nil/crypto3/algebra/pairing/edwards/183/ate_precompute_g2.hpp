@@ -41,6 +41,9 @@ namespace nil {
                 template<std::size_t Version = 183>
                 class edwards_ate_precompute_g2;
 
+                template<std::size_t Version>
+                class edwards_ate_multi_miller_loop;
+
                 template<>
                 class edwards_ate_precompute_g2<183> {
                     using curve_type = curves::edwards<183>;
@@ -54,6 +57,8 @@ namespace nil {
 
                     using g2_field_type_value = typename g2_type::field_type::value_type;
 
+                    friend class edwards_ate_multi_miller_loop<183>;
+
                     struct extended_g2_projective {
                         g2_field_type_value X;
                         g2_field_type_value Y;
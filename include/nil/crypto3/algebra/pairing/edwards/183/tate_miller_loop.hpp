@@ -32,6 +32,7 @@
 #include <nil/crypto3/algebra/curves/edwards.hpp>
 #include <nil/crypto3/algebra/pairing/detail/edwards/183/params.hpp>
 #include <nil/crypto3/algebra/pairing/detail/edwards/183/types.hpp>
+#include <nil/crypto3/algebra/pairing/detail/edwards/183/conic_line.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -48,18 +49,20 @@ namespace nil {
                     using params_type = detail::pairing_params<curve_type>;
                     typedef detail::types_policy<curve_type> policy_type;
                     using gt_type = typename curve_type::gt_type;
+                    using scalar_field_type = typename curve_type::scalar_field_type;
+
+                    typedef detail::conic_line_functions<curve_type> line_functions;
 
                 public:
-                    static typename gt_type::value_type process(const policy_type::tate_g1_precomp &prec_P,
-                                                                const policy_type::tate_g2_precomp &prec_Q) {
+                    static typename gt_type::value_type process(const typename policy_type::tate_g1_precomp &prec_P,
+                                                                const typename policy_type::tate_g2_precomp &prec_Q) {
 
                         typename gt_type::value_type f = gt_type::value_type::one();
 
                         bool found_one = false;
                         std::size_t idx = 0;
-                        for (long i = policy_type::scalar_field_bits - 1; i >= 0; --i) {
-                            const bool bit =
-                                nil::crypto3::multiprecision::bit_test(policy_type::scalar_field_modulus, i);
+                        for (long i = scalar_field_type::modulus_bits - 1; i >= 0; --i) {
+                            const bool bit = nil::crypto3::multiprecision::bit_test(scalar_field_type::modulus, i);
                             if (!found_one) {
                                 /* this skips the MSB itself */
                                 found_one |= bit;
@@ -67,18 +70,11 @@ namespace nil {
                             }
 
                             /* code below gets executed for all bits (EXCEPT the MSB itself) of
-                               policy_type::scalar_field_modulus (skipping leading zeros) in MSB to LSB
+                               the scalar field modulus (skipping leading zeros) in MSB to LSB
                                order */
-                            typename policy_type::Fq_conic_coefficients cc = prec_P[idx++];
-                            typename gt_type::value_type g_RR_at_Q = typename gt_type::value_type(
-                                Fq3(cc.c_XZ, Fq(0l), Fq(0l)) + cc.c_XY * prec_Q.y0, cc.c_ZZ * prec_Q.eta);
-                            f = f.squared() * g_RR_at_Q;
+                            f = line_functions::mul_by_tate_line(f.squared(), prec_P[idx++], prec_Q);
                             if (bit) {
-                                cc = prec_P[idx++];
-
-                                typename gt_type::value_type g_RP_at_Q = typename gt_type::value_type(
-                                    Fq3(cc.c_XZ, Fq(0l), Fq(0l)) + cc.c_XY * prec_Q.y0, cc.c_ZZ * prec_Q.eta);
-                                f = f * g_RP_at_Q;
+                                f = line_functions::mul_by_tate_line(f, prec_P[idx++], prec_Q);
                             }
                         }
 
@@ -30,7 +30,7 @@
 #include <nil/crypto3/multiprecision/cpp_int.hpp>
 
 #include <nil/crypto3/algebra/curves/edwards.hpp>
-#include <nil/crypto3/algebra/pairing/detail/bls12/381/params.hpp>
+#include <nil/crypto3/algebra/pairing/detail/edwards/183/params.hpp>
 #include <nil/crypto3/algebra/pairing/detail/edwards/183/types.hpp>
 
 namespace nil {
@@ -39,16 +39,17 @@ namespace nil {
             namespace pairing {
 
                 template<std::size_t Version = 183>
-                class edwards_ate_precompute_g1;
+                class edwards_tate_precompute_g1;
 
                 template<>
-                class edwards_ate_precompute_g1<183> {
+                class edwards_tate_precompute_g1<183> {
                     using curve_type = curves::edwards<183>;
 
                     using params_type = detail::pairing_params<curve_type>;
                     typedef detail::types_policy<curve_type> policy_type;
 
                     using base_field_type = typename curve_type::base_field_type;
+                    using scalar_field_type = typename curve_type::scalar_field_type;
                     using g1_type = typename curve_type::template g1_type<>;
                     using g1_affine_type = typename curve_type::template g1_type<curves::coordinates::affine>;
 
@@ -154,15 +155,14 @@ namespace nil {
                         extended_g1_projective P_ext;
                         P_ext.X = Pcopy.X;
                         P_ext.Y = Pcopy.Y;
-                        P_ext.Z = Pcopy.Z;
+                        P_ext.Z = g1_field_type_value::one();
                         P_ext.T = Pcopy.X * Pcopy.Y;
 
                         extended_g1_projective R = P_ext;
 
                         bool found_one = false;
-                        for (long i = params_type::scalar_field_bits; i >= 0; --i) {
-                            const bool bit =
-                                nil::crypto3::multiprecision::bit_test(params_type::scalar_field_modulus, i);
+                        for (long i = scalar_field_type::modulus_bits - 1; i >= 0; --i) {
+                            const bool bit = nil::crypto3::multiprecision::bit_test(scalar_field_type::modulus, i);
                             if (!found_one) {
                                 /* this skips the MSB itself */
                                 found_one |= bit;
@@ -170,9 +170,9 @@ namespace nil {
                             }
 
                             /* code below gets executed for all bits (EXCEPT the MSB itself) of
-                               params_type::scalar_field_modulus (skipping leading zeros) in MSB to LSB
+                               the scalar field modulus (skipping leading zeros) in MSB to LSB
                                order */
-                            policy_type::Fq_conic_coefficients cc;
+                            typename policy_type::Fq_conic_coefficients cc;
 
                             doubling_step_for_miller_loop(R, cc);
                             result.push_back(cc);
@@ -35,26 +35,27 @@ namespace nil {
             namespace pairing {
 
                 template<std::size_t Version = 183>
-                class edwards_ate_precompute_g1;
+                class edwards_tate_precompute_g2;
 
                 template<>
-                class edwards_ate_precompute_g1<183> {
+                class edwards_tate_precompute_g2<183> {
                     using curve_type = curves::edwards<183>;
 
                     typedef detail::types_policy<curve_type> policy_type;
 
                     using g2_type = typename curve_type::template g2_type<>;
                     using g2_affine_type = typename curve_type::template g2_type<curves::coordinates::affine>;
+                    using gt_type = typename curve_type::gt_type;
 
                 public:
                     using g2_precomputed_type = typename policy_type::tate_g2_precomp;
 
-                    static typename policy_type::tate_g2_precomp process(const typename g2_type::value_type &P) {
+                    static typename policy_type::tate_g2_precomp process(const typename g2_type::value_type &Q) {
 
                         typename g2_affine_type::value_type Qcopy = Q.to_affine();
                         typename policy_type::tate_g2_precomp result;
                         result.y0 = Qcopy.Y * Qcopy.Z.inversed();
-                        result.eta = (Qcopy.Z + Qcopy.Y) * gt::mul_by_non_residue(Qcopy.X).inversed();
+                        result.eta = (Qcopy.Z + Qcopy.Y) * gt_type::value_type::mul_by_non_residue(Qcopy.X).inversed();
 
                         return result;
                     }
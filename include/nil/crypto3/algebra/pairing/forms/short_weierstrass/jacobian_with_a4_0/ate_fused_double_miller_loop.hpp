@@ -0,0 +1,116 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_PAIRING_SHORT_WEIERSTRASS_JACOBIAN_WITH_A4_0_ATE_FUSED_DOUBLE_MILLER_LOOP_HPP
+#define CRYPTO3_ALGEBRA_PAIRING_SHORT_WEIERSTRASS_JACOBIAN_WITH_A4_0_ATE_FUSED_DOUBLE_MILLER_LOOP_HPP
+
+#include <nil/crypto3/multiprecision/number.hpp>
+#include <nil/crypto3/multiprecision/cpp_int.hpp>
+
+#include <nil/crypto3/algebra/pairing/detail/forms/short_weierstrass/jacobian_with_a4_0/types.hpp>
+#include <nil/crypto3/algebra/pairing/forms/short_weierstrass/jacobian_with_a4_0/ate_precompute_g2.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace pairing {
+
+                template<typename CurveType>
+                class short_weierstrass_jacobian_with_a4_0_ate_fused_double_miller_loop {
+                    using curve_type = CurveType;
+
+                    using params_type = detail::pairing_params<curve_type>;
+                    typedef detail::short_weierstrass_jacobian_with_a4_0_types_policy<curve_type> policy_type;
+
+                    using base_field_type = typename curve_type::base_field_type;
+                    using g2_type = typename curve_type::template g2_type<>;
+                    using g2_affine_type = typename curve_type::template g2_type<curves::coordinates::affine>;
+                    using gt_type = typename curve_type::gt_type;
+
+                    using steps_type = short_weierstrass_jacobian_with_a4_0_ate_precompute_g2<curve_type>;
+
+                public:
+                    static typename gt_type::value_type
+                        process(const typename policy_type::ate_g1_precomputed_type &prec_P1,
+                                const typename g2_affine_type::value_type &Q1,
+                                const typename policy_type::ate_g1_precomputed_type &prec_P2,
+                                const typename g2_affine_type::value_type &Q2) {
+
+                        const typename base_field_type::value_type two_inv =
+                            typename base_field_type::value_type(0x02).inversed();
+
+                        typename g2_type::value_type R1, R2;
+                        R1.X = Q1.X;
+                        R1.Y = Q1.Y;
+                        R1.Z = g2_type::field_type::value_type::one();
+                        R2.X = Q2.X;
+                        R2.Y = Q2.Y;
+                        R2.Z = g2_type::field_type::value_type::one();
+
+                        typename gt_type::value_type f = gt_type::value_type::one();
+
+                        bool found_one = false;
+
+                        const typename policy_type::integral_type &loop_count = params_type::ate_loop_count;
+
+                        typename policy_type::ate_ell_coeffs c1, c2;
+
+                        for (long i = params_type::integral_type_max_bits; i >= 0; --i) {
+                            const bool bit = multiprecision::bit_test(loop_count, i);
+                            if (!found_one) {
+                                /* this skips the MSB itself */
+                                found_one |= bit;
+                                continue;
+                            }
+
+                            steps_type::doubling_step_for_miller_loop(two_inv, R1, c1);
+                            steps_type::doubling_step_for_miller_loop(two_inv, R2, c2);
+
+                            f = f.squared();
+
+                            f = f.mul_by_045(c1.ell_0, prec_P1.PY * c1.ell_VW, prec_P1.PX * c1.ell_VV);
+                            f = f.mul_by_045(c2.ell_0, prec_P2.PY * c2.ell_VW, prec_P2.PX * c2.ell_VV);
+
+                            if (bit) {
+                                steps_type::mixed_addition_step_for_miller_loop(Q1, R1, c1);
+                                steps_type::mixed_addition_step_for_miller_loop(Q2, R2, c2);
+
+                                f = f.mul_by_045(c1.ell_0, prec_P1.PY * c1.ell_VW, prec_P1.PX * c1.ell_VV);
+                                f = f.mul_by_045(c2.ell_0, prec_P2.PY * c2.ell_VW, prec_P2.PX * c2.ell_VV);
+                            }
+                        }
+
+                        if (params_type::ate_is_loop_count_neg) {
+                            f = f.inversed();
+                        }
+
+                        return f;
+                    }
+                };
+            }    // namespace pairing
+        }        // namespace algebra
+    }            // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_ALGEBRA_PAIRING_SHORT_WEIERSTRASS_JACOBIAN_WITH_A4_0_ATE_FUSED_DOUBLE_MILLER_LOOP_HPP
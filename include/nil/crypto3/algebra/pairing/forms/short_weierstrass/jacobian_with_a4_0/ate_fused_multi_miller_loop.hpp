@@ -0,0 +1,125 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_PAIRING_SHORT_WEIERSTRASS_JACOBIAN_WITH_A4_0_ATE_FUSED_MULTI_MILLER_LOOP_HPP
+#define CRYPTO3_ALGEBRA_PAIRING_SHORT_WEIERSTRASS_JACOBIAN_WITH_A4_0_ATE_FUSED_MULTI_MILLER_LOOP_HPP
+
+#include <vector>
+
+#include <boost/assert.hpp>
+
+#include <nil/crypto3/multiprecision/number.hpp>
+#include <nil/crypto3/multiprecision/cpp_int.hpp>
+
+#include <nil/crypto3/algebra/pairing/detail/forms/short_weierstrass/jacobian_with_a4_0/types.hpp>
+#include <nil/crypto3/algebra/pairing/forms/short_weierstrass/jacobian_with_a4_0/ate_precompute_g2.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace pairing {
+
+                /*!
+                 * @brief Ate Miller loop computing the product of N Miller loops f_{P_1,Q_1} * ... * f_{P_N,Q_N}
+                 * in a single pass. The accumulator is squared once per bit of the loop count for all pairs, and
+                 * the line functions of every pair are evaluated on the fly as in the fused Miller loop. Feeding
+                 * the result to a single final exponentiation gives the product of N reduced pairings.
+                 * @tparam CurveType
+                 */
+                template<typename CurveType>
+                class short_weierstrass_jacobian_with_a4_0_ate_fused_multi_miller_loop {
+                    using curve_type = CurveType;
+
+                    using params_type = detail::pairing_params<curve_type>;
+                    typedef detail::short_weierstrass_jacobian_with_a4_0_types_policy<curve_type> policy_type;
+
+                    using base_field_type = typename curve_type::base_field_type;
+                    using g2_type = typename curve_type::template g2_type<>;
+                    using g2_affine_type = typename curve_type::template g2_type<curves::coordinates::affine>;
+                    using gt_type = typename curve_type::gt_type;
+
+                    using steps_type = short_weierstrass_jacobian_with_a4_0_ate_precompute_g2<curve_type>;
+
+                public:
+                    static typename gt_type::value_type
+                        process(const std::vector<typename policy_type::ate_g1_precomputed_type> &prec_P,
+                                const std::vector<typename g2_affine_type::value_type> &Q) {
+
+                        BOOST_ASSERT(prec_P.size() == Q.size());
+
+                        const std::size_t n = Q.size();
+                        const typename base_field_type::value_type two_inv =
+                            typename base_field_type::value_type(0x02).inversed();
+
+                        std::vector<typename g2_type::value_type> R(n);
+                        for (std::size_t j = 0; j < n; ++j) {
+                            R[j].X = Q[j].X;
+                            R[j].Y = Q[j].Y;
+                            R[j].Z = g2_type::field_type::value_type::one();
+                        }
+
+                        typename gt_type::value_type f = gt_type::value_type::one();
+
+                        bool found_one = false;
+
+                        const typename policy_type::integral_type &loop_count = params_type::ate_loop_count;
+
+                        typename policy_type::ate_ell_coeffs c;
+
+                        for (long i = params_type::integral_type_max_bits; i >= 0; --i) {
+                            const bool bit = multiprecision::bit_test(loop_count, i);
+                            if (!found_one) {
+                                /* this skips the MSB itself */
+                                found_one |= bit;
+                                continue;
+                            }
+
+                            f = f.squared();
+
+                            for (std::size_t j = 0; j < n; ++j) {
+                                steps_type::doubling_step_for_miller_loop(two_inv, R[j], c);
+                                f = f.mul_by_045(c.ell_0, prec_P[j].PY * c.ell_VW, prec_P[j].PX * c.ell_VV);
+                            }
+
+                            if (bit) {
+                                for (std::size_t j = 0; j < n; ++j) {
+                                    steps_type::mixed_addition_step_for_miller_loop(Q[j], R[j], c);
+                                    f = f.mul_by_045(c.ell_0, prec_P[j].PY * c.ell_VW, prec_P[j].PX * c.ell_VV);
+                                }
+                            }
+                        }
+
+                        if (params_type::ate_is_loop_count_neg) {
+                            f = f.inversed();
+                        }
+
+                        return f;
+                    }
+                };
+            }    // namespace pairing
+        }        // namespace algebra
+    }            // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_ALGEBRA_PAIRING_SHORT_WEIERSTRASS_JACOBIAN_WITH_A4_0_ATE_FUSED_MULTI_MILLER_LOOP_HPP
@@ -49,6 +49,13 @@ namespace nil {
 
                     using g2_field_type_value = typename g2_type::field_type::value_type;
 
+                    template<typename>
+                    friend class short_weierstrass_jacobian_with_a4_0_ate_fused_miller_loop;
+                    template<typename>
+                    friend class short_weierstrass_jacobian_with_a4_0_ate_fused_double_miller_loop;
+                    template<typename>
+                    friend class short_weierstrass_jacobian_with_a4_0_ate_fused_multi_miller_loop;
+
                     static void doubling_step_for_miller_loop(const typename base_field_type::value_type &two_inv,
                                                               typename g2_type::value_type &current,
                                                               typename policy_type::ate_ell_coeffs &c) {
@@ -58,22 +65,22 @@ namespace nil {
                         const g2_field_type_value A = two_inv * (X * Y);                 // A = X1 * Y1 / 2
                         const g2_field_type_value B = Y.squared();                       // B = Y1^2
                         const g2_field_type_value C = Z.squared();                       // C = Z1^2
-                        const g2_field_type_value D = 0x03 * C;                          // D = 3 * C
+                        const g2_field_type_value D = fields::mul_small<3>(C);           // D = 3 * C
                         const g2_field_type_value E = params_type::twist_coeff_b * D;    // E = twist_b * D
 
-                        const g2_field_type_value F = 0x03 * E;                       // F = 3 * E
+                        const g2_field_type_value F = fields::mul_small<3>(E);        // F = 3 * E
                         const g2_field_type_value G = two_inv * (B + F);              // G = (B+F)/2
                         const g2_field_type_value H = (Y + Z).squared() - (B + C);    // H = (Y1+Z1)^2-(B+C)
                         const g2_field_type_value I = E - B;                          // I = E-B
                         const g2_field_type_value J = X.squared();                    // J = X1^2
                         const g2_field_type_value E_squared = E.squared();            // E_squared = E^2
 
-                        current.X = A * (B - F);                         // X3 = A * (B-F)
-                        current.Y = G.squared() - (0x03 * E_squared);    // Y3 = G^2 - 3*E^2
-                        current.Z = B * H;                               // Z3 = B * H
-                        c.ell_0 = I;                                     // ell_0 = xi * I
-                        c.ell_VW = -params_type::twist * H;              // ell_VW = - H (later: * yP)
-                        c.ell_VV = 0x03 * J;                             // ell_VV = 3*J (later: * xP)
+                        current.X = A * (B - F);                                      // X3 = A * (B-F)
+                        current.Y = G.squared() - fields::mul_small<3>(E_squared);    // Y3 = G^2 - 3*E^2
+                        current.Z = B * H;                                            // Z3 = B * H
+                        c.ell_0 = I;                                                  // ell_0 = xi * I
+                        c.ell_VW = -params_type::twist * H;                           // ell_VW = - H (later: * yP)
+                        c.ell_VV = fields::mul_small<3>(J);                           // ell_VV = 3*J (later: * xP)
                     }
 
                     static void mixed_addition_step_for_miller_loop(const typename g2_affine_type::value_type base,
@@ -0,0 +1,133 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_PAIRING_SHORT_WEIERSTRASS_PROJECTIVE_ATE_FUSED_MILLER_LOOP_HPP
+#define CRYPTO3_ALGEBRA_PAIRING_SHORT_WEIERSTRASS_PROJECTIVE_ATE_FUSED_MILLER_LOOP_HPP
+
+#include <nil/crypto3/multiprecision/number.hpp>
+#include <nil/crypto3/multiprecision/cpp_int.hpp>
+
+#include <nil/crypto3/algebra/pairing/detail/forms/short_weierstrass/projective/types.hpp>
+#include <nil/crypto3/algebra/pairing/forms/short_weierstrass/projective/ate_precompute_g2.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace pairing {
+
+                /*!
+                 * @brief Flipped ate Miller loop which evaluates doubling/addition steps and their line
+                 * functions inline instead of walking the precomputed dbl/add coefficients vectors.
+                 * Intended for one-shot pairings with fresh G2 points: no heap allocation.
+                 * @tparam CurveType
+                 */
+                template<typename CurveType>
+                class short_weierstrass_projective_ate_fused_miller_loop {
+                    using curve_type = CurveType;
+
+                    using params_type = detail::pairing_params<curve_type>;
+                    typedef detail::short_weierstrass_projective_types_policy<curve_type> policy_type;
+
+                    using g2_type = typename curve_type::template g2_type<>;
+                    using g2_affine_type = typename curve_type::template g2_type<curves::coordinates::affine>;
+                    using gt_type = typename curve_type::gt_type;
+
+                    using g2_field_type_value = typename g2_type::field_type::value_type;
+
+                    using steps_type = short_weierstrass_projective_ate_precompute_g2<curve_type>;
+                    using extended_g2_projective = typename steps_type::extended_g2_projective;
+
+                public:
+                    static typename gt_type::value_type
+                        process(const typename policy_type::ate_g1_precomputed_type &prec_P,
+                                const typename g2_affine_type::value_type &Q) {
+
+                        const g2_field_type_value twist_inv = params_type::twist.inversed();
+                        const g2_field_type_value QY2 = Q.Y.squared();
+                        const g2_field_type_value QX_over_twist = Q.X * twist_inv;
+                        const g2_field_type_value QY_over_twist = Q.Y * twist_inv;
+
+                        const g2_field_type_value L1_coeff = prec_P.PX * g2_field_type_value::one() - QX_over_twist;
+
+                        extended_g2_projective R;
+                        R.X = Q.X;
+                        R.Y = Q.Y;
+                        R.Z = g2_field_type_value::one();
+                        R.T = g2_field_type_value::one();
+
+                        typename gt_type::value_type f = gt_type::value_type::one();
+
+                        bool found_one = false;
+
+                        typename policy_type::ate_dbl_coeffs dc;
+                        typename policy_type::ate_add_coeffs ac;
+
+                        for (long i = params_type::integral_type_max_bits - 1; i >= 0; --i) {
+                            const bool bit = multiprecision::bit_test(params_type::ate_loop_count, i);
+                            if (!found_one) {
+                                /* this skips the MSB itself */
+                                found_one |= bit;
+                                continue;
+                            }
+
+                            steps_type::doubling_step_for_flipped_miller_loop(R, dc);
+
+                            const typename gt_type::value_type g_RR_at_P = typename gt_type::value_type(
+                                -dc.c_4C - dc.c_J * prec_P.PX_twist + dc.c_L, dc.c_H * prec_P.PY_twist);
+                            f = f.squared() * g_RR_at_P;
+
+                            if (bit) {
+                                steps_type::mixed_addition_step_for_flipped_miller_loop(Q.X, Q.Y, QY2, R, ac);
+
+                                const typename gt_type::value_type g_RQ_at_P = typename gt_type::value_type(
+                                    ac.c_RZ * prec_P.PY_twist, -(QY_over_twist * ac.c_RZ + L1_coeff * ac.c_L1));
+                                f = f * g_RQ_at_P;
+                            }
+                        }
+
+                        if (params_type::ate_is_loop_count_neg) {
+                            const g2_field_type_value RZ_inv = R.Z.inversed();
+                            const g2_field_type_value RZ2_inv = RZ_inv.squared();
+                            const g2_field_type_value RZ3_inv = RZ2_inv * RZ_inv;
+                            const g2_field_type_value minus_R_affine_X = R.X * RZ2_inv;
+                            const g2_field_type_value minus_R_affine_Y = -R.Y * RZ3_inv;
+                            const g2_field_type_value minus_R_affine_Y2 = minus_R_affine_Y.squared();
+
+                            steps_type::mixed_addition_step_for_flipped_miller_loop(
+                                minus_R_affine_X, minus_R_affine_Y, minus_R_affine_Y2, R, ac);
+
+                            const typename gt_type::value_type g_RnegR_at_P = typename gt_type::value_type(
+                                ac.c_RZ * prec_P.PY_twist, -(QY_over_twist * ac.c_RZ + L1_coeff * ac.c_L1));
+                            f = (f * g_RnegR_at_P).inversed();
+                        }
+
+                        return f;
+                    }
+                };
+            }    // namespace pairing
+        }        // namespace algebra
+    }            // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_ALGEBRA_PAIRING_SHORT_WEIERSTRASS_PROJECTIVE_ATE_FUSED_MILLER_LOOP_HPP
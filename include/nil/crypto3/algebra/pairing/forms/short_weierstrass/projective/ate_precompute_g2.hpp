@@ -49,6 +49,11 @@ namespace nil {
 
                     using g2_field_type_value = typename g2_type::field_type::value_type;
 
+                    template<typename>
+                    friend class short_weierstrass_projective_ate_fused_miller_loop;
+                    template<typename>
+                    friend class short_weierstrass_projective_ate_fused_double_miller_loop;
+
                     struct extended_g2_projective {
                         g2_field_type_value X;
                         g2_field_type_value Y;
@@ -70,14 +75,13 @@ namespace nil {
                             (B + B + B) + params_type::twist_coeff_a * A;    // F = 3*B +  a  *A
                         const g2_field_type_value G = F.squared();           // G = F^2
 
-                        current.X = -E.doubled().doubled() + G;    // X3 = -4*E+G
-                        current.Y = -typename base_field_type::value_type(0x08) * D +
-                                    F * (E + E - current.X);                // Y3 = -8*D+F*(2*E-X3)
-                        current.Z = (Y + Z).squared() - C - Z.squared();    // Z3 = (Y1+Z1)^2-C-Z1^2
-                        current.T = current.Z.squared();                    // T3 = Z3^2
+                        current.X = -E.doubled().doubled() + G;                           // X3 = -4*E+G
+                        current.Y = F * (E + E - current.X) - fields::mul_small<8>(D);    // Y3 = -8*D+F*(2*E-X3)
+                        current.Z = (Y + Z).squared() - C - Z.squared();                  // Z3 = (Y1+Z1)^2-C-Z1^2
+                        current.T = current.Z.squared();                                  // T3 = Z3^2
 
                         dc.c_H = (current.Z + T).squared() - current.T - A;    // H = (Z3+T1)^2-T3-A
-                        dc.c_4C = C + C + C + C;                               // fourC = 4*C
+                        dc.c_4C = fields::mul_small<4>(C);                     // fourC = 4*C
                         dc.c_J = (F + T).squared() - G - A;                    // J = (F+T1)^2-G-A
                         dc.c_L = (F + X).squared() - G - B;                    // L = (F+X1)^2-G-B
                     }
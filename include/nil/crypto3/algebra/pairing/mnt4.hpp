@@ -34,6 +34,9 @@
 #include <nil/crypto3/algebra/pairing/forms/short_weierstrass/projective/ate_precompute_g1.hpp>
 #include <nil/crypto3/algebra/pairing/forms/short_weierstrass/projective/ate_precompute_g2.hpp>
 #include <nil/crypto3/algebra/pairing/mnt4/298/final_exponentiation.hpp>
+#include <nil/crypto3/algebra/pairing/forms/short_weierstrass/projective/ate_fused_double_miller_loop.hpp>
+#include <nil/crypto3/algebra/pairing/forms/short_weierstrass/projective/ate_fused_miller_loop.hpp>
+#include <nil/crypto3/algebra/pairing/forms/short_weierstrass/ate_fused_precompute_g2.hpp>
 #include <nil/crypto3/algebra/pairing/pairing_policy.hpp>
 
 namespace nil {
@@ -57,6 +60,18 @@ namespace nil {
                     using g2_precomputed_type = typename precompute_g2::g2_precomputed_type;
                 };
 
+                template<>
+                struct fused_pairing_policy<curves::mnt4<298>> : public pairing_policy<curves::mnt4<298>> {
+                    using curve_type = curves::mnt4<298>;
+
+                    using precompute_g2 = pairing::short_weierstrass_ate_fused_precompute_g2<curve_type>;
+                    using miller_loop = pairing::short_weierstrass_projective_ate_fused_miller_loop<curve_type>;
+                    using double_miller_loop =
+                        pairing::short_weierstrass_projective_ate_fused_double_miller_loop<curve_type>;
+
+                    using g2_precomputed_type = typename precompute_g2::g2_precomputed_type;
+                };
+
             }    // namespace pairing
         }        // namespace algebra
     }            // namespace crypto3
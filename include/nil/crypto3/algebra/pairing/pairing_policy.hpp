@@ -33,6 +33,15 @@ namespace nil {
 
                 template<typename PairingCurveType>
                 struct pairing_policy;
+
+                /*!
+                 * @brief Alternative to pairing_policy which uses a fused Miller loop: G2 line functions are
+                 * evaluated on the fly instead of being materialized as a coefficients vector first. Select it
+                 * as the PairingPolicy argument of pair/pair_reduced for one-shot pairings with fresh G2 points.
+                 * @tparam PairingCurveType
+                 */
+                template<typename PairingCurveType>
+                struct fused_pairing_policy;
             }    // namespace pairing
         }        // namespace algebra
     }            // namespace crypto3
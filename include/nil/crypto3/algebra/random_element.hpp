@@ -26,7 +26,14 @@
 #ifndef CRYPTO3_ALGEBRA_RANDOM_ELEMENT_HPP
 #define CRYPTO3_ALGEBRA_RANDOM_ELEMENT_HPP
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
 #include <nil/crypto3/algebra/type_traits.hpp>
+#include <nil/crypto3/algebra/fixed_base_mul.hpp>
+#include <nil/crypto3/algebra/random_engine.hpp>
 
 #include <nil/crypto3/multiprecision/debug_adaptor.hpp>
 #include <nil/crypto3/multiprecision/cpp_bin_float.hpp>
@@ -49,49 +56,88 @@
 namespace nil {
     namespace crypto3 {
         namespace algebra {
+            namespace detail {
+                /// Rejection sampling of a uniform element of a prime field straight from 32-bit words of rng. Each
+                /// word is the low 32 bits of one draw, so rng has to draw uniformly from [0, 2^k) with k >= 32
+                template<typename FieldType, typename RNG>
+                typename std::enable_if<!is_extended_field<FieldType>::value, typename FieldType::value_type>::type
+                    sample_field_element(RNG &rng) {
+                    typedef typename FieldType::integral_type integral_type;
+                    typedef typename std::decay<RNG>::type engine_type;
+
+                    static_assert(engine_type::min() == 0 && engine_type::max() >= 0xFFFFFFFFu &&
+                                      (engine_type::max() & (engine_type::max() + 1u)) == 0,
+                                  "rng has to produce uniform words of at least 32 bits");
+
+                    constexpr const std::size_t words = (FieldType::modulus_bits + 31) / 32;
+                    constexpr const std::size_t top_bits = FieldType::modulus_bits % 32;
+                    const integral_type modulus = FieldType::modulus;
+
+                    std::array<std::uint32_t, words> limbs;
+                    integral_type value;
+                    do {
+                        for (std::uint32_t &limb : limbs) {
+                            limb = std::uint32_t(rng());
+                        }
+                        if (top_bits != 0) {
+                            limbs.back() &= (std::uint32_t(1) << top_bits) - 1;
+                        }
+                        multiprecision::import_bits(value, limbs.rbegin(), limbs.rend(), 32);
+                    } while (value >= modulus);
+
+                    return typename FieldType::value_type(value);
+                }
+
+                template<typename FieldType, typename RNG>
+                typename std::enable_if<is_extended_field<FieldType>::value, typename FieldType::value_type>::type
+                    sample_field_element(RNG &rng) {
+                    typename FieldType::value_type::data_type data;
+                    for (auto &coordinate : data) {
+                        coordinate = sample_field_element<typename FieldType::underlying_field_type>(rng);
+                    }
+                    return typename FieldType::value_type(data);
+                }
+            }    // namespace detail
 
             template<
                 typename FieldType,
                 typename DistributionType = boost::random::uniform_int_distribution<typename FieldType::integral_type>,
-                typename GeneratorType = boost::random::mt19937,
-                typename RNG = boost::random_device>
+                typename RNG = chacha20_engine &>
             typename std::enable_if<is_field<FieldType>::value && !(is_extended_field<FieldType>::value),
                                     typename FieldType::value_type>::type
-                random_element(RNG &&rng = boost::random_device()) {
+                random_element(RNG &&rng = thread_local_random_engine()) {
 
                 using field_type = FieldType;
                 using distribution_type = DistributionType;
-                using generator_type = GeneratorType;
-
-                distribution_type d(0, field_type::modulus);
 
-                // boost::random_device rd;
-                // rd.seed(time(0));
+                if constexpr (std::is_same<distribution_type, boost::random::uniform_int_distribution<
+                                                                  typename FieldType::integral_type>>::value) {
+                    return detail::sample_field_element<field_type>(rng);
+                } else {
+                    distribution_type d(0, field_type::modulus - 1);
 
-                typename field_type::value_type value(d(rng));
+                    typename field_type::value_type value(d(rng));
 
-                return value;
+                    return value;
+                }
             }
 
             template<
                 typename FieldType,
                 typename DistributionType = boost::random::uniform_int_distribution<typename FieldType::integral_type>,
-                typename GeneratorType = boost::random::mt19937,
-                typename RNG = boost::random_device>
+                typename RNG = chacha20_engine &>
             typename std::enable_if<is_field<FieldType>::value && is_extended_field<FieldType>::value,
                                     typename FieldType::value_type>::type
-                random_element(RNG &&rng = boost::random_device()) {
+                random_element(RNG &&rng = thread_local_random_engine()) {
 
                 using field_type = FieldType;
                 using distribution_type = DistributionType;
-                using generator_type = GeneratorType;
 
                 typename field_type::value_type::data_type data;
                 const std::size_t data_dimension = field_type::arity / field_type::underlying_field_type::arity;
 
                 for (int n = 0; n < data_dimension; ++n) {
-                    data[n] =
-                        random_element<typename FieldType::underlying_field_type, distribution_type, generator_type>(rng);
+                    data[n] = random_element<typename FieldType::underlying_field_type, distribution_type>(rng);
                 }
 
                 return typename field_type::value_type(data);
@@ -100,18 +146,51 @@ namespace nil {
             template<typename CurveGroupType,
                      typename DistributionType =
                          boost::random::uniform_int_distribution<typename CurveGroupType::field_type::integral_type>,
-                     typename GeneratorType = boost::random::mt19937,
-                     typename RNG = boost::random_device>
+                     typename RNG = chacha20_engine &>
             typename std::enable_if<is_curve_group<CurveGroupType>::value, typename CurveGroupType::value_type>::type
-                random_element(RNG &&rng = boost::random_device()) {
+                random_element(RNG &&rng = thread_local_random_engine()) {
 
                 using curve_type = typename CurveGroupType::curve_type;
                 using field_type = typename curve_type::scalar_field_type;
                 using distribution_type = boost::random::uniform_int_distribution<typename field_type::integral_type>;
-                using generator_type = GeneratorType;
 
-                return random_element<typename curve_type::scalar_field_type, distribution_type, generator_type>(rng) *
-                       CurveGroupType::value_type::one();
+                return fixed_base_mul<CurveGroupType>(
+                    random_element<typename curve_type::scalar_field_type, distribution_type>(rng));
+            }
+
+
+            /*!
+             * @brief n uniform field elements, each drawn by rejection sampling into the limbs of integral_type.
+             * rng must produce uniform 32-bit words; by default it is the ChaCha20 stream of the calling thread.
+             */
+            template<typename FieldType, typename RNG = chacha20_engine &>
+            typename std::enable_if<is_field<FieldType>::value, std::vector<typename FieldType::value_type>>::type
+                random_elements(std::size_t n, RNG &&rng = thread_local_random_engine()) {
+
+                std::vector<typename FieldType::value_type> result;
+                result.reserve(n);
+                for (std::size_t i = 0; i < n; ++i) {
+                    result.push_back(detail::sample_field_element<FieldType>(rng));
+                }
+                return result;
+            }
+
+            /// n uniform group elements, random scalars multiplied through the shared fixed-base generator table
+            template<typename CurveGroupType, typename RNG = chacha20_engine &>
+            typename std::enable_if<is_curve_group<CurveGroupType>::value,
+                                    std::vector<typename CurveGroupType::value_type>>::type
+                random_elements(std::size_t n, RNG &&rng = thread_local_random_engine()) {
+
+                typedef typename CurveGroupType::curve_type::scalar_field_type scalar_field_type;
+
+                const fixed_base_table<CurveGroupType> &table = fixed_base_table<CurveGroupType>::generator();
+
+                std::vector<typename CurveGroupType::value_type> result;
+                result.reserve(n);
+                for (std::size_t i = 0; i < n; ++i) {
+                    result.push_back(table.mul(detail::sample_field_element<scalar_field_type>(rng)));
+                }
+                return result;
             }
 
         }    // namespace algebra
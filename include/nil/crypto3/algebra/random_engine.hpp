@@ -0,0 +1,163 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_RANDOM_ENGINE_HPP
+#define CRYPTO3_ALGEBRA_RANDOM_ENGINE_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+#include <boost/random/random_device.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+
+            /*!
+             * @brief ChaCha20 keystream exposed as a UniformRandomBitGenerator of 32-bit words.
+             *
+             * The state follows the original layout with a 64-bit block counter in words 12-13 and a 64-bit nonce
+             * in words 14-15. One block yields 16 output words, so the cost per word is a small fraction of a
+             * random_device read. A default constructed engine takes its 256-bit key from boost::random_device.
+             */
+            class chacha20_engine {
+            public:
+                typedef std::uint32_t result_type;
+                typedef std::array<std::uint32_t, 8> key_type;
+
+                constexpr static const std::size_t block_words = 16;
+
+                chacha20_engine() {
+                    boost::random_device rd;
+                    key_type key;
+                    for (std::uint32_t &word : key) {
+                        word = rd();
+                    }
+                    seed(key);
+                }
+
+                explicit chacha20_engine(const key_type &key, std::uint64_t counter = 0, std::uint64_t nonce = 0) {
+                    seed(key, counter, nonce);
+                }
+
+                void seed(const key_type &key, std::uint64_t counter = 0, std::uint64_t nonce = 0) {
+                    m_state[0] = 0x61707865;
+                    m_state[1] = 0x3320646e;
+                    m_state[2] = 0x79622d32;
+                    m_state[3] = 0x6b206574;
+                    for (std::size_t i = 0; i < key.size(); ++i) {
+                        m_state[4 + i] = key[i];
+                    }
+                    m_state[12] = std::uint32_t(counter);
+                    m_state[13] = std::uint32_t(counter >> 32);
+                    m_state[14] = std::uint32_t(nonce);
+                    m_state[15] = std::uint32_t(nonce >> 32);
+                    m_index = block_words;
+                }
+
+                constexpr static result_type min() {
+                    return std::numeric_limits<result_type>::min();
+                }
+
+                constexpr static result_type max() {
+                    return std::numeric_limits<result_type>::max();
+                }
+
+                result_type operator()() {
+                    if (m_index == block_words) {
+                        refill();
+                    }
+                    return m_block[m_index++];
+                }
+
+                template<typename OutputIterator>
+                void generate(OutputIterator first, OutputIterator last) {
+                    for (; first != last; ++first) {
+                        *first = (*this)();
+                    }
+                }
+
+                void discard(unsigned long long z) {
+                    for (; z != 0; --z) {
+                        (*this)();
+                    }
+                }
+
+            private:
+                static std::uint32_t rotl(std::uint32_t x, unsigned n) {
+                    return (x << n) | (x >> (32 - n));
+                }
+
+                static void quarter_round(std::array<std::uint32_t, block_words> &x, std::size_t a, std::size_t b,
+                                          std::size_t c, std::size_t d) {
+                    x[a] += x[b];
+                    x[d] = rotl(x[d] ^ x[a], 16);
+                    x[c] += x[d];
+                    x[b] = rotl(x[b] ^ x[c], 12);
+                    x[a] += x[b];
+                    x[d] = rotl(x[d] ^ x[a], 8);
+                    x[c] += x[d];
+                    x[b] = rotl(x[b] ^ x[c], 7);
+                }
+
+                void refill() {
+                    m_block = m_state;
+                    for (std::size_t round = 0; round < 10; ++round) {
+                        quarter_round(m_block, 0, 4, 8, 12);
+                        quarter_round(m_block, 1, 5, 9, 13);
+                        quarter_round(m_block, 2, 6, 10, 14);
+                        quarter_round(m_block, 3, 7, 11, 15);
+                        quarter_round(m_block, 0, 5, 10, 15);
+                        quarter_round(m_block, 1, 6, 11, 12);
+                        quarter_round(m_block, 2, 7, 8, 13);
+                        quarter_round(m_block, 3, 4, 9, 14);
+                    }
+                    for (std::size_t i = 0; i < block_words; ++i) {
+                        m_block[i] += m_state[i];
+                    }
+
+                    if (++m_state[12] == 0) {
+                        ++m_state[13];
+                    }
+                    m_index = 0;
+                }
+
+                std::array<std::uint32_t, block_words> m_state;
+                std::array<std::uint32_t, block_words> m_block;
+                std::size_t m_index;
+            };
+
+            /// ChaCha20 stream of the calling thread, keyed from boost::random_device on first use
+            inline chacha20_engine &thread_local_random_engine() {
+                thread_local chacha20_engine engine;
+                return engine;
+            }
+        }    // namespace algebra
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_RANDOM_ENGINE_HPP
@@ -25,9 +25,12 @@
 #ifndef CRYPTO3_ALGEBRA_WNAF_HPP
 #define CRYPTO3_ALGEBRA_WNAF_HPP
 
+#include <memory>
+
 #include <nil/crypto3/multiprecision/wnaf.hpp>
 
 #include <nil/crypto3/algebra/curves/params.hpp>
+#include <nil/crypto3/algebra/multiexp/window_tables.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -72,6 +75,14 @@ namespace nil {
                                                     const multiprecision::number<Backend, ExpressionTemplates> &scalar,
                                                     const std::size_t scalar_bits) {
                 std::size_t best = 0;
+
+                const std::shared_ptr<const window_tables> tuned =
+                    tuned_window_tables<typename CurveGroupValueType::group_type>();
+                if (tuned && !tuned->wnaf.empty()) {
+                    best = detail::window_from_thresholds(tuned->wnaf, scalar_bits);
+                    return best > 0 ? fixed_window_wnaf_exp(best, base, scalar) : scalar * base;
+                }
+
                 for (long i =
                          curves::wnaf_params<typename CurveGroupValueType::group_type>::wnaf_window_table.size() - 1;
                      i >= 0;
@@ -0,0 +1,79 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_DETAIL_PARALLEL_FOR_HPP
+#define CRYPTO3_DETAIL_PARALLEL_FOR_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace nil {
+    namespace crypto3 {
+        namespace detail {
+
+            /*!
+             * @brief Splits [begin, end) into at most threads_count contiguous chunks of at least
+             * min_chunk_size items and calls func(chunk_begin, chunk_end) for each of them. The last chunk
+             * runs on the calling thread; with a single chunk everything runs inline without spawning.
+             */
+            template<typename Function>
+            void parallel_for(std::size_t begin, std::size_t end, std::size_t threads_count, Function func,
+                              std::size_t min_chunk_size = 1) {
+                if (end <= begin) {
+                    return;
+                }
+
+                const std::size_t size = end - begin;
+                const std::size_t chunks_count =
+                    std::min(threads_count, std::max<std::size_t>(size / std::max<std::size_t>(min_chunk_size, 1), 1));
+
+                if (chunks_count <= 1) {
+                    func(begin, end);
+                    return;
+                }
+
+                const std::size_t chunk_size = (size + chunks_count - 1) / chunks_count;
+
+                std::vector<std::thread> workers;
+                workers.reserve(chunks_count - 1);
+
+                std::size_t chunk_begin = begin;
+                while (chunk_begin + chunk_size < end) {
+                    workers.emplace_back(func, chunk_begin, chunk_begin + chunk_size);
+                    chunk_begin += chunk_size;
+                }
+                func(chunk_begin, end);
+
+                for (std::thread &worker : workers) {
+                    worker.join();
+                }
+            }
+        }    // namespace detail
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_DETAIL_PARALLEL_FOR_HPP
@@ -27,7 +27,10 @@
 #define BOOST_TEST_MODULE algebra_curves_test
 
 #include <iostream>
+#include <string>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 #include <boost/test/unit_test.hpp>
 #include <boost/test/data/test_case.hpp>
@@ -57,6 +60,9 @@
 // #include <nil/crypto3/algebra/curves/x962_p.hpp>
 #include <nil/crypto3/algebra/curves/ed25519.hpp>
 #include <nil/crypto3/algebra/curves/curve25519.hpp>
+#include <nil/crypto3/algebra/algorithms/x25519.hpp>
+#include <nil/crypto3/algebra/algorithms/batch_verify.hpp>
+#include <nil/crypto3/algebra/algorithms/ecdsa_verify.hpp>
 
 #include <nil/crypto3/algebra/curves/vesta.hpp>
 #include <nil/crypto3/algebra/curves/pallas.hpp>
@@ -64,6 +70,7 @@
 #include <nil/crypto3/algebra/fields/fp3.hpp>
 
 #include <nil/crypto3/algebra/random_element.hpp>
+#include <nil/crypto3/algebra/fixed_base_mul.hpp>
 
 #include <nil/crypto3/multiprecision/cpp_int.hpp>
 
@@ -422,6 +429,109 @@ void curve_operation_test_montgomery(const TestSet &test_set,
     check_montgomery_twisted_edwards_conversion(points, constants);
 }
 
+template<typename GroupType>
+void check_fixed_base_mul() {
+    using scalar_value_type = typename GroupType::curve_type::scalar_field_type::value_type;
+    using group_value_type = typename GroupType::value_type;
+
+    std::vector<scalar_value_type> scalars = {scalar_value_type::zero(), scalar_value_type::one(),
+                                              scalar_value_type(2), -scalar_value_type::one(),
+                                              -scalar_value_type(2)};
+    for (std::size_t i = 0; i < 8; ++i) {
+        scalars.push_back(random_element<typename GroupType::curve_type::scalar_field_type>());
+    }
+
+    for (const scalar_value_type &k : scalars) {
+        BOOST_CHECK(fixed_base_mul<GroupType>(k) == k * group_value_type::one());
+    }
+    BOOST_CHECK(fixed_base_mul<GroupType>(-scalar_value_type::one()) == -group_value_type::one());
+}
+
+template<typename GroupType>
+void check_unified_addition() {
+    using group_value_type = typename GroupType::value_type;
+
+    const group_value_type P = random_element<GroupType>();
+    const group_value_type P2 = P.doubled();
+    // the same point reached along two paths, generally with different Z
+    const group_value_type P3 = P2 + P, P3_other = P + P2;
+
+    BOOST_CHECK(P + P == P2);
+    BOOST_CHECK((P + (-P)).is_zero());
+    BOOST_CHECK(P3 + P3_other == P3.doubled());
+    BOOST_CHECK((P3 + (-P3_other)).is_zero());
+    BOOST_CHECK(P3 + P3_other == P2 + P2 + P2);
+}
+
+template<typename GroupType>
+void check_ecdsa_verify() {
+    using scalar_field_type = typename GroupType::curve_type::scalar_field_type;
+    using base_field_type = typename GroupType::curve_type::base_field_type;
+    using scalar_value_type = typename scalar_field_type::value_type;
+    using base_value_type = typename base_field_type::value_type;
+    using group_value_type = typename GroupType::value_type;
+    using integral_type = nil::crypto3::multiprecision::cpp_int;
+
+    const integral_type n = integral_type(scalar_field_type::modulus);
+    const auto affine_coordinates = [](const group_value_type &P) {
+        if constexpr (std::is_same<typename group_value_type::coordinates, curves::coordinates::affine>::value) {
+            return std::make_pair(P.X, P.Y);
+        } else {
+            const auto A = P.to_affine();
+            return std::make_pair(A.X, A.Y);
+        }
+    };
+    const auto make_point = [](const base_value_type &x, const base_value_type &y) {
+        if constexpr (std::is_same<typename group_value_type::coordinates, curves::coordinates::affine>::value) {
+            return group_value_type(x, y);
+        } else {
+            return group_value_type(x, y, base_value_type::one());
+        }
+    };
+    const auto x_mod_n = [&](const group_value_type &P) {
+        const integral_type x = integral_type(affine_coordinates(P).first.data);
+        return scalar_value_type(static_cast<typename scalar_field_type::integral_type>(x % n));
+    };
+
+    for (std::size_t i = 0; i < 8; ++i) {
+        const scalar_value_type d = random_element<scalar_field_type>();
+        const scalar_value_type k = random_element<scalar_field_type>();
+        const scalar_value_type e = random_element<scalar_field_type>();
+        const group_value_type Q = d * group_value_type::one();
+        const scalar_value_type r = x_mod_n(k * group_value_type::one());
+        const scalar_value_type s = k.inversed() * (e + r * d);
+
+        BOOST_CHECK(ecdsa_verify<GroupType>(Q, e, r, s));
+        BOOST_CHECK(!ecdsa_verify<GroupType>(Q, e, r, s + scalar_value_type::one()));
+        BOOST_CHECK(!ecdsa_verify<GroupType>(Q, e + scalar_value_type::one(), r, s));
+        BOOST_CHECK(!ecdsa_verify<GroupType>(Q.doubled(), e, r, s));
+        BOOST_CHECK(!ecdsa_verify<GroupType>(Q, e, scalar_value_type::zero(), s));
+        BOOST_CHECK(!ecdsa_verify<GroupType>(Q, e, r, scalar_value_type::zero()));
+
+        const auto [Qx, Qy] = affine_coordinates(Q);
+        BOOST_CHECK(!ecdsa_verify<GroupType>(make_point(Qx, Qy + base_value_type::one()), e, r, s));
+    }
+
+    // a point with n <= x < p, the same point reached along two paths so that Z != 1 outside affine coordinates
+    integral_type x = n;
+    base_value_type y2;
+    do {
+        ++x;
+        const base_value_type bx(static_cast<typename base_field_type::integral_type>(x));
+        y2 = bx.squared() * bx + base_value_type(GroupType::params_type::a) * bx +
+             base_value_type(GroupType::params_type::b);
+    } while (!y2.is_square());
+    const group_value_type P =
+        make_point(base_value_type(static_cast<typename base_field_type::integral_type>(x)), y2.sqrt());
+    const group_value_type P_other = P.doubled() + (-P);
+    const scalar_value_type r = scalar_value_type(static_cast<typename scalar_field_type::integral_type>(x - n));
+
+    BOOST_CHECK(x_mod_n(P_other) == r);
+    BOOST_CHECK(x_coordinate_equals<GroupType>(P_other, r));
+    BOOST_CHECK(!x_coordinate_equals<GroupType>(P_other, r + scalar_value_type::one()));
+    BOOST_CHECK(!x_coordinate_equals<GroupType>(group_value_type::zero(), r));
+}
+
 BOOST_AUTO_TEST_SUITE(curves_manual_tests)
 /**/
 
@@ -495,6 +605,125 @@ BOOST_AUTO_TEST_CASE(curve_operation_test_babyjubjub_g1) {
     // curve_operation_test_twisted_edwards<policy_type>(data_set, fp_curve_test_init<policy_type>);
 }
 
+BOOST_AUTO_TEST_CASE(curve_operation_test_x25519) {
+    auto octets = [](const std::string &hex) {
+        x25519_octets result;
+        for (std::size_t i = 0; i < result.size(); ++i) {
+            result[i] = static_cast<std::uint8_t>(std::stoul(hex.substr(2 * i, 2), nullptr, 16));
+        }
+        return result;
+    };
+
+    // https://datatracker.ietf.org/doc/html/rfc7748#section-5.2
+    const x25519_octets k1 = octets("a546e36bf0527c9d3b16154b82465edd62144c0ac1fc5a18506a2244ba449ac4");
+    const x25519_octets u1 = octets("e6db6867583030db3594c1a424b15f7c726624ec26b3353b10a903a6d0ab1c4c");
+    const x25519_octets k2 = octets("4b66e9d4d1b4673c5ad22691957d6af5c11b6421e0ea01d42ca4169e7918ba0d");
+    const x25519_octets u2 = octets("e5210f12786811d3f4b7959d0538ae2c31dbe7106fc03c3efc4cd549c715a493");
+
+    BOOST_CHECK(x25519(k1, u1) == octets("c3da55379de9c6908e94ea4df28d084f32eccf03491c71f754b4075577a28552"));
+    BOOST_CHECK(x25519(k2, u2) == octets("95cbde9476e8907d7aade45cb4b873f88b595a68799fa152e6f8f7647aac7957"));
+
+    x25519_octets k = octets("0900000000000000000000000000000000000000000000000000000000000000");
+    BOOST_CHECK(x25519(k, k) == octets("422c8e7a6227d7bca1350b3e2bb7279f7897b87bb6854b783c60e80311ae3079"));
+
+    // https://datatracker.ietf.org/doc/html/rfc7748#section-6.1
+    const x25519_octets alice = octets("77076d0a7318a57d3c16c17251b26645df4c2f87ebc0992ab177fba51db92c2a");
+    const x25519_octets bob = octets("5dab087e624a8a4b79e17f8b83800ee66f3bb1292618b6fd1c2f8b27ff88e0eb");
+    const x25519_octets alice_public = x25519_base(alice);
+    const x25519_octets bob_public = x25519_base(bob);
+
+    BOOST_CHECK(alice_public == octets("8520f0098930a754748b7ddcb43ef75a0dbf3a0d26381af4eba4a98eaa9b4e6a"));
+    BOOST_CHECK(bob_public == octets("de9edb7d7b7dc1b4d35b61c2ece435373f8343c85b78674dadfc7e146f882b4f"));
+    BOOST_CHECK(x25519(alice, bob_public) == x25519(bob, alice_public));
+    BOOST_CHECK(x25519(alice, bob_public) ==
+                octets("4a5d9d5ba4ce2de1728e3bf480350f25e07e21c947d19e3376f09b3c1e161742"));
+
+    // low order point: the all-zero output of section 6.1
+    BOOST_CHECK(x25519(alice, x25519_octets {0}) == x25519_octets {0});
+
+    const std::vector<x25519_octets> scalars = {k1, k2, alice, bob, alice};
+    const std::vector<x25519_octets> points = {u1, u2, bob_public, alice_public, x25519_octets {0}};
+    for (std::size_t threads_count : {1, 3}) {
+        const std::vector<x25519_octets> batch = x25519_batch(scalars, points, threads_count);
+        BOOST_REQUIRE_EQUAL(batch.size(), scalars.size());
+        for (std::size_t i = 0; i < scalars.size(); ++i) {
+            BOOST_CHECK(batch[i] == x25519(scalars[i], points[i]));
+        }
+    }
+
+    // differential addition and doubling agree with the ladder
+    using xz_type = curves::curve25519::g1_type<curves::coordinates::xz, curves::forms::montgomery>::value_type;
+    const xz_type P = xz_type::one();
+    const xz_type P2 = P.doubled();
+    const xz_type P3 = P2.differential_add(P, P);
+    const typename xz_type::field_type::value_type x = xz_type::one().X;
+
+    BOOST_CHECK(P2 == curves::detail::montgomery_ladder<xz_type>(x, typename xz_type::field_type::integral_type(2), 2));
+    BOOST_CHECK(P3 == curves::detail::montgomery_ladder<xz_type>(x, typename xz_type::field_type::integral_type(3), 2));
+    BOOST_CHECK(P3.differential_add(P2, P).doubled() ==
+                curves::detail::montgomery_ladder<xz_type>(x, typename xz_type::field_type::integral_type(10), 4));
+}
+
+BOOST_AUTO_TEST_CASE(curve_ed25519_batch_verify_test) {
+    using group_type = curves::ed25519::g1_type<>;
+    using scalar_field_type = curves::ed25519::scalar_field_type;
+    using value_type = typename group_type::value_type;
+    using scalar_value_type = typename scalar_field_type::value_type;
+
+    const std::size_t n = 32;
+    std::vector<value_type> R, A;
+    std::vector<scalar_value_type> s, k, weights;
+    for (std::size_t i = 0; i < n; ++i) {
+        const scalar_value_type a = random_element<scalar_field_type>();
+        const scalar_value_type r = random_element<scalar_field_type>();
+        k.emplace_back(random_element<scalar_field_type>());
+        A.emplace_back(a * value_type::one());
+        R.emplace_back(r * value_type::one());
+        s.emplace_back(r + k.back() * a);
+        weights.emplace_back(random_element<scalar_field_type>());
+    }
+
+    BOOST_CHECK(ed25519_batch_verify(R, A, s, k, weights));
+    BOOST_CHECK(ed25519_batch_verify(R, A, s, k, weights, 4));
+    BOOST_CHECK(ed25519_batch_verify<policies::multiexp_method_bos_coster>(R, A, s, k, weights));
+    BOOST_CHECK(ed25519_batch_verify({}, {}, {}, {}, {}));
+
+    std::vector<scalar_value_type> bad_s = s;
+    bad_s[n / 2] = bad_s[n / 2] + scalar_value_type::one();
+    BOOST_CHECK(!ed25519_batch_verify(R, A, bad_s, k, weights));
+    BOOST_CHECK(!ed25519_batch_verify(R, A, bad_s, k, weights, 4));
+
+    std::vector<value_type> swapped_A = A;
+    std::swap(swapped_A[0], swapped_A[1]);
+    BOOST_CHECK(!ed25519_batch_verify(R, swapped_A, s, k, weights));
+}
+
+BOOST_AUTO_TEST_CASE(curve_ecdsa_verify_test) {
+    check_ecdsa_verify<curves::secp_k1<256>::g1_type<>>();
+    check_ecdsa_verify<curves::secp_k1<256>::g1_type<curves::coordinates::affine>>();
+    check_ecdsa_verify<curves::secp_r1<256>::g1_type<>>();
+    check_ecdsa_verify<curves::secp_r1<256>::g1_type<curves::coordinates::jacobian_with_a4_minus_3>>();
+}
+
+BOOST_AUTO_TEST_CASE(curve_fixed_base_mul_test) {
+    check_fixed_base_mul<curves::ed25519::g1_type<>>();
+    check_fixed_base_mul<curves::secp_k1<256>::g1_type<>>();
+    check_fixed_base_mul<curves::secp_r1<256>::g1_type<>>();
+    check_fixed_base_mul<curves::bls12<381>::g1_type<>>();
+    check_fixed_base_mul<curves::bls12<381>::g2_type<>>();
+    check_fixed_base_mul<curves::alt_bn128<254>::g1_type<>>();
+    check_fixed_base_mul<curves::alt_bn128<254>::g2_type<>>();
+}
+
+BOOST_AUTO_TEST_CASE(curve_unified_addition_test) {
+    check_unified_addition<curves::secp_r1<256>::g1_type<curves::coordinates::projective>>();
+    check_unified_addition<curves::secp_r1<256>::g1_type<curves::coordinates::projective_with_a4_minus_3>>();
+    check_unified_addition<curves::secp_r1<256>::g1_type<curves::coordinates::jacobian>>();
+    check_unified_addition<curves::secp_r1<256>::g1_type<curves::coordinates::jacobian_with_a4_minus_3>>();
+    check_unified_addition<curves::bls12<381>::g1_type<>>();
+    check_unified_addition<curves::bls12<381>::g2_type<>>();
+}
+
 BOOST_DATA_TEST_CASE(curve_operation_test_jubjub_montgomery_affine,
                      string_data("curve_operation_test_jubjub_montgomery_affine"),
                      data_set) {
@@ -69,6 +69,9 @@
 #include <nil/crypto3/algebra/fields/detail/element/fp.hpp>
 #include <nil/crypto3/algebra/fields/detail/element/fp2.hpp>
 
+#include <nil/crypto3/algebra/random_element.hpp>
+#include <nil/crypto3/algebra/random_engine.hpp>
+
 using namespace nil::crypto3::algebra;
 
 template<typename FieldParams>
@@ -362,6 +365,7 @@ void check_field_operations(const std::vector<element_type> &elements, const std
     BOOST_CHECK_EQUAL(elements[e1].pow(constants[C1]), elements[e1_pow_C1]);
     BOOST_CHECK_EQUAL(elements[e2].squared(), elements[e2_pow_2]);
     BOOST_CHECK_EQUAL((elements[e2].squared()).sqrt().squared(), elements[e2_pow_2_sqrt].squared());
+    BOOST_CHECK(elements[e2].squared().is_square());
     BOOST_CHECK_EQUAL(-elements[e1], elements[minus_e1]);
 }
 
@@ -382,25 +386,66 @@ void check_field_operations_wo_sqrt(const std::vector<element_type> &elements,
 template<typename FieldParams>
 void check_field_operations(const std::vector<fields::detail::element_fp4<FieldParams>> &elements,
                             const std::vector<constant_type> &constants) {
+    using element_type = fields::detail::element_fp4<FieldParams>;
+    using fp2_type = typename element_type::underlying_type;
+
     check_field_operations_wo_sqrt(elements, constants);
+
+    // specialized non-residue kernel against the generic product by the generator
+    BOOST_CHECK_EQUAL(element_type::mul_by_non_residue(elements[e1].data[0]),
+                      elements[e1].data[0] * fp2_type(fp2_type::underlying_type::zero(),
+                                                      fp2_type::underlying_type::one()));
 }
 
 template<typename FieldParams>
 void check_field_operations(const std::vector<fields::detail::element_fp6_3over2<FieldParams>> &elements,
                             const std::vector<constant_type> &constants) {
+    using element_type = fields::detail::element_fp6_3over2<FieldParams>;
+
     check_field_operations_wo_sqrt(elements, constants);
+
+    // specialized non-residue kernel against the generic product by the non-residue
+    BOOST_CHECK_EQUAL(element_type::mul_by_non_residue(elements[e1].data[1]),
+                      element_type::non_residue * elements[e1].data[1]);
 }
 
 template<typename FieldParams>
 void check_field_operations(const std::vector<fields::detail::element_fp6_2over3<FieldParams>> &elements,
                             const std::vector<constant_type> &constants) {
+    using element_type = fields::detail::element_fp6_2over3<FieldParams>;
+    using fp3_type = typename element_type::underlying_type;
+    using fp_type = typename fp3_type::underlying_type;
+
     check_field_operations_wo_sqrt(elements, constants);
+
+    // specialized non-residue kernel against the generic product by the generator
+    BOOST_CHECK_EQUAL(element_type::mul_by_non_residue(elements[e1].data[0]),
+                      elements[e1].data[0] * fp3_type(fp_type::zero(), fp_type::one(), fp_type::zero()));
 }
 
 template<typename FieldParams>
 void check_field_operations(const std::vector<fields::detail::element_fp12_2over3over2<FieldParams>> &elements,
                             const std::vector<constant_type> &constants) {
+    using element_type = fields::detail::element_fp12_2over3over2<FieldParams>;
+    using fp6_type = typename element_type::underlying_type;
+    using fp2_type = typename fp6_type::underlying_type;
+
     check_field_operations_wo_sqrt(elements, constants);
+
+    // sparse line multiplications against the full product
+    const fp2_type &x0 = elements[e2].data[0].data[0], &x1 = elements[e2].data[0].data[1],
+                   &x2 = elements[e2].data[1].data[2];
+    BOOST_CHECK_EQUAL(elements[e1].mul_by_024(x0, x1, x2),
+                      elements[e1] * element_type(fp6_type(x0, fp2_type::zero(), x2),
+                                                  fp6_type(fp2_type::zero(), x1, fp2_type::zero())));
+    BOOST_CHECK_EQUAL(elements[e1].mul_by_045(x0, x1, x2),
+                      elements[e1] * element_type(fp6_type(x1, fp2_type::zero(), fp2_type::zero()),
+                                                  fp6_type(fp2_type::zero(), x0, x2)));
+
+    // specialized non-residue kernel and cached Frobenius coefficients
+    BOOST_CHECK_EQUAL(element_type::mul_by_non_residue(elements[e1].data[1]),
+                      elements[e1].data[1] * fp6_type(fp2_type::zero(), fp2_type::one(), fp2_type::zero()));
+    BOOST_CHECK_EQUAL(elements[e1].Frobenius_map(1), elements[e1].pow(FieldParams::modulus));
 }
 
 template<typename ElementType, typename TestSet>
@@ -966,4 +1011,133 @@ BOOST_AUTO_TEST_CASE(field_not_square_manual_test_bls12_381_fq2) {
     field_not_square_test<policy_type>(not_squares);
 }
 
+template<typename ElementType>
+void field_mul_small_test(const ElementType &a) {
+    BOOST_CHECK(fields::mul_small<0>(a) == ElementType::zero());
+    BOOST_CHECK(fields::mul_small<1>(a) == a);
+    BOOST_CHECK(fields::mul_small<3>(a) == a + a + a);
+    BOOST_CHECK(fields::mul_small<8>(a) == a.doubled().doubled().doubled());
+    BOOST_CHECK(fields::mul_small<21>(a) == fields::mul_small<16>(a) + fields::mul_small<4>(a) + a);
+}
+
+BOOST_AUTO_TEST_CASE(field_mul_small_test_bls12_381) {
+    using fq_value_type = typename fields::bls12_fq<381>::value_type;
+    using fq2_value_type = typename fields::fp2<fields::bls12_fq<381>>::value_type;
+
+    const fq_value_type a = fq_value_type(0x1CE2D5B8).pow(5u);
+    field_mul_small_test(a);
+    field_mul_small_test(fq2_value_type(a, fq_value_type(0x3F41B9).inversed()));
+
+    BOOST_CHECK(fields::mul_small<21>(a) == a * fq_value_type(21));
+
+    // Built-in integers take the addition chain up to the bound, larger ones a full multiplication
+    BOOST_CHECK(0x03 * a == a * fq_value_type(3));
+    BOOST_CHECK(a * 63 == a * fq_value_type(63));
+    BOOST_CHECK(a * 64 == a * fq_value_type(64));
+    BOOST_CHECK(a * 12345 == a * fq_value_type(12345));
+    BOOST_CHECK(-7 * a == -(a * fq_value_type(7)));
+    BOOST_CHECK(a * 0u == fq_value_type::zero());
+    BOOST_CHECK(a * 0x1234567890ull == a * fq_value_type(0x1234567890ull));
+}
+
+/// Roots of random squares, and not_square times a non-zero square is not a square
+template<typename FieldType>
+void field_sqrt_test(const typename FieldType::value_type &not_square) {
+    typedef typename FieldType::value_type value_type;
+
+    BOOST_CHECK(value_type::zero().is_square());
+    BOOST_CHECK(value_type::zero().sqrt() == value_type::zero());
+    BOOST_CHECK(value_type::one().sqrt().squared() == value_type::one());
+    BOOST_CHECK(!not_square.is_square());
+
+    for (std::size_t i = 0; i < 16; ++i) {
+        const value_type a = random_element<FieldType>();
+        const value_type root = a.squared().sqrt();
+
+        BOOST_CHECK(a.squared().is_square());
+        BOOST_CHECK(root == a || root == -a);
+        BOOST_CHECK(a.is_zero() || !(a.squared() * not_square).is_square());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(field_sqrt_test_prime_fields) {
+    // p = 3 (mod 4): -1 is not a square, a single exponentiation by (p + 1) / 4
+    field_sqrt_test<fields::bls12_fq<381>>(-fields::bls12_fq<381>::value_type::one());
+    field_sqrt_test<fields::secp_k1_base_field<256>>(-fields::secp_k1_base_field<256>::value_type::one());
+    field_sqrt_test<fields::secp_r1_base_field<256>>(-fields::secp_r1_base_field<256>::value_type::one());
+
+    // p = 5 (mod 8): 2 is not a square, Atkin's method
+    field_sqrt_test<fields::curve25519_base_field>(fields::curve25519_base_field::value_type(2));
+    field_sqrt_test<fields::curve25519_scalar_field>(fields::curve25519_scalar_field::value_type(2));
+
+    // p = 1 (mod 8): Tonelli--Shanks
+    field_sqrt_test<fields::bls12_fr<381>>(fields::bls12_fr<381>::value_type(5));
+    field_sqrt_test<fields::secp_k1_scalar_field<256>>(fields::secp_k1_scalar_field<256>::value_type(5));
+    field_sqrt_test<fields::secp_r1_scalar_field<256>>(fields::secp_r1_scalar_field<256>::value_type(7));
+
+    // sqrt() reports a non-square as -1
+    BOOST_CHECK(fields::curve25519_base_field::value_type(2).sqrt() ==
+                -fields::curve25519_base_field::value_type::one());
+    BOOST_CHECK(fields::bls12_fq<381>::value_type(2).sqrt() == -fields::bls12_fq<381>::value_type::one());
+    BOOST_CHECK(fields::bls12_fr<381>::value_type(5).sqrt() == -fields::bls12_fr<381>::value_type::one());
+}
+
+BOOST_AUTO_TEST_CASE(field_sqrt_test_bls12_381_fq2) {
+    using fq_type = fields::bls12_fq<381>;
+    using fq2_type = fields::fp2<fq_type>;
+    using fq_value_type = typename fq_type::value_type;
+    using fq2_value_type = typename fq2_type::value_type;
+
+    // the norm 1 + 1 = 2 is not a square in Fq
+    field_sqrt_test<fq2_type>(fq2_value_type(1, 1));
+
+    // zero imaginary part: every element of Fq is a square in Fq2, the root of -b^2 being b * u
+    const fq_value_type b = random_element<fq_type>();
+    const fq2_value_type real_square(b.squared(), fq_value_type::zero());
+    const fq2_value_type real_not_square(-b.squared(), fq_value_type::zero());
+    BOOST_CHECK(real_square.is_square());
+    BOOST_CHECK(real_not_square.is_square());
+    BOOST_CHECK(real_square.sqrt().squared() == real_square);
+    BOOST_CHECK(real_not_square.sqrt().squared() == real_not_square);
+    BOOST_CHECK(real_not_square.sqrt().data[0].is_zero());
+
+    // zero real part: the norm is b^2, and one of the two candidates (0 +- b) / 2 is not a square in Fq
+    const fq2_value_type imaginary(fq_value_type::zero(), b);
+    BOOST_CHECK(imaginary.is_square());
+    BOOST_CHECK(imaginary.sqrt().squared() == imaginary);
+}
+
+BOOST_AUTO_TEST_CASE(random_engine_chacha20_test) {
+    // RFC 8439, section 2.3.2: key 00..1f, block counter 1, nonce 000000090000004a00000000
+    chacha20_engine::key_type key;
+    for (std::size_t i = 0; i < key.size(); ++i) {
+        key[i] = std::uint32_t(4 * i) | std::uint32_t(4 * i + 1) << 8 | std::uint32_t(4 * i + 2) << 16 |
+                 std::uint32_t(4 * i + 3) << 24;
+    }
+    chacha20_engine engine(key, 1 | std::uint64_t(0x09000000) << 32, 0x4a000000);
+
+    const std::uint32_t expected[] = {0xe4e7f110, 0x15593bd1, 0x1fdd0f50, 0xc47120a3};
+    for (std::uint32_t word : expected) {
+        BOOST_CHECK_EQUAL(engine(), word);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(random_elements_test_bls12_381) {
+    using fq_type = fields::bls12_fq<381>;
+    using fq2_type = fields::fp2<fq_type>;
+
+    chacha20_engine::key_type key = {};
+    chacha20_engine first(key), second(key);
+
+    const std::vector<typename fq_type::value_type> elements = random_elements<fq_type>(64, first);
+    BOOST_CHECK_EQUAL(elements.size(), 64);
+    BOOST_CHECK(elements == random_elements<fq_type>(64, second));
+    for (std::size_t i = 1; i < elements.size(); ++i) {
+        BOOST_CHECK(elements[i] != elements[i - 1]);
+    }
+
+    BOOST_CHECK_EQUAL(random_elements<fq2_type>(8).size(), 8);
+    BOOST_CHECK(random_element<fq_type>() != random_element<fq_type>());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -42,7 +42,13 @@
 #include <nil/crypto3/algebra/curves/detail/h2c/ep2.hpp>
 #include <nil/crypto3/algebra/curves/detail/h2c/h2c_expand.hpp>
 
+#include <nil/crypto3/algebra/curves/alt_bn128.hpp>
 #include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/curves/curve25519.hpp>
+#include <nil/crypto3/algebra/curves/ed25519.hpp>
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <nil/crypto3/algebra/curves/secp_k1.hpp>
+#include <nil/crypto3/algebra/curves/vesta.hpp>
 
 #include <nil/crypto3/algebra/fields/bls12/base_field.hpp>
 
@@ -71,6 +77,11 @@ void print_fp_curve_group_element(std::ostream &os, const FpCurveGroupElement &e
     os << "( " << e.X.data << " : " << e.Y.data << " : " << e.Z.data << " )";
 }
 
+template<typename FpAffineCurveGroupElement>
+void print_fp_affine_curve_group_element(std::ostream &os, const FpAffineCurveGroupElement &e) {
+    os << "( " << e.X.data << " : " << e.Y.data << " )";
+}
+
 template<typename Fp2CurveGroupElement>
 void print_fp2_curve_group_element(std::ostream &os, const Fp2CurveGroupElement &e) {
     os << "(" << e.X.data[0].data << " , " << e.X.data[1].data << ") : (" << e.Y.data[0].data << " , "
@@ -108,6 +119,49 @@ namespace boost {
                 }
             };
 
+            template<>
+            struct print_log_value<typename curves::alt_bn128_254::g1_type<>::value_type> {
+                void operator()(std::ostream &os, typename curves::alt_bn128_254::g1_type<>::value_type const &e) {
+                    print_fp_curve_group_element(os, e);
+                }
+            };
+
+            template<>
+            struct print_log_value<typename curves::pallas::g1_type<>::value_type> {
+                void operator()(std::ostream &os, typename curves::pallas::g1_type<>::value_type const &e) {
+                    print_fp_curve_group_element(os, e);
+                }
+            };
+
+            template<>
+            struct print_log_value<typename curves::vesta::g1_type<>::value_type> {
+                void operator()(std::ostream &os, typename curves::vesta::g1_type<>::value_type const &e) {
+                    print_fp_curve_group_element(os, e);
+                }
+            };
+
+            template<>
+            struct print_log_value<typename curves::secp256k1::g1_type<>::value_type> {
+                void operator()(std::ostream &os, typename curves::secp256k1::g1_type<>::value_type const &e) {
+                    print_fp_curve_group_element(os, e);
+                }
+            };
+
+            template<>
+            struct print_log_value<typename curves::ed25519::g1_type<>::value_type> {
+                void operator()(std::ostream &os, typename curves::ed25519::g1_type<>::value_type const &e) {
+                    print_fp_curve_group_element(os, e);
+                }
+            };
+
+            template<>
+            struct print_log_value<typename curves::curve25519::g1_type<coordinates::affine>::value_type> {
+                void operator()(std::ostream &os,
+                                typename curves::curve25519::g1_type<coordinates::affine>::value_type const &e) {
+                    print_fp_affine_curve_group_element(os, e);
+                }
+            };
+
             template<template<typename, typename> class P, typename K, typename V>
             struct print_log_value<P<K, V>> {
                 void operator()(std::ostream &, P<K, V> const &) {
@@ -156,6 +210,21 @@ void check_hash_to_field_ro(const std::string &msg_str,
     }
 }
 
+template<typename H2CType,
+         typename DstType,
+         typename = typename std::enable_if<std::is_same<std::uint8_t, typename DstType::value_type>::value>::type>
+void check_hash_to_curve_batch(const std::vector<std::string> &msg_strs, const DstType &dst) {
+    std::vector<std::vector<std::uint8_t>> msgs;
+    for (const std::string &msg_str : msg_strs) {
+        msgs.emplace_back(msg_str.begin(), msg_str.end());
+    }
+    auto result = H2CType::hash_to_curve_batch(msgs, dst);
+    BOOST_CHECK_EQUAL(result.size(), msgs.size());
+    for (std::size_t i = 0; i < msgs.size(); i++) {
+        BOOST_CHECK(result[i] == H2CType::hash_to_curve(msgs[i], dst));
+    }
+}
+
 template<typename H2CType,
          typename GroupValueType,
          typename DstType,
@@ -320,6 +389,227 @@ BOOST_AUTO_TEST_CASE(expand_message_xmd_sha256_test) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(expand_message_xof_shake128_test) {
+    // https://www.rfc-editor.org/rfc/rfc9380#appendix-K.4
+    using expand_message = expand_message_xof<128, shake<128>>;
+
+    std::string DST_str("QUUX-V01-CS02-with-expander-SHAKE128");
+    std::vector<std::uint8_t> DST(DST_str.begin(), DST_str.end());
+
+    // {len_in_bytes, msg, uniform_bytes}
+    using samples_type = std::vector<std::tuple<std::size_t, std::string, std::vector<std::uint8_t>>>;
+    samples_type samples {
+        {0x20,
+         "",
+         {0x86, 0x51, 0x8c, 0x9c, 0xd8, 0x65, 0x81, 0x48, 0x6e, 0x94, 0x85, 0xaa, 0x74, 0xab, 0x35, 0xba,
+          0x15, 0xd, 0x1c, 0x75, 0xc8, 0x8e, 0x26, 0xb7, 0x4, 0x3e, 0x44, 0xe2, 0xac, 0xd7, 0x35, 0xa2}},
+        {0x20,
+         "abc",
+         {0x86, 0x96, 0xaf, 0x52, 0xa4, 0xd8, 0x62, 0x41, 0x7c, 0x7, 0x63, 0x55, 0x60, 0x73, 0xf4, 0x7b,
+          0xc9, 0xb9, 0xba, 0x43, 0xc9, 0x9b, 0x50, 0x53, 0x5, 0xcb, 0x1e, 0xc0, 0x4a, 0x9a, 0xb4, 0x68}},
+        {0x20,
+         "abcdef0123456789",
+         {0x91, 0x2c, 0x58, 0xde, 0xac, 0x48, 0x21, 0xc3, 0x50, 0x9d, 0xbe, 0xfa, 0x9, 0x4d, 0xf5, 0x4b,
+          0x34, 0xb8, 0xf5, 0xd0, 0x1a, 0x19, 0x1d, 0x1d, 0x31, 0x8, 0xa2, 0xc8, 0x90, 0x77, 0xac, 0xca}},
+        {0x20,
+         "q128_" + std::string(128, 'q'),
+         {0x1a, 0xdb, 0xcc, 0x44, 0x8a, 0xef, 0x2a, 0xc, 0xeb, 0xc7, 0x1d, 0xac, 0x9f, 0x75, 0x6b, 0x22,
+          0xe5, 0x18, 0x39, 0xd3, 0x48, 0xe0, 0x31, 0xe6, 0x3b, 0x33, 0xeb, 0xb5, 0xf, 0xae, 0xaf, 0x3f}},
+        {0x20,
+         "a512_" + std::string(512, 'a'),
+         {0xdf, 0x34, 0x47, 0xcc, 0x5f, 0x3e, 0x9a, 0x77, 0xda, 0x10, 0xf8, 0x19, 0x21, 0x8d, 0xdf, 0x31,
+          0x34, 0x2c, 0x31, 0x7, 0x78, 0xe0, 0xe4, 0xef, 0x72, 0xbb, 0xae, 0xce, 0xe7, 0x86, 0xa4, 0xfe}},
+        {0x80,
+         "",
+         {0x73, 0x14, 0xff, 0x1a, 0x15, 0x5a, 0x2f, 0xb9, 0x9a, 0x1, 0x71, 0xdc, 0x71, 0xb8, 0x9a, 0xb6,
+          0xe3, 0xb2, 0xb7, 0xd5, 0x9e, 0x38, 0xe6, 0x44, 0x19, 0xb8, 0xb6, 0x29, 0x4d, 0x3, 0xff, 0xee,
+          0x42, 0x49, 0x1f, 0x11, 0x37, 0x2, 0x61, 0xf4, 0x36, 0x22, 0xe, 0xf7, 0x87, 0xf8, 0xf7, 0x6f,
+          0x5b, 0x26, 0xbd, 0xcd, 0x85, 0x0, 0x71, 0x92, 0xc, 0xe0, 0x23, 0xf3, 0xac, 0x46, 0x84, 0x77,
+          0x44, 0xf4, 0x61, 0x2b, 0x87, 0x14, 0xdb, 0x8f, 0x5d, 0xb8, 0x32, 0x5, 0xb2, 0xe6, 0x25, 0xd9,
+          0x5a, 0xfd, 0x7d, 0x7b, 0x4d, 0x30, 0x94, 0xd3, 0xbd, 0xde, 0x81, 0x5f, 0x52, 0x85, 0xb, 0xb4,
+          0x1e, 0xad, 0x98, 0x22, 0xe0, 0x8f, 0x22, 0xcf, 0x41, 0xd6, 0x15, 0xa3, 0x3, 0xb0, 0xd9, 0xdd,
+          0xe7, 0x32, 0x63, 0xc0, 0x49, 0xa7, 0xb9, 0x89, 0x82, 0x8, 0x0, 0x3a, 0x73, 0x9a, 0x2e, 0x57}},
+        {0x80,
+         "abc",
+         {0xc9, 0x52, 0xf0, 0xc8, 0xe5, 0x29, 0xca, 0x88, 0x24, 0xac, 0xc6, 0xa4, 0xca, 0xb0, 0xe7, 0x82,
+          0xfc, 0x36, 0x48, 0xc5, 0x63, 0xdd, 0xb0, 0xd, 0xa7, 0x39, 0x9f, 0x2a, 0xe3, 0x56, 0x54, 0xf4,
+          0x86, 0xe, 0xc6, 0x71, 0xdb, 0x23, 0x56, 0xba, 0x7b, 0xaa, 0x55, 0xa3, 0x4a, 0x9d, 0x7f, 0x79,
+          0x19, 0x7b, 0x60, 0xdd, 0xae, 0x6e, 0x64, 0x76, 0x8a, 0x37, 0xd6, 0x99, 0xa7, 0x83, 0x23, 0x49,
+          0x6d, 0xb3, 0x87, 0x8c, 0x8d, 0x64, 0xd9, 0x9, 0xd0, 0xf8, 0xa7, 0xde, 0x49, 0x27, 0xdc, 0xab,
+          0xd, 0x3d, 0xbb, 0xc2, 0x6c, 0xb2, 0xa, 0x49, 0xec, 0xeb, 0x5, 0x30, 0xb4, 0x31, 0xcd, 0xf4,
+          0x7b, 0xc8, 0xc0, 0xfa, 0x3e, 0xd, 0x88, 0xf5, 0x3b, 0x31, 0x8b, 0x67, 0x39, 0xfb, 0xed, 0x7d,
+          0x76, 0x34, 0x97, 0x4f, 0x1b, 0x5c, 0x38, 0x6d, 0x62, 0x30, 0xc7, 0x62, 0x60, 0xd5, 0x33, 0x7a}},
+        {0x80,
+         "abcdef0123456789",
+         {0x19, 0xb6, 0x5e, 0xe7, 0xaf, 0xec, 0x6a, 0xc0, 0x6a, 0x14, 0x4f, 0x2d, 0x61, 0x34, 0xf0, 0x8e,
+          0xee, 0xc1, 0x85, 0xf1, 0xa8, 0x90, 0xfe, 0x34, 0xe6, 0x8f, 0xe, 0x37, 0x7b, 0x7d, 0x3, 0x12,
+          0x88, 0x3c, 0x4, 0x8d, 0x9b, 0x8a, 0x1d, 0x6e, 0xcc, 0x3b, 0x54, 0x1c, 0xb4, 0x98, 0x7c, 0x26,
+          0xf4, 0x5e, 0xc, 0x82, 0x69, 0x1e, 0xa2, 0x99, 0xb5, 0xe6, 0x88, 0x9b, 0xbf, 0xe5, 0x89, 0x15,
+          0x30, 0x16, 0xd8, 0x13, 0x17, 0x17, 0xba, 0x26, 0xf0, 0x7c, 0x3c, 0x14, 0xff, 0xbe, 0xf1, 0xf3,
+          0xef, 0xf9, 0x75, 0x2e, 0x5b, 0x61, 0x83, 0xf4, 0x38, 0x71, 0xa7, 0x82, 0x19, 0xa7, 0x5e, 0x70,
+          0x0, 0xfb, 0xac, 0x6a, 0x70, 0x72, 0xe2, 0xb8, 0x3c, 0x79, 0xa, 0x3a, 0x5a, 0xec, 0xd9, 0xd1,
+          0x4b, 0xe7, 0x9f, 0x9f, 0xd4, 0xfb, 0x18, 0x9, 0x60, 0xa3, 0x77, 0x2e, 0x8, 0x68, 0x4, 0x95}},
+        {0x80,
+         "q128_" + std::string(128, 'q'),
+         {0xca, 0x1b, 0x56, 0x86, 0x14, 0x82, 0xb1, 0x6e, 0xae, 0xf, 0x4a, 0x26, 0x21, 0x21, 0x12, 0x36,
+          0x2f, 0xcc, 0x2d, 0x76, 0xdc, 0xc8, 0xc, 0x93, 0xc4, 0x18, 0x2e, 0xd6, 0x6c, 0x51, 0x13, 0xfe,
+          0x41, 0x73, 0x3e, 0xd6, 0x8b, 0xe2, 0x94, 0x2a, 0x34, 0x87, 0x39, 0x43, 0x17, 0xf3, 0x37, 0x98,
+          0x56, 0xf4, 0x82, 0x2a, 0x61, 0x17, 0x35, 0xe5, 0x5, 0x28, 0xa6, 0xe, 0x7a, 0xde, 0x8e, 0xc8,
+          0xc7, 0x16, 0x70, 0xfe, 0xc6, 0x66, 0x1e, 0x2c, 0x59, 0xa0, 0x9e, 0xd3, 0x63, 0x86, 0x51, 0x32,
+          0x21, 0x68, 0x8b, 0x35, 0xdc, 0x47, 0xe3, 0xc3, 0x11, 0x1e, 0xe8, 0xc6, 0x7f, 0xf4, 0x95, 0x79,
+          0x8, 0x9d, 0x66, 0x1c, 0xaa, 0x29, 0xdb, 0x1e, 0xf1, 0xe, 0xb6, 0xea, 0xce, 0x57, 0x5b, 0xf3,
+          0xdc, 0x98, 0x6, 0xe7, 0xc4, 0x1, 0x6b, 0xd5, 0xf, 0x3c, 0xe, 0x2a, 0x64, 0x81, 0xee, 0x6d}},
+        {0x80,
+         "a512_" + std::string(512, 'a'),
+         {0x9d, 0x76, 0x3a, 0x5c, 0xe5, 0x8f, 0x65, 0xc9, 0x15, 0x31, 0xb4, 0x10, 0xc, 0x72, 0x66, 0xd4,
+          0x79, 0xa5, 0xd9, 0x77, 0x7b, 0xa7, 0x61, 0x69, 0x3d, 0x5, 0x2a, 0xcd, 0x37, 0xd1, 0x49, 0xe7,
+          0xac, 0x91, 0xc7, 0x96, 0xa1, 0xb, 0x91, 0x9c, 0xd7, 0x4a, 0x59, 0x1a, 0x1e, 0x38, 0x71, 0x9f,
+          0xb9, 0x1b, 0x72, 0x3, 0xe2, 0xaf, 0x31, 0xea, 0xc3, 0xbf, 0xf7, 0xea, 0xd2, 0xc1, 0x95, 0xaf,
+          0x7d, 0x88, 0xb8, 0xbc, 0xa, 0x8a, 0xdf, 0x3d, 0x1e, 0x90, 0xab, 0x9b, 0xed, 0x6d, 0xdc, 0x2b,
+          0x7f, 0x65, 0x5d, 0xd8, 0x6c, 0x73, 0xb, 0xde, 0xae, 0xa8, 0x84, 0xe7, 0x37, 0x41, 0x9, 0x71,
+          0x42, 0xc9, 0x2f, 0xe, 0x3f, 0xc1, 0x81, 0x1b, 0x69, 0x9b, 0xa5, 0x93, 0xc7, 0xfb, 0xd8, 0x1d,
+          0xa2, 0x88, 0xa2, 0x9d, 0x42, 0x3d, 0xf8, 0x31, 0x65, 0x2e, 0x3a, 0x1, 0xa9, 0x37, 0x49, 0x99}}};
+
+    for (const auto &s : samples) {
+        const std::vector<std::uint8_t> msg(std::get<1>(s).begin(), std::get<1>(s).end());
+        check_expand_message<expand_message>(std::get<0>(s), DST, msg, std::get<2>(s));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(expand_message_xof_shake256_test) {
+    // https://www.rfc-editor.org/rfc/rfc9380#appendix-K.6
+    using expand_message = expand_message_xof<256, shake<256>>;
+
+    std::string DST_str("QUUX-V01-CS02-with-expander-SHAKE256");
+    std::vector<std::uint8_t> DST(DST_str.begin(), DST_str.end());
+
+    // {len_in_bytes, msg, uniform_bytes}
+    using samples_type = std::vector<std::tuple<std::size_t, std::string, std::vector<std::uint8_t>>>;
+    samples_type samples {
+        {0x20,
+         "",
+         {0x2f, 0xfc, 0x5, 0xc4, 0x8e, 0xd3, 0x2b, 0x95, 0xd7, 0x2e, 0x80, 0x7f, 0x6e, 0xab, 0x9f, 0x75,
+          0x30, 0xdd, 0x1c, 0x2f, 0x1, 0x39, 0x14, 0xc8, 0xfe, 0xd3, 0x8c, 0x5c, 0xcc, 0x15, 0xad, 0x76}},
+        {0x20,
+         "abc",
+         {0xb3, 0x9e, 0x49, 0x38, 0x67, 0xe2, 0x76, 0x72, 0x16, 0x79, 0x2a, 0xbc, 0xe1, 0xf2, 0x67, 0x6c,
+          0x19, 0x7c, 0x6, 0x92, 0xae, 0xd0, 0x61, 0x56, 0xe, 0xad, 0x25, 0x18, 0x21, 0x80, 0x8e, 0x7}},
+        {0x20,
+         "abcdef0123456789",
+         {0x24, 0x53, 0x89, 0xcf, 0x44, 0xa1, 0x3f, 0xe, 0x70, 0xaf, 0x86, 0x65, 0xfe, 0x53, 0x37, 0xec,
+          0x2d, 0xcd, 0x13, 0x88, 0x90, 0xbb, 0x79, 0x1, 0xc4, 0xad, 0x9c, 0xfc, 0xeb, 0x5, 0x4b, 0x65}},
+        {0x20,
+         "q128_" + std::string(128, 'q'),
+         {0x71, 0x9b, 0x39, 0x11, 0x82, 0x1e, 0x64, 0x28, 0xa5, 0xed, 0x9b, 0x8e, 0x60, 0xf, 0x28, 0x66,
+          0xbc, 0xf2, 0x3c, 0x8f, 0x5, 0x15, 0xe5, 0x2d, 0x6c, 0x6c, 0x1, 0x9a, 0x3, 0xf1, 0x6f, 0xe}},
+        {0x20,
+         "a512_" + std::string(512, 'a'),
+         {0x91, 0x81, 0xea, 0xd5, 0x22, 0xb, 0x19, 0x63, 0xf1, 0xb5, 0x95, 0x1f, 0x35, 0x54, 0x7a, 0x5e,
+          0xa8, 0x6a, 0x82, 0x5, 0x62, 0x28, 0x7d, 0x6c, 0xa4, 0x72, 0x36, 0x33, 0xd1, 0x7c, 0xcb, 0xbc}},
+        {0x80,
+         "",
+         {0x7a, 0x13, 0x61, 0xd2, 0xd7, 0xd8, 0x2d, 0x79, 0xe0, 0x35, 0xb8, 0x88, 0xc, 0x5a, 0x3c, 0x86,
+          0xc5, 0xaf, 0xa7, 0x19, 0x47, 0x8c, 0x0, 0x7d, 0x96, 0xe6, 0xc8, 0x87, 0x37, 0xa3, 0xf6, 0x31,
+          0xdd, 0x74, 0xa2, 0xc8, 0x8d, 0xf7, 0x9a, 0x4c, 0xb5, 0xe5, 0xd9, 0xf7, 0x50, 0x49, 0x57, 0xc7,
+          0xd, 0x66, 0x9e, 0xc6, 0xbf, 0xed, 0xc3, 0x1e, 0x1, 0xe2, 0xba, 0xcc, 0x4f, 0xf3, 0xfd, 0xf9,
+          0xb6, 0xa0, 0xb, 0x17, 0xcc, 0x18, 0xd9, 0xd7, 0x2a, 0xce, 0x7d, 0x6b, 0x81, 0xc2, 0xe4, 0x81,
+          0xb4, 0xf7, 0x3f, 0x34, 0xf9, 0xa7, 0x50, 0x5d, 0xcc, 0xbe, 0x8f, 0x54, 0x85, 0xf3, 0xd2, 0xc,
+          0x54, 0x9, 0xb0, 0x31, 0x0, 0x93, 0xd5, 0xd6, 0x49, 0x2d, 0xea, 0x4e, 0x18, 0xaa, 0x69, 0x79,
+          0xc2, 0x3c, 0x8e, 0xa5, 0xde, 0x1, 0x58, 0x2e, 0x96, 0x89, 0x61, 0x2a, 0xfb, 0xb3, 0x53, 0xdf}},
+        {0x80,
+         "abc",
+         {0xa5, 0x43, 0x3, 0xe6, 0xb1, 0x72, 0x90, 0x97, 0x83, 0x35, 0x3a, 0xb0, 0x5e, 0xf0, 0x8d, 0xd4,
+          0x35, 0xa5, 0x58, 0xc3, 0x19, 0x7d, 0xb0, 0xc1, 0x32, 0x13, 0x46, 0x49, 0x70, 0x8e, 0xb, 0x9b,
+          0x4e, 0x34, 0xfb, 0x99, 0xb9, 0x2a, 0x9e, 0x9e, 0x28, 0xfc, 0x1f, 0x1d, 0x88, 0x60, 0xd8, 0x58,
+          0x97, 0xa8, 0xe0, 0x21, 0xe6, 0x38, 0x2f, 0x3e, 0xea, 0x10, 0x57, 0x7f, 0x96, 0x8f, 0xf6, 0xdf,
+          0x6c, 0x45, 0xfe, 0x62, 0x4c, 0xe6, 0x5c, 0xa2, 0x59, 0x32, 0xf6, 0x79, 0xa4, 0x2a, 0x40, 0x4b,
+          0xc3, 0x68, 0x1e, 0xfe, 0x3, 0xfc, 0xd4, 0x5e, 0xf7, 0x3b, 0xb3, 0xa8, 0xf7, 0x9b, 0xa7, 0x84,
+          0xf8, 0xf, 0x55, 0xea, 0x8a, 0x3c, 0x36, 0x74, 0x8, 0xf3, 0x3, 0x81, 0x29, 0x96, 0x17, 0xf5,
+          0xc, 0x8c, 0xf8, 0xfb, 0xb2, 0x1d, 0xf, 0x1e, 0x1d, 0x70, 0xb0, 0x13, 0x1a, 0x7b, 0x6f, 0xbe}},
+        {0x80,
+         "abcdef0123456789",
+         {0xe4, 0x2e, 0x4d, 0x95, 0x38, 0xa1, 0x89, 0x31, 0x6e, 0x31, 0x54, 0xb8, 0x21, 0xc1, 0xba, 0xfb,
+          0x39, 0xf, 0x78, 0xb2, 0xf0, 0x10, 0xea, 0x40, 0x4e, 0x6a, 0xc0, 0x63, 0xde, 0xb8, 0xc0, 0x85,
+          0x2f, 0xcd, 0x41, 0x2e, 0x9, 0x8e, 0x23, 0x1e, 0x43, 0x42, 0x7b, 0xd2, 0xbe, 0x13, 0x30, 0xbb,
+          0x47, 0xb4, 0x3, 0x9a, 0xd5, 0x7b, 0x30, 0xae, 0x1f, 0xc9, 0x4e, 0x34, 0x99, 0x3b, 0x16, 0x2f,
+          0xf4, 0xd6, 0x95, 0xe4, 0x2d, 0x59, 0xd9, 0x77, 0x7e, 0xa1, 0x8d, 0x38, 0x48, 0xd9, 0xd3, 0x36,
+          0xc2, 0x5d, 0x2a, 0xcb, 0x93, 0xad, 0xca, 0xd0, 0x9, 0xbc, 0xfb, 0x9c, 0xde, 0x12, 0x28, 0x6d,
+          0xf2, 0x67, 0xad, 0xa2, 0x83, 0x6, 0x3d, 0xe0, 0xbb, 0x15, 0x5, 0x56, 0x5b, 0x2e, 0xb6, 0xc9,
+          0xe, 0x31, 0xc4, 0x87, 0x98, 0xec, 0xdc, 0x71, 0xa7, 0x17, 0x56, 0xa9, 0x11, 0xf, 0xf3, 0x73}},
+        {0x80,
+         "q128_" + std::string(128, 'q'),
+         {0x4a, 0xc0, 0x54, 0xdd, 0xa0, 0xa3, 0x8a, 0x65, 0xd0, 0xec, 0xf7, 0xaf, 0xd3, 0xc2, 0x81, 0x23,
+          0x0, 0x2, 0x7c, 0x87, 0x89, 0x65, 0x5e, 0x47, 0xae, 0xcf, 0x1e, 0xcc, 0x1a, 0x24, 0x26, 0xb1,
+          0x74, 0x44, 0xc7, 0x48, 0x2c, 0x99, 0xe5, 0x90, 0x7a, 0xfd, 0x9c, 0x25, 0xb9, 0x91, 0x99, 0x4,
+          0x90, 0xbb, 0x9c, 0x68, 0x6f, 0x43, 0xe7, 0x9b, 0x44, 0x71, 0xa2, 0x3a, 0x70, 0x3d, 0x4b, 0x2,
+          0xf2, 0x3c, 0x66, 0x97, 0x37, 0xa8, 0x86, 0xa7, 0xec, 0x28, 0xbd, 0xdb, 0x92, 0xc3, 0xa9, 0x8d,
+          0xe6, 0x3e, 0xbf, 0x87, 0x8a, 0xa3, 0x63, 0xa5, 0x1, 0xa6, 0x0, 0x55, 0xc0, 0x48, 0xbe, 0xa1,
+          0x18, 0x40, 0xc4, 0x71, 0x7b, 0xea, 0xe7, 0xee, 0xe2, 0x8c, 0x3c, 0xfa, 0x42, 0x85, 0x7b, 0x3d,
+          0x13, 0x1, 0x88, 0x57, 0x19, 0x43, 0xa7, 0xbd, 0x74, 0x7d, 0xe8, 0x31, 0xbd, 0x64, 0x44, 0xe0}},
+        {0x80,
+         "a512_" + std::string(512, 'a'),
+         {0x9, 0xaf, 0xc7, 0x6d, 0x51, 0xc2, 0xcc, 0xcb, 0xc1, 0x29, 0xc2, 0x31, 0x5d, 0xf6, 0x6c, 0x2b,
+          0xe7, 0x29, 0x5a, 0x23, 0x12, 0x3, 0xb8, 0xab, 0x2d, 0xd7, 0xf9, 0x5c, 0x27, 0x72, 0xc6, 0x8e,
+          0x50, 0xb, 0xc7, 0x2e, 0x20, 0xc6, 0x2, 0xab, 0xc9, 0x96, 0x46, 0x63, 0xb7, 0xa0, 0x3a, 0x38,
+          0x9b, 0xe1, 0x28, 0xc5, 0x69, 0x71, 0xce, 0x81, 0x0, 0x1a, 0xb, 0x87, 0x5e, 0x7f, 0xd1, 0x78,
+          0x22, 0xdb, 0x9d, 0x69, 0x79, 0x2d, 0xdf, 0x6a, 0x23, 0xa1, 0x51, 0xbf, 0x47, 0x0, 0x79, 0xc5,
+          0x18, 0x27, 0x9a, 0xef, 0x3e, 0x75, 0x61, 0x1f, 0x8f, 0x82, 0x89, 0x94, 0xa9, 0x98, 0x8f, 0x4a,
+          0x8a, 0x25, 0x6d, 0xdb, 0x8b, 0xae, 0x16, 0x1e, 0x65, 0x8d, 0x5a, 0x2a, 0x9, 0xbc, 0xfe, 0x83,
+          0x9c, 0x63, 0x96, 0xdc, 0x6, 0xee, 0x5c, 0x8f, 0xf3, 0xc2, 0x2d, 0x3b, 0x1f, 0x9d, 0xeb, 0x7e}}};
+
+    for (const auto &s : samples) {
+        const std::vector<std::uint8_t> msg(std::get<1>(s).begin(), std::get<1>(s).end());
+        check_expand_message<expand_message>(std::get<0>(s), DST, msg, std::get<2>(s));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(expand_message_xmd_halo2_blake2b512_test) {
+    // Expansion of the Halo2 (pasta_curves) hash_to_field, with the DST it builds for the domain prefix "z.cash:test"
+    using expand_message = expand_message_xmd_halo2<256, blake2b<512>>;
+
+    std::string DST_str("z.cash:test-pallas_XMD:BLAKE2b_SSWU_RO_");
+    std::vector<std::uint8_t> DST(DST_str.begin(), DST_str.end());
+
+    // {len_in_bytes, msg, uniform_bytes}
+    using samples_type = std::vector<std::tuple<std::size_t, std::string, std::vector<std::uint8_t>>>;
+    samples_type samples {
+        {0x80,
+         "",
+         {0x9c, 0xe6, 0x71, 0xf1, 0x33, 0xa4, 0x95, 0xd1, 0x86, 0x39, 0xd3, 0xb6, 0x16, 0x90, 0xa1, 0x1c,
+          0x11, 0xf1, 0xca, 0xe0, 0x74, 0xb3, 0xb, 0xea, 0xf4, 0xe4, 0xfd, 0x1, 0x8d, 0x26, 0x93, 0xd5,
+          0x6f, 0x6a, 0x8f, 0x2f, 0x7a, 0x11, 0x67, 0x73, 0xfa, 0xa3, 0x87, 0x1a, 0x6e, 0x63, 0x9b, 0xc3,
+          0x25, 0x8b, 0xb0, 0x8a, 0x86, 0x89, 0x8f, 0xe2, 0x4d, 0xa7, 0xe1, 0x94, 0x16, 0x14, 0xb4, 0xea,
+          0xce, 0xc8, 0x6a, 0x2f, 0x12, 0x50, 0xf3, 0x2b, 0xda, 0x21, 0x27, 0x7c, 0xa0, 0x33, 0x6, 0x8f,
+          0x4f, 0xe8, 0x38, 0x8c, 0xa3, 0xf8, 0x94, 0x7f, 0x27, 0xdc, 0x26, 0x28, 0xab, 0x32, 0x1f, 0xd1,
+          0xdb, 0x1a, 0xb4, 0x71, 0xe9, 0xa5, 0x18, 0xcf, 0xe1, 0x89, 0x64, 0x51, 0x3d, 0x3e, 0x84, 0x49,
+          0x8d, 0x2d, 0x1b, 0x43, 0xe6, 0x5b, 0xf, 0x76, 0x41, 0x87, 0xa3, 0x38, 0x9a, 0xfe, 0x38, 0x65}},
+        {0x80,
+         "abc",
+         {0x19, 0x70, 0x2, 0x76, 0xa2, 0x20, 0x0, 0xe8, 0x83, 0x3f, 0xab, 0x8a, 0x67, 0x85, 0x4b, 0x6c,
+          0x19, 0x79, 0x8d, 0x83, 0xd2, 0x98, 0x4b, 0x6e, 0x23, 0xba, 0x56, 0xf9, 0xf1, 0xab, 0xc7, 0xd4,
+          0x92, 0xb6, 0x0, 0x9, 0x63, 0x6d, 0x5d, 0xe6, 0xfd, 0x71, 0xc0, 0xb5, 0x2e, 0x5b, 0x90, 0xdd,
+          0x23, 0x22, 0xef, 0x89, 0x5e, 0xb6, 0x85, 0x36, 0x60, 0x70, 0x14, 0xd1, 0x50, 0x8c, 0x69, 0xb2,
+          0xae, 0x38, 0x2, 0x15, 0x7c, 0x50, 0x1e, 0xd0, 0xb0, 0xd5, 0x94, 0xa0, 0x8a, 0x15, 0xd6, 0xe7,
+          0x85, 0xd2, 0xd2, 0x89, 0x68, 0x60, 0x80, 0x8d, 0xa3, 0xc8, 0xde, 0x6b, 0x8, 0x42, 0x5, 0x31,
+          0x2f, 0xdd, 0xda, 0x3b, 0x72, 0xdd, 0x1a, 0xac, 0x96, 0x7c, 0x9a, 0xeb, 0x83, 0x51, 0x8e, 0xe0,
+          0xa1, 0xe3, 0x2b, 0x8, 0x60, 0x52, 0x3a, 0xd0, 0x44, 0x33, 0x89, 0xb3, 0x6, 0x90, 0x2a, 0x24}},
+        {0x80,
+         "Trans rights now!",
+         {0x43, 0x4, 0x53, 0x6a, 0x6d, 0xa1, 0x63, 0xd4, 0x39, 0xc, 0x5f, 0x7f, 0x25, 0x58, 0xd6, 0xcd,
+          0xc6, 0x6a, 0xf, 0xb6, 0x33, 0x90, 0x44, 0xb2, 0x27, 0xca, 0xa7, 0xe2, 0x91, 0xd8, 0x5b, 0xd9,
+          0x92, 0xf1, 0x42, 0xf3, 0xf, 0x23, 0xa, 0x0, 0x7, 0xb2, 0x6a, 0x34, 0xa2, 0x78, 0x9e, 0x80,
+          0xcb, 0x97, 0x26, 0x54, 0xc6, 0x54, 0x48, 0xaf, 0xe8, 0xd3, 0x9, 0x4a, 0xde, 0x95, 0xfa, 0xb2,
+          0x79, 0xdc, 0xea, 0x24, 0xda, 0xe, 0xe8, 0x7c, 0x31, 0xa7, 0x44, 0xc0, 0x7f, 0xd0, 0x31, 0x43,
+          0xe9, 0xc1, 0x4e, 0xec, 0x61, 0x5c, 0xd5, 0xb5, 0xce, 0xe7, 0x6d, 0x13, 0xd, 0x10, 0xf3, 0x73,
+          0xc5, 0xfc, 0x8c, 0x1e, 0x6a, 0xdd, 0x52, 0x11, 0xc9, 0x30, 0x5a, 0xba, 0xb1, 0xf2, 0x48, 0xf6,
+          0xcd, 0xcd, 0xaf, 0xc2, 0x97, 0x56, 0xf6, 0xf6, 0x53, 0xf5, 0xdf, 0x0, 0x51, 0xfb, 0x90, 0x7a}}};
+
+    for (const auto &s : samples) {
+        const std::vector<std::uint8_t> msg(std::get<1>(s).begin(), std::get<1>(s).end());
+        check_expand_message<expand_message>(std::get<0>(s), DST, msg, std::get<2>(s));
+    }
+}
+
 BOOST_AUTO_TEST_CASE(hash_to_field_bls12_381_g1_h2c_sha256_test) {
     // https://tools.ietf.org/html/draft-irtf-cfrg-hash-to-curve-10#appendix-J.9.1
     using curve_type = bls12_381;
@@ -598,4 +888,245 @@ BOOST_AUTO_TEST_CASE(hash_to_curve_bls12_381_g2_h2c_sha256_test) {
     }
 }
 
+
+BOOST_AUTO_TEST_CASE(hash_to_curve_bn254_h2c_sha256_test) {
+    // BN254G1_XMD:SHA-256_SVDW_RO_ with the RFC 9380 test DST and messages, as in gnark-crypto
+    using curve_type = alt_bn128_254;
+    using group_type = typename curve_type::g1_type<>;
+    using h2c_type = ep_map<group_type>;
+    typedef typename group_type::value_type group_value_type;
+    typedef typename group_type::field_type::integral_type integral_type;
+
+    std::string default_tag_str = "QUUX-V01-CS02-with-";
+    std::vector<std::uint8_t> dst(default_tag_str.begin(), default_tag_str.end());
+    dst.insert(dst.end(), h2c_type::suite_type::suite_id.begin(), h2c_type::suite_type::suite_id.end());
+
+    using samples_type = std::vector<std::tuple<std::string, group_value_type>>;
+    samples_type samples {
+        {"",
+         group_value_type(
+             integral_type("4790658965958450548702669593570794336562317867247372723806336874591549759110"),
+             integral_type("1163238807669877429342450210709044731909255047583162173012265677391336920021"), 1)},
+        {"abc",
+         group_value_type(
+             integral_type("16267524812466668166267883771992486438338357688076900798565538061554532963281"),
+             integral_type("1844916233815282837483764409618609279507070495361570126601873459268232811805"), 1)},
+        {"abcdef0123456789",
+         group_value_type(
+             integral_type("11077683243901808951859264683654586764079462418577485658911541848692394044746"),
+             integral_type("4858124309270455482359664916577923636817363175462672327824733704859450489677"), 1)},
+        {"q128_" + std::string(128, 'q'),
+         group_value_type(
+             integral_type("449076125358095157945547407089359408531318284903480972761046551095956160348"),
+             integral_type("3427911873443593747709927415036866402371639925174562008506349359915732032632"), 1)},
+        {"a512_" + std::string(512, 'a'),
+         group_value_type(
+             integral_type("763925112321939766609678334678065587309331741428777416269918389033192485838"),
+             integral_type("12636771015364464547273606234110225240317241569495907283228710706019336772016"), 1)},
+    };
+
+    for (auto &s : samples) {
+        check_hash_to_curve<h2c_type>(std::get<0>(s), std::get<1>(s), dst);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(hash_to_curve_secp256k1_h2c_sha256_test) {
+    // https://datatracker.ietf.org/doc/html/rfc9380#appendix-J.8.1
+    using curve_type = secp256k1;
+    using group_type = typename curve_type::g1_type<>;
+    using h2c_type = ep_map<group_type>;
+    typedef typename group_type::value_type group_value_type;
+    typedef typename group_type::field_type::integral_type integral_type;
+
+    std::string default_tag_str = "QUUX-V01-CS02-with-";
+    std::vector<std::uint8_t> dst(default_tag_str.begin(), default_tag_str.end());
+    dst.insert(dst.end(), h2c_type::suite_type::suite_id.begin(), h2c_type::suite_type::suite_id.end());
+
+    using samples_type = std::vector<std::tuple<std::string, group_value_type>>;
+    samples_type samples {
+        {"",
+         group_value_type(integral_type("87654846584422849836571930156466438379984710599888121545025567473301233275718"),
+                          integral_type("45673711333516174500892987253036094404176536844955599116957274814081860440167"),
+                          1)},
+        {"abc",
+         group_value_type(integral_type("23279756896471199523010870052867415078463234370173863328176697381984636972107"),
+                          integral_type("57707937931845145617875053157352479097727553907460720360838645569336604062198"),
+                          1)},
+    };
+
+    for (auto &s : samples) {
+        check_hash_to_curve<h2c_type>(std::get<0>(s), std::get<1>(s), dst);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(hash_to_curve_curve25519_h2c_sha512_test) {
+    // https://datatracker.ietf.org/doc/html/rfc9380#appendix-J.4.1
+    using curve_type = curve25519;
+    using group_type = typename curve_type::g1_type<coordinates::affine>;
+    using h2c_type = ep_map<group_type>;
+    typedef typename group_type::value_type group_value_type;
+    typedef typename group_type::field_type::integral_type integral_type;
+
+    std::string default_tag_str = "QUUX-V01-CS02-with-";
+    std::vector<std::uint8_t> dst(default_tag_str.begin(), default_tag_str.end());
+    dst.insert(dst.end(), h2c_type::suite_type::suite_id.begin(), h2c_type::suite_type::suite_id.end());
+
+    using samples_type = std::vector<std::tuple<std::string, group_value_type>>;
+    samples_type samples {
+        {"",
+         group_value_type(
+             integral_type("20755980968848905962648296223990034442845239978893603531157795489810611935424"),
+             integral_type("26852118219728031323091995148190119438110435709034478870970585906135281625208"))},
+        {"abc",
+         group_value_type(
+             integral_type("19569777156064218054534198942882526166999676911599658275579453249261387141741"),
+             integral_type("12442509356051212157815338548416431200300600320773297574944588861824022939613"))},
+        {"abcdef0123456789",
+         group_value_type(
+             integral_type("47397650878079532494227509431417029996387031535819449866217359742935803150390"),
+             integral_type("19094947021255684298011553164078194253087471165107202249630710190707581158227"))},
+        {"q128_" + std::string(128, 'q'),
+         group_value_type(
+             integral_type("4266249252606483986742403089465725364716722706517591009737387044691313405018"),
+             integral_type("13890331492573542690000664920356684539709768382865283190759386200053484741461"))},
+        {"a512_" + std::string(512, 'a'),
+         group_value_type(
+             integral_type("12562450149701646148146288404797240662221927718297742227617046127126572156414"),
+             integral_type("44434477500711011338132193547453233746236458248461054299163307869577452887025"))},
+    };
+
+    for (auto &s : samples) {
+        check_hash_to_curve<h2c_type>(std::get<0>(s), std::get<1>(s), dst);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(hash_to_curve_edwards25519_h2c_sha512_test) {
+    // https://datatracker.ietf.org/doc/html/rfc9380#appendix-J.5.1
+    using curve_type = ed25519;
+    using group_type = typename curve_type::g1_type<>;
+    using h2c_type = ep_map<group_type>;
+    typedef typename group_type::value_type group_value_type;
+    typedef typename group_type::field_type::value_type field_value_type;
+    typedef typename group_type::field_type::integral_type integral_type;
+
+    std::string default_tag_str = "QUUX-V01-CS02-with-";
+    std::vector<std::uint8_t> dst(default_tag_str.begin(), default_tag_str.end());
+    dst.insert(dst.end(), h2c_type::suite_type::suite_id.begin(), h2c_type::suite_type::suite_id.end());
+
+    auto affine = [](const field_value_type &x, const field_value_type &y) {
+        return group_value_type(x, y, x * y, field_value_type::one());
+    };
+
+    using samples_type = std::vector<std::tuple<std::string, group_value_type>>;
+    samples_type samples {
+        {"", affine(integral_type("27247698221496130860672250702331285492359266551758864958952564794703042719686"),
+                    integral_type("4365494920570081337277818293609245942863617850477917088769355520298955693089"))},
+        {"abc", affine(integral_type("43648636456477460004263348763705895480558851257811696399568970296670978370733"),
+                       integral_type("11992624363306089436392391052092071997072262060768411495351425868614798562609"))},
+    };
+
+    for (auto &s : samples) {
+        check_hash_to_curve<h2c_type>(std::get<0>(s), std::get<1>(s), dst);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(hash_to_curve_pallas_h2c_blake2b_test) {
+    // Halo2 (pasta_curves) hash_to_curve with the domain prefix "z.cash:test"
+    using curve_type = pallas;
+    using group_type = typename curve_type::g1_type<>;
+    using h2c_type = ep_map<group_type>;
+    typedef typename group_type::value_type group_value_type;
+    typedef typename group_type::field_type::integral_type integral_type;
+
+    std::string domain_prefix_str = "z.cash:test-";
+    std::vector<std::uint8_t> dst(domain_prefix_str.begin(), domain_prefix_str.end());
+    dst.insert(dst.end(), h2c_type::suite_type::suite_id.begin(), h2c_type::suite_type::suite_id.end());
+
+    using samples_type = std::vector<std::tuple<std::string, group_value_type>>;
+    samples_type samples {
+        {"",
+         group_value_type(
+             integral_type("4668293880139211879678610856490620286703684430728160041811570167245827608129"),
+             integral_type("21652349638777423869478772271617793761569718856003053098155461819649444586328"), 1)},
+        {"abc",
+         group_value_type(
+             integral_type("1680702370664741442189817516936783251322878025457187056152622055679168090709"),
+             integral_type("25165290300205459905818377480449427922892884746483800483793004864780557125631"), 1)},
+        {"Trans rights now!",
+         group_value_type(
+             integral_type("642642413371482960799568583228535683856181246498173069682272021944853354980"),
+             integral_type("9091665271493738981983911400230577507382534070449862966363081536455421169138"), 1)},
+        {"a512_" + std::string(512, 'a'),
+         group_value_type(
+             integral_type("19842283310308087437195791899919008891056026711193327299591973652254737677441"),
+             integral_type("28929023838819555782920968996689476951882489408908469358865589786771175248192"), 1)},
+    };
+
+    for (auto &s : samples) {
+        check_hash_to_curve<h2c_type>(std::get<0>(s), std::get<1>(s), dst);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(hash_to_curve_vesta_h2c_blake2b_test) {
+    // Halo2 (pasta_curves) hash_to_curve with the domain prefix "z.cash:test"
+    using curve_type = vesta;
+    using group_type = typename curve_type::g1_type<>;
+    using h2c_type = ep_map<group_type>;
+    typedef typename group_type::value_type group_value_type;
+    typedef typename group_type::field_type::integral_type integral_type;
+
+    std::string domain_prefix_str = "z.cash:test-";
+    std::vector<std::uint8_t> dst(domain_prefix_str.begin(), domain_prefix_str.end());
+    dst.insert(dst.end(), h2c_type::suite_type::suite_id.begin(), h2c_type::suite_type::suite_id.end());
+
+    using samples_type = std::vector<std::tuple<std::string, group_value_type>>;
+    samples_type samples {
+        {"",
+         group_value_type(
+             integral_type("9802434008100962971885057514997621824302828941196690568359818682221593081570"),
+             integral_type("5973424057798330735540030039612956805973900052914824969859440743311837166524"), 1)},
+        {"abc",
+         group_value_type(
+             integral_type("19711827200894939534542580508385059812645114694887108372376059342919419549593"),
+             integral_type("15439542685261856573985996038724131524285597295558203854876407316904252630362"), 1)},
+        {"Trans rights now!",
+         group_value_type(
+             integral_type("27522006513862331755111144034615355916461268629412437800794022995215783852951"),
+             integral_type("14893598192014491501793361550070682159355427799368593010005100280123967459591"), 1)},
+        {"a512_" + std::string(512, 'a'),
+         group_value_type(
+             integral_type("1485869379504845240360779139400785631452350680753372333732722284728141227594"),
+             integral_type("8179994487142062716691670163877864546315963805810515464973455438467999446640"), 1)},
+    };
+
+    for (auto &s : samples) {
+        check_hash_to_curve<h2c_type>(std::get<0>(s), std::get<1>(s), dst);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(hash_to_curve_batch_test) {
+    const std::vector<std::string> msgs = {"", "abc", "abcdef0123456789", "q128_qqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqq"};
+    std::string default_tag_str = "QUUX-V01-CS02-with-";
+
+    using bn254_h2c_type = ep_map<typename alt_bn128_254::g1_type<>>;
+    std::vector<std::uint8_t> dst(default_tag_str.begin(), default_tag_str.end());
+    dst.insert(dst.end(), bn254_h2c_type::suite_type::suite_id.begin(), bn254_h2c_type::suite_type::suite_id.end());
+    check_hash_to_curve_batch<bn254_h2c_type>(msgs, dst);
+
+    using pallas_h2c_type = ep_map<typename pallas::g1_type<>>;
+    dst.assign(default_tag_str.begin(), default_tag_str.end());
+    dst.insert(dst.end(), pallas_h2c_type::suite_type::suite_id.begin(), pallas_h2c_type::suite_type::suite_id.end());
+    check_hash_to_curve_batch<pallas_h2c_type>(msgs, dst);
+
+    using vesta_h2c_type = ep_map<typename vesta::g1_type<>>;
+    dst.assign(default_tag_str.begin(), default_tag_str.end());
+    dst.insert(dst.end(), vesta_h2c_type::suite_type::suite_id.begin(), vesta_h2c_type::suite_type::suite_id.end());
+    check_hash_to_curve_batch<vesta_h2c_type>(msgs, dst);
+
+    using bls_h2c_type = ep_map<typename bls12_381::g1_type<>>;
+    dst.assign(default_tag_str.begin(), default_tag_str.end());
+    dst.insert(dst.end(), bls_h2c_type::suite_type::suite_id.begin(), bls_h2c_type::suite_type::suite_id.end());
+    check_hash_to_curve_batch<bls_h2c_type>(msgs, dst);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
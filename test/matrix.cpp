@@ -25,6 +25,8 @@
 
 #define BOOST_TEST_MODULE constexpr_matrix_test
 
+#include <vector>
+
 #include <boost/test/unit_test.hpp>
 #include <boost/test/data/test_case.hpp>
 #include <boost/test/data/monomorphic.hpp>
@@ -33,9 +35,14 @@
 #include <nil/crypto3/algebra/matrix/math.hpp>
 #include <nil/crypto3/algebra/matrix/operators.hpp>
 #include <nil/crypto3/algebra/matrix/utility.hpp>
+#include <nil/crypto3/algebra/matrix/dense_matrix.hpp>
+#include <nil/crypto3/algebra/matrix/sparse_matrix.hpp>
 #include <nil/crypto3/algebra/vector/vector.hpp>
 #include <nil/crypto3/algebra/vector/operators.hpp>
 
+#include <nil/crypto3/algebra/fields/bls12/scalar_field.hpp>
+#include <nil/crypto3/algebra/fields/detail/element/fp.hpp>
+
 using namespace nil::crypto3::algebra;
 
 // Uniform initialization
@@ -74,3 +81,144 @@ static_assert(submat<2, 2>(m1, 1, 1) == matrix {{{5., 6.}, {8., 9.}}}, "submat")
 static_assert(rref(m1) == matrix {{{1., 0., -1.}, {0., 1., 2.}, {0., 0., 0.}}}, "rref");
 
 static_assert(rank(m1) == 2, "rank");
+
+BOOST_AUTO_TEST_SUITE(matrix_field_test_suite)
+
+BOOST_AUTO_TEST_CASE(matrix_field_elimination_test) {
+    using value_type = typename fields::bls12_fr<381>::value_type;
+
+    const matrix<value_type, 3, 3> m = {value_type(2),  value_type(3),  value_type(5),
+                                        value_type(7),  value_type(11), value_type(13),
+                                        value_type(17), value_type(19), value_type(23)};
+    const matrix<value_type, 3, 3> m_inv = inverse(m);
+
+    BOOST_CHECK(matmul(m, m_inv) == get_identity<value_type, 3>());
+    BOOST_CHECK(matmul(m_inv, m) == get_identity<value_type, 3>());
+    BOOST_CHECK(det(m) == -value_type(78));
+    BOOST_CHECK_EQUAL(rank(m), 3);
+
+    // Zero leading entry forces a row swap, third row is a combination of the first two
+    const matrix<value_type, 3, 3> s = {value_type(0), value_type(1), value_type(2),
+                                        value_type(1), value_type(1), value_type(1),
+                                        value_type(2), value_type(3), value_type(4)};
+    BOOST_CHECK_EQUAL(rank(s), 2);
+    BOOST_CHECK(det(s) == value_type::zero());
+    BOOST_CHECK(rref(s) == (matrix<value_type, 3, 3> {value_type(1), value_type(0), -value_type(1),
+                                                      value_type(0), value_type(1), value_type(2),
+                                                      value_type(0), value_type(0), value_type(0)}));
+    BOOST_CHECK_THROW(inverse(s), const char *);
+}
+
+BOOST_AUTO_TEST_CASE(matrix_field_product_test) {
+    using value_type = typename fields::bls12_fr<381>::value_type;
+
+    // Larger than one block of the blocked kernel in every dimension
+    matrix<value_type, 10, 9> a;
+    matrix<value_type, 9, 11> b;
+    for (std::size_t i = 0; i < 10; ++i) {
+        for (std::size_t j = 0; j < 9; ++j) {
+            a[i][j] = value_type(3 * i + j + 1).pow(7u);
+        }
+    }
+    for (std::size_t i = 0; i < 9; ++i) {
+        for (std::size_t j = 0; j < 11; ++j) {
+            b[i][j] = -value_type(5 * i + 2 * j + 1).pow(5u);
+        }
+    }
+
+    const matrix<value_type, 10, 11> c = matmul(a, b);
+    for (std::size_t i = 0; i < 10; ++i) {
+        for (std::size_t j = 0; j < 11; ++j) {
+            value_type expected = value_type::zero();
+            for (std::size_t k = 0; k < 9; ++k) {
+                expected = expected + a[i][k] * b[k][j];
+            }
+            BOOST_CHECK(c[i][j] == expected);
+        }
+    }
+
+    const vector<value_type, 9> v = b.column(3);
+    const vector<value_type, 10> av = matvectmul(a, v);
+    BOOST_CHECK(av == c.column(3));
+    BOOST_CHECK(vectmatmul(a.row(2), b) == c.row(2));
+
+    std::vector<vector<value_type, 9>> states = {b.column(0), b.column(5), b.column(10)};
+    std::vector<vector<value_type, 10>> images(states.size());
+    batch_matvectmul(a, states.begin(), states.end(), images.begin());
+    BOOST_CHECK(images[0] == c.column(0));
+    BOOST_CHECK(images[1] == c.column(5));
+    BOOST_CHECK(images[2] == c.column(10));
+}
+
+BOOST_AUTO_TEST_CASE(matrix_field_runtime_sized_test) {
+    using value_type = typename fields::bls12_fr<381>::value_type;
+    using triplet_type = typename sparse_matrix<value_type>::triplet_type;
+
+    // R1CS-like matrix: a few nonzeros per row, one dense row, one empty row and a duplicate entry
+    const std::size_t rows = 40, cols = 25;
+    std::vector<triplet_type> entries;
+    for (std::size_t i = 0; i < rows; ++i) {
+        if (i == 17) {
+            continue;
+        }
+        entries.emplace_back(i, (7 * i) % cols, value_type(i + 1));
+        entries.emplace_back(i, (3 * i + 1) % cols, -value_type(2 * i + 3));
+    }
+    for (std::size_t j = 0; j < cols; ++j) {
+        entries.emplace_back(5, j, value_type(j).pow(3u));
+    }
+    entries.emplace_back(0, 0, value_type(11));
+    const sparse_matrix<value_type> a(rows, cols, entries);
+    const dense_matrix<value_type> a_dense = a.to_dense();
+    BOOST_CHECK(sparse_matrix<value_type>(a_dense) == a);
+    BOOST_CHECK(a_dense[0][0] == value_type(12));
+
+    std::vector<value_type> z(cols);
+    for (std::size_t j = 0; j < cols; ++j) {
+        z[j] = value_type(j + 5).pow(11u);
+    }
+
+    std::vector<value_type> expected(rows, value_type::zero());
+    for (std::size_t i = 0; i < rows; ++i) {
+        for (std::size_t j = 0; j < cols; ++j) {
+            expected[i] = expected[i] + a_dense[i][j] * z[j];
+        }
+    }
+    BOOST_CHECK(matvectmul(a_dense, z) == expected);
+    for (std::size_t threads_count : {1, 2, 3, 8, 64}) {
+        BOOST_CHECK(matvectmul(a, z, threads_count) == expected);
+    }
+
+    std::vector<value_type> w(rows);
+    for (std::size_t i = 0; i < rows; ++i) {
+        w[i] = value_type(3 * i + 1).pow(9u);
+    }
+    BOOST_CHECK(vectmatmul(w, a) == vectmatmul(w, a_dense));
+    BOOST_CHECK(transpose(a).to_dense() == transpose(a_dense));
+
+    // Interoperation with the compile-time sized matrix
+    const matrix<value_type, 3, 3> m = {value_type(2),  value_type(3),  value_type(5),
+                                        value_type(7),  value_type(11), value_type(13),
+                                        value_type(17), value_type(19), value_type(23)};
+    const dense_matrix<value_type> m_dense(m);
+    BOOST_CHECK(det(m_dense) == det(m));
+    BOOST_CHECK_EQUAL(rank(m_dense), 3);
+    BOOST_CHECK(inverse(m_dense) == dense_matrix<value_type>(inverse(m)));
+    BOOST_CHECK(matmul(m_dense, inverse(m_dense), 2) == dense_matrix<value_type>::identity(3));
+    BOOST_CHECK_THROW(inverse(dense_matrix<value_type>(3, 3, value_type(5))), const char *);
+}
+
+BOOST_AUTO_TEST_CASE(matrix_field_long_dot_product_test) {
+    using value_type = typename fields::bls12_fr<381>::value_type;
+
+    // Thousands of maximal unreduced products (p - 1)^2 accumulated before a single reduction
+    const std::size_t cols = 4096;
+    const dense_matrix<value_type> a(2, cols, -value_type::one());
+    const std::vector<value_type> z(cols, -value_type::one());
+    BOOST_CHECK(matvectmul(a, z) == std::vector<value_type>(2, value_type(cols)));
+
+    const sparse_matrix<value_type> a_sparse(a);
+    BOOST_CHECK(matvectmul(a_sparse, z, 2) == std::vector<value_type>(2, value_type(cols)));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
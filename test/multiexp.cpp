@@ -30,12 +30,15 @@
 #include <boost/test/data/monomorphic.hpp>
 
 #include <cstdio>
+#include <filesystem>
+#include <string>
 #include <vector>
 #include <chrono>
 #include <ctime>
 
 #include <nil/crypto3/algebra/multiexp/multiexp.hpp>
 #include <nil/crypto3/algebra/multiexp/policies.hpp>
+#include <nil/crypto3/algebra/multiexp/tuning.hpp>
 
 #include <nil/crypto3/algebra/curves/alt_bn128.hpp>
 #include <nil/crypto3/algebra/curves/bls12.hpp>
@@ -178,8 +181,46 @@ void print_performance_csv(size_t expn_start, std::size_t expn_end_fast, std::si
     }
 }
 
+template<typename GroupType>
+void check_straus_multiexp() {
+    typedef typename GroupType::value_type value_type;
+    typedef typename GroupType::curve_type::scalar_field_type field_type;
+
+    for (std::size_t n = 1; n <= policies::multiexp_method_straus::max_size; ++n) {
+        std::vector<value_type> bases;
+        std::vector<typename field_type::value_type> scalars;
+        for (std::size_t i = 0; i < n; ++i) {
+            bases.push_back(random_element<GroupType>());
+            scalars.push_back(random_element<field_type>());
+        }
+        if (n > 2) {
+            scalars[1] = field_type::value_type::zero();
+            bases[2] = value_type::zero();
+        }
+
+        const value_type expected = multiexp<policies::multiexp_method_naive_plain>(
+            bases.cbegin(), bases.cend(), scalars.cbegin(), scalars.cend(), 1);
+        BOOST_CHECK(multiexp<policies::multiexp_method_straus>(bases.cbegin(), bases.cend(), scalars.cbegin(),
+                                                               scalars.cend(), 1) == expected);
+        BOOST_CHECK(multiexp<policies::multiexp_method_BDLO12>(bases.cbegin(), bases.cend(), scalars.cbegin(),
+                                                               scalars.cend(), 1) == expected);
+        BOOST_CHECK(multiexp_with_generator<GroupType>(scalars[0], bases.cbegin() + 1, bases.cend(),
+                                                       scalars.cbegin() + 1, scalars.cend()) ==
+                    expected - scalars[0] * bases[0] + scalars[0] * value_type::one());
+    }
+
+    const typename field_type::value_type a = random_element<field_type>(), b = random_element<field_type>();
+    const value_type Q = random_element<GroupType>();
+    BOOST_CHECK(double_scalar_mul<GroupType>(a, b, Q) == a * value_type::one() + b * Q);
+}
+
 BOOST_AUTO_TEST_SUITE(multiexp_test_suite)
 
+BOOST_AUTO_TEST_CASE(multiexp_straus_test_case) {
+    check_straus_multiexp<curves::bls12<381>::g1_type<>>();
+    check_straus_multiexp<curves::alt_bn128<254>::g1_type<>>();
+}
+
 BOOST_AUTO_TEST_CASE(multiexp_test_case) {
 
     std::cout << "Testing BLS12-381 G1" << std::endl;
@@ -189,4 +230,46 @@ BOOST_AUTO_TEST_CASE(multiexp_test_case) {
     print_performance_csv<curves::bls12<381>::g2_type<>, curves::bls12<381>::scalar_field_type>(2, 20, 14, true);
 }
 
+BOOST_AUTO_TEST_CASE(multiexp_window_tables_test_case) {
+    using group_type = curves::bls12<381>::g1_type<>;
+    using field_type = curves::bls12<381>::scalar_field_type;
+
+    const window_tables tables = tune_window_tables<group_type>(100);
+    BOOST_CHECK_GT(tables.add_cost, 0);
+    BOOST_CHECK_GT(tables.dbl_cost, 0);
+    BOOST_CHECK_EQUAL(tables.pippenger.size(), 32);
+    for (std::size_t i = 1; i < tables.fixed_base.size(); ++i) {
+        BOOST_CHECK(tables.fixed_base[i] == 0 || tables.fixed_base[i] >= tables.fixed_base[i - 1]);
+    }
+
+    const std::string path =
+        (std::filesystem::temp_directory_path() /
+         ("multiexp_window_tables_" + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()) +
+          ".txt"))
+            .string();
+    BOOST_CHECK(save_window_tables<group_type>(path, tables));
+    BOOST_CHECK(!load_window_tables<curves::bls12<381>::g2_type<>>(path));
+    BOOST_CHECK(load_window_tables<group_type>(path));
+
+    // a bucket width of 0 would divide by zero in multiexp_method_BDLO12
+    window_tables invalid = tables;
+    invalid.pippenger[4] = 0;
+    BOOST_CHECK(save_window_tables<group_type>(path, invalid));
+    BOOST_CHECK(!load_window_tables<group_type>(path));
+    std::filesystem::remove(path);
+
+    BOOST_CHECK(tuned_window_tables<group_type>()->pippenger == tables.pippenger);
+    BOOST_CHECK(tuned_window_tables<group_type>()->fixed_base == tables.fixed_base);
+
+    test_instances_t<group_type> group_elements = generate_group_elements<group_type>(1, 1 << 8);
+    test_instances_t<field_type> scalars = generate_scalars<field_type>(1, 1 << 8);
+
+    run_result_t<group_type> tuned =
+        profile_multiexp<group_type, field_type, policies::multiexp_method_BDLO12>(group_elements, scalars);
+    reset_window_tables<group_type>();
+    run_result_t<group_type> defaults =
+        profile_multiexp<group_type, field_type, policies::multiexp_method_BDLO12>(group_elements, scalars);
+    BOOST_CHECK(tuned.second == defaults.second);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
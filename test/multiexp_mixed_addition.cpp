@@ -0,0 +1,145 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE algebra_multiexp_mixed_addition_test
+
+#define USE_MIXED_ADDITION
+
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/multiexp/multiexp.hpp>
+#include <nil/crypto3/algebra/multiexp/policies.hpp>
+
+#include <nil/crypto3/algebra/curves/babyjubjub.hpp>
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/curves/ed25519.hpp>
+#include <nil/crypto3/algebra/curves/edwards.hpp>
+#include <nil/crypto3/algebra/curves/jubjub.hpp>
+#include <nil/crypto3/algebra/curves/secp_r1.hpp>
+
+#include <nil/crypto3/algebra/random_element.hpp>
+
+using namespace nil::crypto3::algebra;
+
+// sums of random points, so that Z != 1
+template<typename GroupType>
+std::vector<typename GroupType::value_type> random_points(std::size_t size) {
+    std::vector<typename GroupType::value_type> result;
+    for (std::size_t i = 0; i < size; ++i) {
+        result.emplace_back(random_element<GroupType>() + random_element<GroupType>());
+    }
+    return result;
+}
+
+template<typename GroupType>
+void check_batch_to_special() {
+    typedef typename GroupType::value_type value_type;
+    typedef typename GroupType::field_type::value_type field_value_type;
+
+    std::vector<value_type> points = random_points<GroupType>(16);
+    points[3] = value_type::zero();
+
+    std::vector<value_type> special = points;
+    batch_to_special(special);
+
+    const value_type P = random_points<GroupType>(1)[0];
+    for (std::size_t i = 0; i < points.size(); ++i) {
+        BOOST_CHECK(special[i] == points[i]);
+        if (!points[i].is_zero()) {
+            BOOST_CHECK(special[i].Z == field_value_type::one());
+        }
+        BOOST_CHECK(P.mixed_add(special[i]) == P + points[i]);
+    }
+}
+
+/// Buckets may receive the same base twice, which needs mixed_add to double
+template<typename GroupType>
+void check_mixed_doubling() {
+    std::vector<typename GroupType::value_type> points = random_points<GroupType>(1);
+    batch_to_special(points);
+    BOOST_CHECK(points[0].mixed_add(points[0]) == points[0].doubled());
+}
+
+template<typename GroupType>
+void check_mixed_multiexp(std::size_t size) {
+    typedef typename GroupType::value_type value_type;
+    typedef typename GroupType::curve_type::scalar_field_type scalar_field_type;
+
+    std::vector<value_type> bases = random_points<GroupType>(size);
+    batch_to_special(bases);
+
+    std::vector<typename scalar_field_type::value_type> scalars;
+    for (std::size_t i = 0; i < size; ++i) {
+        scalars.emplace_back(random_element<scalar_field_type>());
+    }
+    scalars[0] = scalar_field_type::value_type::one();
+    scalars[1] = scalar_field_type::value_type::zero();
+
+    const value_type expected = multiexp<policies::multiexp_method_naive_plain>(bases.begin(), bases.end(),
+                                                                                scalars.begin(), scalars.end(), 1);
+
+    BOOST_CHECK(multiexp<policies::multiexp_method_BDLO12>(bases.begin(), bases.end(), scalars.begin(),
+                                                           scalars.end(), 1) == expected);
+    BOOST_CHECK(multiexp_with_mixed_addition<policies::multiexp_method_BDLO12>(bases.begin(), bases.end(),
+                                                                               scalars.begin(), scalars.end(),
+                                                                               2) == expected);
+}
+
+BOOST_AUTO_TEST_SUITE(multiexp_mixed_addition_test_suite)
+
+BOOST_AUTO_TEST_CASE(batch_to_special_test) {
+    check_batch_to_special<curves::bls12<381>::g1_type<>>();
+    check_batch_to_special<curves::bls12<381>::g2_type<>>();
+    check_batch_to_special<curves::secp_r1<256>::g1_type<curves::coordinates::jacobian>>();
+    check_batch_to_special<curves::secp_r1<256>::g1_type<curves::coordinates::jacobian_with_a4_minus_3>>();
+    check_batch_to_special<curves::secp_r1<256>::g1_type<curves::coordinates::projective>>();
+    check_batch_to_special<curves::secp_r1<256>::g1_type<curves::coordinates::projective_with_a4_minus_3>>();
+    check_batch_to_special<curves::ed25519::g1_type<>>();
+    check_batch_to_special<curves::jubjub::g1_type<curves::coordinates::extended_with_a_minus_1>>();
+    check_batch_to_special<curves::babyjubjub::g1_type<curves::coordinates::inverted>>();
+    check_batch_to_special<curves::edwards<183>::g1_type<>>();
+    check_batch_to_special<curves::edwards<183>::g2_type<>>();
+}
+
+BOOST_AUTO_TEST_CASE(mixed_doubling_test) {
+    check_mixed_doubling<curves::bls12<381>::g1_type<>>();
+    check_mixed_doubling<curves::secp_r1<256>::g1_type<curves::coordinates::projective>>();
+    check_mixed_doubling<curves::ed25519::g1_type<>>();
+    check_mixed_doubling<curves::jubjub::g1_type<curves::coordinates::extended_with_a_minus_1>>();
+}
+
+BOOST_AUTO_TEST_CASE(mixed_multiexp_test) {
+    check_mixed_multiexp<curves::bls12<381>::g1_type<>>(64);
+    check_mixed_multiexp<curves::bls12<381>::g2_type<>>(32);
+    check_mixed_multiexp<curves::secp_r1<256>::g1_type<curves::coordinates::projective>>(64);
+    check_mixed_multiexp<curves::ed25519::g1_type<>>(64);
+    check_mixed_multiexp<curves::jubjub::g1_type<curves::coordinates::extended_with_a_minus_1>>(64);
+    check_mixed_multiexp<curves::babyjubjub::g1_type<curves::coordinates::inverted>>(64);
+    check_mixed_multiexp<curves::edwards<183>::g1_type<>>(32);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
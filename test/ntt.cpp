@@ -0,0 +1,154 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE algebra_ntt_test
+
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/fields/bls12/scalar_field.hpp>
+#include <nil/crypto3/algebra/fields/alt_bn128/scalar_field.hpp>
+#include <nil/crypto3/algebra/fields/pallas/base_field.hpp>
+
+#include <nil/crypto3/algebra/fields/arithmetic_params/bls12.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/alt_bn128.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/pallas.hpp>
+
+#include <nil/crypto3/algebra/ntt/ntt.hpp>
+
+#include <nil/crypto3/algebra/random_element.hpp>
+
+using namespace nil::crypto3::algebra;
+
+template<typename FieldType>
+std::vector<typename FieldType::value_type> random_vector(std::size_t size) {
+    std::vector<typename FieldType::value_type> result(size);
+    for (auto &x : result) {
+        x = random_element<FieldType>();
+    }
+    return result;
+}
+
+template<typename FieldType>
+typename FieldType::value_type evaluate(const std::vector<typename FieldType::value_type> &coeffs,
+                                        const typename FieldType::value_type &x) {
+    typename FieldType::value_type result = FieldType::value_type::zero();
+    for (auto it = coeffs.rbegin(); it != coeffs.rend(); ++it) {
+        result = result * x + *it;
+    }
+    return result;
+}
+
+template<typename FieldType>
+void check_ntt_against_naive(std::size_t size) {
+    typedef typename FieldType::value_type value_type;
+
+    const ntt_domain<FieldType> domain(size);
+    BOOST_CHECK(domain.omega().pow(size).is_one());
+    if (size > 1) {
+        BOOST_CHECK(!domain.omega().pow(size / 2).is_one());
+    }
+
+    const std::vector<value_type> coeffs = random_vector<FieldType>(size);
+
+    std::vector<value_type> values = coeffs;
+    ntt(values, domain);
+    std::vector<value_type> coset_values = coeffs;
+    coset_ntt(coset_values, domain);
+
+    value_type x = value_type::one();
+    for (std::size_t i = 0; i < size; ++i) {
+        BOOST_CHECK(values[i] == evaluate<FieldType>(coeffs, x));
+        BOOST_CHECK(coset_values[i] == evaluate<FieldType>(coeffs, domain.coset_shift() * x));
+        x *= domain.omega();
+    }
+
+    inverse_ntt(values, domain);
+    BOOST_CHECK(values == coeffs);
+    inverse_coset_ntt(coset_values, domain);
+    BOOST_CHECK(coset_values == coeffs);
+}
+
+template<typename FieldType>
+void check_ntt_round_trip(std::size_t size, std::size_t threads_count) {
+    typedef typename FieldType::value_type value_type;
+
+    const ntt_domain<FieldType> domain(size);
+    const ntt_domain<FieldType> threaded_domain(size, threads_count);
+    BOOST_CHECK(domain.twiddles() == threaded_domain.twiddles());
+
+    const std::vector<value_type> coeffs = random_vector<FieldType>(size);
+
+    std::vector<value_type> values = coeffs, threaded_values = coeffs;
+    ntt(values, domain);
+    ntt(threaded_values, domain, threads_count);
+    BOOST_CHECK(values == threaded_values);
+
+    inverse_ntt(threaded_values, domain, threads_count);
+    BOOST_CHECK(threaded_values == coeffs);
+
+    std::vector<value_type> coset_values = coeffs, threaded_coset_values = coeffs;
+    coset_ntt(coset_values, domain);
+    coset_ntt(threaded_coset_values, domain, threads_count);
+    BOOST_CHECK(coset_values == threaded_coset_values);
+
+    inverse_coset_ntt(threaded_coset_values, domain, threads_count);
+    BOOST_CHECK(threaded_coset_values == coeffs);
+}
+
+BOOST_AUTO_TEST_SUITE(ntt_test_suite)
+
+BOOST_AUTO_TEST_CASE(ntt_naive_bls12_381) {
+    for (std::size_t size = 1; size <= 64; size <<= 1) {
+        check_ntt_against_naive<fields::bls12_fr<381>>(size);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(ntt_naive_alt_bn128) {
+    for (std::size_t size = 1; size <= 64; size <<= 1) {
+        check_ntt_against_naive<fields::alt_bn128_fr<254>>(size);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(ntt_naive_pallas) {
+    for (std::size_t size = 1; size <= 64; size <<= 1) {
+        check_ntt_against_naive<fields::pallas_base_field>(size);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(ntt_round_trip_bls12_381) {
+    check_ntt_round_trip<fields::bls12_fr<381>>(1 << 12, 4);
+}
+
+BOOST_AUTO_TEST_CASE(ntt_round_trip_alt_bn128) {
+    check_ntt_round_trip<fields::alt_bn128_fr<254>>(1 << 12, 3);
+}
+
+BOOST_AUTO_TEST_CASE(ntt_round_trip_pallas) {
+    check_ntt_round_trip<fields::pallas_base_field>(1 << 11, 4);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,182 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020-2021 Mikhail Komarov <nemo@nil.foundation>
+// Copyright (c) 2020-2021 Nikita Kaskov <nbering@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE algebra_operation_counters_test
+
+#define CRYPTO3_ALGEBRA_COUNT_OPERATIONS
+
+#include <thread>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/fields/bls12/base_field.hpp>
+#include <nil/crypto3/algebra/fields/fp2.hpp>
+#include <nil/crypto3/algebra/pairing/bls12.hpp>
+#include <nil/crypto3/algebra/algorithms/pair.hpp>
+
+#include <nil/crypto3/algebra/operation_counters.hpp>
+#include <nil/crypto3/algebra/random_element.hpp>
+
+using namespace nil::crypto3::algebra;
+
+BOOST_AUTO_TEST_SUITE(operation_counters_test_suite)
+
+BOOST_AUTO_TEST_CASE(operation_counters_field) {
+    using field_type = fields::bls12_fq<381>;
+    typename field_type::value_type a = random_element<field_type>(), b = random_element<field_type>();
+
+    scoped_operation_counter counter;
+    typename field_type::value_type c = a * b;
+    c = c.squared();
+    c = c.inversed();
+
+    operation_counts counts = counter.counts();
+    BOOST_CHECK_EQUAL(counts.field_mul, 1);
+    BOOST_CHECK_EQUAL(counts.field_sqr, 1);
+    BOOST_CHECK_EQUAL(counts.field_inv, 1);
+    BOOST_CHECK_EQUAL(counts.field_reduce, 0);
+    BOOST_CHECK_EQUAL(counts.point_add + counts.point_dbl + counts.point_madd, 0);
+
+    counter.restart();
+    c += a;
+    c = c - b;
+    BOOST_CHECK(counter.counts() == operation_counts());
+}
+
+BOOST_AUTO_TEST_CASE(operation_counters_extension_field) {
+    using field_type = fields::fp2<fields::bls12_fq<381>>;
+    using value_type = typename field_type::value_type;
+    value_type a = random_element<field_type>(), b = random_element<field_type>();
+
+    // Karatsuba over u^2 = -1: three Fp multiplications, the non-residue only negates
+    scoped_operation_counter counter;
+    value_type c = a * b;
+
+    operation_counts counts = counter.counts();
+    BOOST_CHECK_EQUAL(counts.field_mul, 3);
+    BOOST_CHECK_EQUAL(counts.field_sqr, 0);
+    BOOST_CHECK_EQUAL(counts.field_inv, 0);
+    BOOST_CHECK_EQUAL(counts.field_reduce, 0);
+
+    // the same product kept unreduced: three unreduced multiplications, one reduction per coefficient
+    counter.restart();
+    value_type d = value_type::dbl_type::mul(a, b).reduce();
+
+    counts = counter.counts();
+    BOOST_CHECK_EQUAL(counts.field_mul, 3);
+    BOOST_CHECK_EQUAL(counts.field_reduce, 2);
+    BOOST_CHECK_EQUAL(c, d);
+}
+
+BOOST_AUTO_TEST_CASE(operation_counters_pairing) {
+    using curve_type = curves::bls12<381>;
+    typename curve_type::g1_type<>::value_type P = random_element<curve_type::g1_type<>>();
+    typename curve_type::g2_type<>::value_type Q = random_element<curve_type::g2_type<>>();
+
+    scoped_operation_counter counter;
+    typename curve_type::gt_type::value_type e = pair_reduced<curve_type>(P, Q);
+
+    operation_counts counts = counter.counts();
+    BOOST_CHECK_GT(counts.field_mul, 0);
+    // the Fp6 multiplications of the Miller loop and the final exponentiation go through the lazy reduction
+    BOOST_CHECK_GT(counts.field_reduce, 0);
+    // final exponentiation inverts once in its easy part
+    BOOST_CHECK_GE(counts.field_inv, 1);
+    BOOST_CHECK(e != curve_type::gt_type::value_type::one());
+}
+
+BOOST_AUTO_TEST_CASE(operation_counters_curve) {
+    using group_type = curves::bls12<381>::g1_type<>;
+    typename group_type::value_type P = random_element<group_type>(), Q = random_element<group_type>();
+    typename group_type::value_type Q_normalized(Q.to_affine().X, Q.to_affine().Y,
+                                                 group_type::field_type::value_type::one());
+
+    scoped_operation_counter counter;
+    typename group_type::value_type R = P + Q;
+    R = R.doubled();
+    R = R.mixed_add(Q_normalized);
+
+    operation_counts counts = counter.counts();
+    BOOST_CHECK_EQUAL(counts.point_add, 1);
+    BOOST_CHECK_EQUAL(counts.point_dbl, 1);
+    BOOST_CHECK_EQUAL(counts.point_madd, 1);
+    BOOST_CHECK_GT(counts.field_mul + counts.field_sqr, 0);
+    BOOST_CHECK_EQUAL(counts.field_inv, 0);
+}
+
+BOOST_AUTO_TEST_CASE(operation_counters_curve_equal_inputs) {
+    using group_type = curves::bls12<381>::g1_type<>;
+    typename group_type::value_type P = random_element<group_type>();
+    typename group_type::value_type P_normalized(P.to_affine().X, P.to_affine().Y,
+                                                 group_type::field_type::value_type::one());
+
+    // P + P and P + (-P) are detected inside the addition formulas: only the path taken is counted
+    scoped_operation_counter counter;
+    typename group_type::value_type R = P + P;
+
+    operation_counts counts = counter.counts();
+    BOOST_CHECK_EQUAL(counts.point_add, 0);
+    BOOST_CHECK_EQUAL(counts.point_dbl, 1);
+    BOOST_CHECK_EQUAL(counts.point_madd, 0);
+    BOOST_CHECK(R == P.doubled());
+
+    counter.restart();
+    R = P_normalized.mixed_add(P_normalized);
+
+    counts = counter.counts();
+    BOOST_CHECK_EQUAL(counts.point_add, 0);
+    BOOST_CHECK_EQUAL(counts.point_dbl, 1);
+    BOOST_CHECK_EQUAL(counts.point_madd, 0);
+
+    counter.restart();
+    R = P + (-P);
+
+    counts = counter.counts();
+    BOOST_CHECK_EQUAL(counts.point_add + counts.point_dbl + counts.point_madd, 0);
+    BOOST_CHECK(R.is_zero());
+}
+
+BOOST_AUTO_TEST_CASE(operation_counters_per_thread) {
+    using field_type = fields::bls12_fq<381>;
+    typename field_type::value_type a = random_element<field_type>();
+
+    scoped_operation_counter counter;
+    operation_counts other_thread_counts;
+    std::thread worker([&]() {
+        scoped_operation_counter worker_counter;
+        typename field_type::value_type b = a;
+        for (int i = 0; i < 100; ++i) {
+            b = b * a;
+        }
+        other_thread_counts = worker_counter.counts();
+    });
+    worker.join();
+
+    BOOST_CHECK_EQUAL(other_thread_counts.field_mul, 100);
+    BOOST_CHECK(counter.counts() == operation_counts());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -27,6 +27,8 @@
 #define BOOST_TEST_MODULE algebra_curves_test
 
 #include <iostream>
+#include <string>
+#include <utility>
 #include <vector>
 #include <array>
 
@@ -39,15 +41,20 @@
 
 #include <nil/crypto3/multiprecision/cpp_int.hpp>
 
+#include <nil/crypto3/algebra/curves/alt_bn128.hpp>
 #include <nil/crypto3/algebra/curves/bls12.hpp>
 #include <nil/crypto3/algebra/curves/mnt4.hpp>
 #include <nil/crypto3/algebra/curves/mnt6.hpp>
+#include <nil/crypto3/algebra/curves/edwards.hpp>
 
+#include <nil/crypto3/algebra/pairing/alt_bn128.hpp>
 #include <nil/crypto3/algebra/pairing/bls12.hpp>
 #include <nil/crypto3/algebra/pairing/mnt4.hpp>
 #include <nil/crypto3/algebra/pairing/mnt6.hpp>
+#include <nil/crypto3/algebra/pairing/edwards.hpp>
 
 #include <nil/crypto3/algebra/algorithms/pair.hpp>
+#include <nil/crypto3/algebra/algorithms/bls_batch_verifier.hpp>
 
 #include <nil/crypto3/algebra/fields/detail/element/fp.hpp>
 #include <nil/crypto3/algebra/fields/detail/element/fp4.hpp>
@@ -319,6 +326,15 @@ namespace boost {
                 }
             };
 
+            template<>
+            struct print_log_value<curves::alt_bn128<254>::gt_type::value_type> {
+                void operator()(std::ostream &os,
+                                const typename curves::alt_bn128<254>::gt_type::value_type &e) {
+                    print_field_element(os, e);
+                    std::cout << std::endl;
+                }
+            };
+
             template<>
             struct print_log_value<curves::mnt4<298>::g1_type<>::value_type> {
                 void operator()(std::ostream &os,
@@ -516,6 +532,21 @@ void check_pairing_operations(std::vector<Fr_value_type> &Fr_elements,
                       double_miller_loop<CurveType>(G1_prec_elements[prec_A1], G2_prec_elements[prec_B1],
                                                    G1_prec_elements[prec_A2], G2_prec_elements[prec_B2]));
     std::cout << " * Miller loop tests finished." << std::endl << std::endl;
+
+    using fused_policy = fused_pairing_policy<CurveType>;
+
+    std::cout << " * Fused Miller loop tests started..." << std::endl;
+    BOOST_CHECK_EQUAL((pair<CurveType, fused_policy>(G1_elements[A1], G2_elements[B1])),
+                      GT_elements[pairing_A1_B1]);
+    BOOST_CHECK_EQUAL((pair<CurveType, fused_policy>(G1_elements[A2], G2_elements[B2])),
+                      GT_elements[pairing_A2_B2]);
+    BOOST_CHECK_EQUAL((pair_reduced<CurveType, fused_policy>(G1_elements[A1], G2_elements[B1])),
+                      GT_elements[pair_reduceding_A1_B1]);
+    BOOST_CHECK_EQUAL((double_miller_loop<CurveType, fused_policy>(
+                          G1_prec_elements[prec_A1], precompute_g2<CurveType, fused_policy>(G2_elements[B1]),
+                          G1_prec_elements[prec_A2], precompute_g2<CurveType, fused_policy>(G2_elements[B2]))),
+                      GT_elements[double_miller_loop_prec_A1_prec_B1_prec_A2_prec_B2]);
+    std::cout << " * Fused Miller loop tests finished." << std::endl << std::endl;
 }
 
 template<typename ElementType>
@@ -901,6 +932,88 @@ void pairing_operation_test(const TestSet &test_set) {
                                        G2_prec_elements);
 }
 
+// Pairing checks in the EIP-197 precompile encoding: each pair is x, y of the G1 point followed by x.c1, x.c0,
+// y.c1, y.c0 of the G2 point, 32 big-endian bytes each
+// The expected results were computed with py_ecc 8.0.0 (py_ecc.optimized_bn128), the EIP-197 reference
+const std::vector<std::pair<std::string, bool>> alt_bn128_eip197_vectors = {
+    {"28d238b5f65c2fbb88d33da5566c7fc067ed6d386499e9487f3d66eb1a584273075bc1c1f5e992ad489284d25a86b148"
+     "ee3a091d28de4b42440be17ecb2bad06106ce16fc65f7f29999d011b425ca2b57925f220ab76416ca21ff3099444e305"
+     "0241d8c635481430460325d41d935a82424ee6450db255a391e4a8ca14dc5c64258df18a0809ed94f4342ef1cb5d91a9"
+     "e5668b0be2441141c0f7cbfbb595883306e7d4fa3bd35ab1fb19ca7723de7a2e01bb9af3a48242e5e1823c60115d257b"
+     "04547f8bcfbf173388ce051ed932a805ea5c5e4b0c83cd4590637b67e3a9c673084f9d6fe117dc091c1b11ccb24fa032"
+     "b6a3786ff34afeab796dbcbe11f3af00198e9393920d483a7260bfb731fb5d25f1aa493335a9e71297e485b7aef312c2"
+     "1800deef121f1e76426a00665e5c4479674322d4f75edadd46debd5cd992f6ed090689d0585ff075ec9e99ad690c3395"
+     "bc4b313370b38ef355acdadcd122975b12c85ea5db8c6deb4aab71808dcb408fe3d1e7690c43d37b4ce6cc0166fa7daa",
+     true},
+    {"28d238b5f65c2fbb88d33da5566c7fc067ed6d386499e9487f3d66eb1a584273075bc1c1f5e992ad489284d25a86b148"
+     "ee3a091d28de4b42440be17ecb2bad06106ce16fc65f7f29999d011b425ca2b57925f220ab76416ca21ff3099444e305"
+     "0241d8c635481430460325d41d935a82424ee6450db255a391e4a8ca14dc5c64258df18a0809ed94f4342ef1cb5d91a9"
+     "e5668b0be2441141c0f7cbfbb595883306e7d4fa3bd35ab1fb19ca7723de7a2e01bb9af3a48242e5e1823c60115d257b"
+     "2a46be280922039a06f834000a5f0cd88cd8d352b5f57f5e89ba768ba5c458f426611c08871eed9aef4ced3d90c092ff"
+     "2214471951f36289c0e85d1cf14ede8104d2e6437288095505bb52e561ed8f14f89deb6a32a909ceed73fa891fae12dc"
+     "0881a521c13faeeeb49f371bdbdadd20a8d9f42735d53e7a637ec8291bf4b0881c4f0c0d8f7366c764fe6763d51028bc"
+     "b72f967ad773cd8991ca79da8d32818428773326f878977925476ae1fbb3c2c5c9d099cc89c594420f82d5c94e5232c5"
+     "000000000000000000000000000000000000000000000000000000000000000130644e72e131a029b85045b68181585d"
+     "97816a916871ca8d3c208c16d87cfd450d9b90329f5512b1cdb9ea19e360d85d141ba52df38e892e99ca07c89d076939"
+     "00f5c0cbc3d948a199364f5bf36195d0fd199d2e570ad8dcca932ea9610925730c464b09afc04c9ad9a056498c39e1b4"
+     "97cbe52cf2cb59201c347ca6b36f91171ee67f1d5832e0b3f9dd6a77cab01e31e2dd3bef5bf33d210355965406d4da6c",
+     true},
+    {"28d238b5f65c2fbb88d33da5566c7fc067ed6d386499e9487f3d66eb1a584273075bc1c1f5e992ad489284d25a86b148"
+     "ee3a091d28de4b42440be17ecb2bad06106ce16fc65f7f29999d011b425ca2b57925f220ab76416ca21ff3099444e305"
+     "0241d8c635481430460325d41d935a82424ee6450db255a391e4a8ca14dc5c64258df18a0809ed94f4342ef1cb5d91a9"
+     "e5668b0be2441141c0f7cbfbb595883306e7d4fa3bd35ab1fb19ca7723de7a2e01bb9af3a48242e5e1823c60115d257b"
+     "014cdf386fca36380f63c337fd3bea25aba91ba93f73f9a5acf0c7883743fdd51b5248d6e0ea366622313d531ecb4dfb"
+     "42d982a496c804694cf2554a07fac55f198e9393920d483a7260bfb731fb5d25f1aa493335a9e71297e485b7aef312c2"
+     "1800deef121f1e76426a00665e5c4479674322d4f75edadd46debd5cd992f6ed090689d0585ff075ec9e99ad690c3395"
+     "bc4b313370b38ef355acdadcd122975b12c85ea5db8c6deb4aab71808dcb408fe3d1e7690c43d37b4ce6cc0166fa7daa",
+     false},
+    {"000000000000000000000000000000000000000000000000000000000000000100000000000000000000000000000000"
+     "00000000000000000000000000000002198e9393920d483a7260bfb731fb5d25f1aa493335a9e71297e485b7aef312c2"
+     "1800deef121f1e76426a00665e5c4479674322d4f75edadd46debd5cd992f6ed090689d0585ff075ec9e99ad690c3395"
+     "bc4b313370b38ef355acdadcd122975b12c85ea5db8c6deb4aab71808dcb408fe3d1e7690c43d37b4ce6cc0166fa7daa",
+     false},
+};
+
+// e(G1, G2) as returned by pair_reduced: the (p^12 - 1) / r power of the Miller loop raised to 2z(6z^2 + 3z + 1),
+// listed as the Fp2 coefficients c0.c0, c0.c1, c0.c2, c1.c0, c1.c1, c1.c2
+// Computed with py_ecc 8.0.0 (py_ecc.optimized_bn128.pairing) and converted from its w-basis to this tower
+const std::array<std::array<const char *, 2>, 6> alt_bn128_generators_pairing = {{
+    {"0x262b253feda94cfe0da01bde280a3ed6f87e5feb898578b55e1f63739d870e95",
+     "0x02e02d2cc795a2000a1b1f823879abbd397c4dea0918ed66b49d34b48efb8a4a"},
+    {"0x13a9f2d6e29b128da5b1ad44b31977935fd2957387ecb1fc4e135402fdbd1de0",
+     "0x040ba9fa500f1a5c4b31984a74e68659c4b420bd699ce630b130b08a6ea1162b"},
+    {"0x0afc2f3fd870678fbe359d7f9873f052478f590b211ce30bf5e3eeaef89eafdb",
+     "0x1c54a530398c9064bdc662d929e645cadda9a712cc5a8243f9cddbd2d98dd1f0"},
+    {"0x095c0fbf5d5a1ac023794a0d856f92591ba990ecfd4b7aef5c0d58c5dc2429fe",
+     "0x14d3d6ca72d8a950a31dc10f7b4053c9e9ad9ebb590cb4a60f8215d4b99f2b4a"},
+    {"0x1dc0e7bbc3d70e6689dc206b4b91c85759dc1a23043c585fdfaf545838ca7429",
+     "0x0b53320e5a6488cb98a855ffc837d2a75ab90d61ac16cc1b7ab2cd3ed5e22b97"},
+    {"0x13a8afd3085dae4c6c91476ef36cd1d318ce07bac42a9c0f9bd7fddaf5ebd723",
+     "0x00f97b5221474526b601f3730a3afa965ceee1b343940c383e5314859e762c97"}
+}};
+
+/// EIP-197 pairing check: true if the product of the pairings of all (G1, G2) pairs in input is one
+bool alt_bn128_pairing_check(const std::string &input) {
+    using curve_type = curves::alt_bn128<254>;
+    using integral_type = typename curve_type::base_field_type::integral_type;
+    using fp_value_type = typename curve_type::base_field_type::value_type;
+    using g1_value_type = typename curve_type::template g1_type<>::value_type;
+    using g2_value_type = typename curve_type::template g2_type<>::value_type;
+    using g2_field_value_type = typename g2_value_type::field_type::value_type;
+    using gt_value_type = typename curve_type::gt_type::value_type;
+
+    const auto word = [&](std::size_t i) { return fp_value_type(integral_type("0x" + input.substr(64 * i, 64))); };
+
+    gt_value_type f = gt_value_type::one();
+    for (std::size_t i = 0; 64 * i < input.size(); i += 6) {
+        const g1_value_type P(word(i), word(i + 1), fp_value_type::one());
+        const g2_value_type Q(g2_field_value_type(word(i + 3), word(i + 2)),
+                              g2_field_value_type(word(i + 5), word(i + 4)), g2_field_value_type::one());
+        f = f * miller_loop<curve_type>(precompute_g1<curve_type>(P), precompute_g2<curve_type>(Q));
+    }
+    return final_exponentiation<curve_type>(f) == gt_value_type::one();
+}
+
 BOOST_AUTO_TEST_SUITE(pairing_manual_tests)
 
 // TODO: fix pair_reduceding
@@ -921,4 +1034,166 @@ BOOST_DATA_TEST_CASE(pairing_operation_test_mnt6_298, string_data("pairing_opera
 
     pairing_operation_test<curve_type>(data_set);
 }
+
+BOOST_AUTO_TEST_CASE(pairing_bilinearity_test_alt_bn128_254) {
+    using curve_type = typename curves::alt_bn128<254>;
+    using scalar_value_type = typename curve_type::scalar_field_type::value_type;
+    using g1_value_type = typename curve_type::template g1_type<>::value_type;
+    using g2_value_type = typename curve_type::template g2_type<>::value_type;
+    using gt_value_type = typename curve_type::gt_type::value_type;
+    using fused_policy = fused_pairing_policy<curve_type>;
+
+    const scalar_value_type a(0x1CE2D5B8), b(0x3F41B9);
+    const g1_value_type P = g1_value_type::one();
+    const g2_value_type Q = g2_value_type::one();
+
+    const gt_value_type e = pair_reduced<curve_type>(P, Q);
+    BOOST_CHECK(e != gt_value_type::one());
+    BOOST_CHECK_EQUAL(pair_reduced<curve_type>(a * P, Q), pair_reduced<curve_type>(P, a * Q));
+    BOOST_CHECK_EQUAL(pair_reduced<curve_type>(a * P, b * Q), e.pow(cpp_int((a * b).data)));
+    BOOST_CHECK_EQUAL((pair_reduced<curve_type, fused_policy>(a * P, b * Q)), pair_reduced<curve_type>(a * P, b * Q));
+
+    // e(a * P, Q) * e(-P, a * Q) == 1, the EIP-197 pairing check form
+    BOOST_CHECK_EQUAL(final_exponentiation<curve_type>(double_miller_loop<curve_type>(
+                          precompute_g1<curve_type>(a * P), precompute_g2<curve_type>(Q),
+                          precompute_g1<curve_type>(-P), precompute_g2<curve_type>(a * Q))),
+                      gt_value_type::one());
+    BOOST_CHECK_EQUAL(
+        (final_exponentiation<curve_type>(double_miller_loop<curve_type, fused_policy>(
+            precompute_g1<curve_type>(a * P), precompute_g2<curve_type, fused_policy>(Q),
+            precompute_g1<curve_type>(-P), precompute_g2<curve_type, fused_policy>(a * Q)))),
+        gt_value_type::one());
+}
+
+BOOST_AUTO_TEST_CASE(pairing_known_answer_test_alt_bn128_254) {
+    using curve_type = typename curves::alt_bn128<254>;
+    using integral_type = typename curve_type::base_field_type::integral_type;
+    using fp_value_type = typename curve_type::base_field_type::value_type;
+    using g1_value_type = typename curve_type::template g1_type<>::value_type;
+    using g2_value_type = typename curve_type::template g2_type<>::value_type;
+    using gt_value_type = typename curve_type::gt_type::value_type;
+    using fp6_value_type = typename gt_value_type::underlying_type;
+    using fp2_value_type = typename fp6_value_type::underlying_type;
+
+    for (const auto &vector : alt_bn128_eip197_vectors) {
+        BOOST_CHECK_EQUAL(alt_bn128_pairing_check(vector.first), vector.second);
+    }
+
+    std::array<fp2_value_type, 6> c;
+    for (std::size_t i = 0; i < c.size(); ++i) {
+        c[i] = fp2_value_type(fp_value_type(integral_type(alt_bn128_generators_pairing[i][0])),
+                              fp_value_type(integral_type(alt_bn128_generators_pairing[i][1])));
+    }
+    const gt_value_type expected(fp6_value_type(c[0], c[1], c[2]), fp6_value_type(c[3], c[4], c[5]));
+    BOOST_CHECK_EQUAL(pair_reduced<curve_type>(g1_value_type::one(), g2_value_type::one()), expected);
+    BOOST_CHECK_EQUAL((pair_reduced<curve_type, fused_pairing_policy<curve_type>>(g1_value_type::one(),
+                                                                                   g2_value_type::one())),
+                      expected);
+}
+
+BOOST_AUTO_TEST_CASE(pairing_multi_miller_loop_test_bls12_381) {
+    using curve_type = typename curves::bls12<381>;
+    using scalar_value_type = typename curve_type::scalar_field_type::value_type;
+    using g1_value_type = typename curve_type::template g1_type<>::value_type;
+    using g2_value_type = typename curve_type::template g2_type<>::value_type;
+    using g2_affine_value_type = typename curve_type::template g2_type<curves::coordinates::affine>::value_type;
+    using gt_value_type = typename curve_type::gt_type::value_type;
+    using policy_type = pairing_policy<curve_type>;
+
+    const scalar_value_type a(0x1CE2D5B8), b(0x3F41B9), c(0x2A7);
+    const g1_value_type P = g1_value_type::one();
+    const g2_value_type Q = g2_value_type::one();
+
+    std::vector<typename policy_type::g1_precomputed_type> prec_P = {
+        precompute_g1<curve_type>(a * P), precompute_g1<curve_type>(c * P), precompute_g1<curve_type>(-P)};
+    std::vector<g2_affine_value_type> Qs = {(b * Q).to_affine(), Q.to_affine(), ((a * b + c) * Q).to_affine()};
+
+    // e(a * P, b * Q) * e(c * P, Q) * e(-P, (ab + c) * Q) == 1
+    BOOST_CHECK_EQUAL(final_exponentiation<curve_type>(multi_miller_loop<curve_type>(prec_P, Qs)),
+                      gt_value_type::one());
+    prec_P.resize(1);
+    Qs.resize(1);
+    BOOST_CHECK_EQUAL(multi_miller_loop<curve_type>(prec_P, Qs),
+                      miller_loop<curve_type>(prec_P[0], precompute_g2<curve_type>(b * Q)));
+}
+
+BOOST_AUTO_TEST_CASE(pairing_multi_miller_loop_test_edwards_183) {
+    using curve_type = typename curves::edwards<183>;
+    using scalar_value_type = typename curve_type::scalar_field_type::value_type;
+    using g1_value_type = typename curve_type::template g1_type<>::value_type;
+    using g2_value_type = typename curve_type::template g2_type<>::value_type;
+    using g2_affine_value_type = typename curve_type::template g2_type<curves::coordinates::affine>::value_type;
+    using gt_value_type = typename curve_type::gt_type::value_type;
+    using policy_type = pairing_policy<curve_type>;
+
+    const scalar_value_type a(0x1CE2D5B8), b(0x3F41B9);
+    const g1_value_type P = g1_value_type::one();
+    const g2_value_type Q = g2_value_type::one();
+
+    const std::vector<typename policy_type::g1_precomputed_type> prec_P = {precompute_g1<curve_type>(a * P),
+                                                                           precompute_g1<curve_type>(P)};
+    const std::vector<g2_affine_value_type> Qs = {Q.to_affine(), (b * Q).to_affine()};
+
+    BOOST_CHECK_EQUAL(multi_miller_loop<curve_type>(prec_P, Qs),
+                      miller_loop<curve_type>(prec_P[0], precompute_g2<curve_type>(Q)) *
+                          miller_loop<curve_type>(prec_P[1], precompute_g2<curve_type>(b * Q)));
+
+    // The reduced Tate pairing is bilinear as well
+    const auto tate_reduced = [](const g1_value_type &V, const g2_value_type &W) {
+        return final_exponentiation<curve_type>(policy_type::tate_miller_loop::process(
+            policy_type::tate_precompute_g1::process(V), policy_type::tate_precompute_g2::process(W)));
+    };
+    BOOST_CHECK(tate_reduced(P, Q) != gt_value_type::one());
+    BOOST_CHECK_EQUAL(tate_reduced(a * P, Q), tate_reduced(P, a * Q));
+}
+
+BOOST_AUTO_TEST_CASE(bls_batch_verifier_test_bls12_381) {
+    using curve_type = typename curves::bls12<381>;
+    using verifier_type = bls_batch_verifier<curve_type>;
+    using h2c_type = curves::detail::ep2_map<typename curve_type::template g2_type<>>;
+    using scalar_value_type = typename verifier_type::scalar_value_type;
+    using public_key_type = typename verifier_type::public_key_type;
+    using signature_type = typename verifier_type::signature_type;
+
+    const std::string dst_str = "BLS_SIG_BLS12381G2_XMD:SHA-256_SSWU_RO_NUL_";
+    const std::vector<std::uint8_t> dst(dst_str.begin(), dst_str.end());
+    const std::vector<std::vector<std::uint8_t>> messages = {{0x61, 0x62, 0x63}, {0x01}, {}};
+    const std::vector<scalar_value_type> secret_keys = {scalar_value_type(0x1CE2D5B8), scalar_value_type(0x3F41B9),
+                                                        scalar_value_type(0x2A7), scalar_value_type(0xB0B)};
+
+    std::vector<public_key_type> public_keys;
+    for (const scalar_value_type &sk : secret_keys) {
+        public_keys.emplace_back(sk * public_key_type::one());
+    }
+    auto sign = [&](std::size_t signer, const std::vector<std::uint8_t> &msg) {
+        return signature_type(secret_keys[signer] * h2c_type::hash_to_curve(msg, dst));
+    };
+
+    verifier_type verifier(dst);
+    BOOST_CHECK(verifier.finalize());
+
+    // distinct messages, one of them signed twice, plus a same-message aggregate
+    verifier.add_signature(public_keys[0], messages[0], sign(0, messages[0]));
+    verifier.add_signature(public_keys[1], messages[1], sign(1, messages[1]));
+    verifier.add_signature(public_keys[2], messages[0], sign(2, messages[0]));
+    verifier.add_aggregate({public_keys[1], public_keys[3]}, messages[2],
+                           sign(1, messages[2]) + sign(3, messages[2]));
+    BOOST_CHECK(verifier.size() == 4);
+    BOOST_CHECK(verifier.finalize(2));
+    BOOST_CHECK(verifier.size() == 0);
+
+    // a signature on a different message than the one claimed
+    verifier.add_signature(public_keys[0], messages[0], sign(0, messages[0]));
+    verifier.add_signature(public_keys[1], messages[1], sign(1, messages[2]));
+    BOOST_CHECK(!verifier.finalize());
+
+    // a signature attributed to the wrong key
+    verifier.add_signature(public_keys[3], messages[1], sign(2, messages[1]));
+    BOOST_CHECK(!verifier.finalize());
+
+    // an aggregate missing one of its signers
+    verifier.add_aggregate({public_keys[0], public_keys[1], public_keys[2]}, messages[1],
+                           sign(0, messages[1]) + sign(2, messages[1]));
+    BOOST_CHECK(!verifier.finalize());
+}
 BOOST_AUTO_TEST_SUITE_END()